@@ -32,9 +32,13 @@
 #include "Editor/EditorEngine.h"
 #include "Components/BrushComponent.h"
 #include "GameFramework/Volume.h"
+#include "Async/ParallelFor.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogBSPOps, Log, All);
 
+// Minimum number of polygons in a pool before they are split against the splitter plane in parallel
+static const int32 HBSP_PARALLEL_SPLIT_MIN_POLYS = 256;
+
 /** Errors encountered in Csg operation. */
 int32 FHBSPOps::GErrors = 0;
 bool FHBSPOps::GFastRebuild = false;
@@ -483,6 +487,25 @@ void FHBSPOps::SplitPolyList
 	AllocatedFPolys.Add( FrontEdPoly );
 	AllocatedFPolys.Add( BackEdPoly );
 
+	// Splitting each polygon against the splitter plane is independent, so large pools are split
+	// in parallel first. The results are then consumed in order, so the Bsp is the same as when built serially.
+	const bool bParallelSplit = NumPolys >= HBSP_PARALLEL_SPLIT_MIN_POLYS;
+	TArray<int32> SplitSides;
+	TArray<FPoly> SplitFrontPolys;
+	TArray<FPoly> SplitBackPolys;
+	if( bParallelSplit )
+	{
+		SplitSides.SetNumUninitialized(NumPolys);
+		SplitFrontPolys.SetNum(NumPolys);
+		SplitBackPolys.SetNum(NumPolys);
+		ParallelFor(NumPolys, [&](int32 i)
+		{
+			FPoly *EdPoly = PolyList[i];
+			SplitSides[i] = (EdPoly == SplitPoly) ? SP_Coplanar
+				: EdPoly->SplitWithPlane( SplitPoly->Vertices[0], SplitPoly->Normal, &SplitFrontPolys[i], &SplitBackPolys[i], 0 );
+		});
+	}
+
 	for( int32 i=0; i<NumPolys; i++ )
 	{
 		FPoly *EdPoly = PolyList[i];
@@ -491,7 +514,18 @@ void FHBSPOps::SplitPolyList
 			continue;
 		}
 
-		switch( EdPoly->SplitWithPlane( SplitPoly->Vertices[0], SplitPoly->Normal, FrontEdPoly, BackEdPoly, 0 ) )
+		if( bParallelSplit && SplitSides[i] == SP_Split )
+		{
+			// Create front & back nodes from the polys split above.
+			FrontList[NumFront++] = &SplitFrontPolys[i];
+			BackList [NumBack ++] = &SplitBackPolys[i];
+			continue;
+		}
+
+		const int32 SplitSide = bParallelSplit ? SplitSides[i] 
+			: EdPoly->SplitWithPlane( SplitPoly->Vertices[0], SplitPoly->Normal, FrontEdPoly, BackEdPoly, 0 );
+
+		switch( SplitSide )
 		{
 			case SP_Coplanar:
 	            if( RebuildSimplePolys )
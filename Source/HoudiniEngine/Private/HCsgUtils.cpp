@@ -25,6 +25,7 @@
 */
 
 #include "HCsgUtils.h"
+#include "HoudiniInputObject.h"
 
 #include "Engine/Engine.h"
 #include "Engine/Polys.h"
@@ -727,7 +728,9 @@ void UHCsgUtils::FilterWorldThroughBrush
 	}
 }
 
-void UHCsgUtils::RebuildModelFromBrushes(UModel* Model, TArray<ABrush*>& Brushes, bool bTreatMovableBrushesAsStatic)
+void UHCsgUtils::RebuildModelFromBrushes(
+	UModel* Model, TArray<ABrush*>& Brushes, bool bTreatMovableBrushesAsStatic,
+	TMap<TWeakObjectPtr<ABrush>, FHoudiniBrushPolys>* BrushPolysCache)
 {
 	if (!IsValid(Model))
 		return;
@@ -803,11 +806,22 @@ void UHCsgUtils::RebuildModelFromBrushes(UModel* Model, TArray<ABrush*>& Brushes
 	{
 		SlowTask.EnterProgressFrame(1);
 		Brush->Modify();
-		int32 Errors = CsgUtils->ComposeBrushCSG(Brush, Model, Brush->PolyFlags, (EBrushType)Brush->BrushType, CSG_None, false, true, false, false, BspPoints, BspVectors);
+		FHoudiniBrushPolys* BrushPolys = BrushPolysCache ? &BrushPolysCache->FindOrAdd(Brush) : nullptr;
+		int32 Errors = CsgUtils->ComposeBrushCSG(Brush, Model, Brush->PolyFlags, (EBrushType)Brush->BrushType, CSG_None, false, true, false, false, BspPoints, BspVectors, BrushPolys);
 		if (Errors > 1)
 			CsgErrors += Errors - 1;
 	}
 
+	// Release the polygons of the brushes that aren't used anymore
+	if (BrushPolysCache)
+	{
+		for (auto It = BrushPolysCache->CreateIterator(); It; ++It)
+		{
+			if (!It.Key().IsValid() || !StaticBrushes.Contains(It.Key().Get()))
+				It.RemoveCurrent();
+		}
+	}
+
 	// Rebuild dynamic brush BSP's (if they weren't handled earlier)
 	for (ABrush* DynamicBrush : DynamicBrushes)
 	{
@@ -821,7 +835,8 @@ void UHCsgUtils::RebuildModelFromBrushes(UModel* Model, TArray<ABrush*>& Brushes
 
 
 
-UModel* UHCsgUtils::BuildModelFromBrushes(TArray<ABrush*>& Brushes)
+UModel* UHCsgUtils::BuildModelFromBrushes(
+	TArray<ABrush*>& Brushes, TMap<TWeakObjectPtr<ABrush>, FHoudiniBrushPolys>* BrushPolysCache)
 {
 	// Generally UModels are initialized using ABrush. Here we manually
 	// initialize using relevant parts from
@@ -849,7 +864,7 @@ UModel* UHCsgUtils::BuildModelFromBrushes(TArray<ABrush*>& Brushes)
 	//	Brushes[BrushesIdx]->TeleportTo(Location - InPivotLocation, Rotation, false, true);
 	//}
 
-	RebuildModelFromBrushes(OutModel, Brushes, true);
+	RebuildModelFromBrushes(OutModel, Brushes, true, BrushPolysCache);
 	//GEditor->bspBuildFPolys(OutModel, true, 0);
 
 	//if (0 < ConversionTempModel->Polys->Element.Num())
@@ -901,7 +916,8 @@ int UHCsgUtils::ComposeBrushCSG
 	bool		bReplaceNULLMaterialRefs,
 	bool		bShowProgressBar, /*=true*/
 	UHBspPointsGrid* BspPoints,
-	UHBspPointsGrid* BspVectors
+	UHBspPointsGrid* BspVectors,
+	FHoudiniBrushPolys* BrushPolys
 )
 {
 	uint32 NotPolyFlags = 0;
@@ -974,7 +990,14 @@ int UHCsgUtils::ComposeBrushCSG
 	Brush->OwnerScaleWhenLastBuilt = Scale;
 	Brush->bCachedOwnerTransformValid = true;
 
-	for( i=0; i<Brush->Polys->Element.Num(); i++ )
+	// Reuse the brush's polygons from a previous composition if the brush hasn't changed
+	const bool bReuseBrushPolys = BrushPolys && !bReplaceNULLMaterialRefs && BrushPolys->IsUpToDate(Actor, PolyFlags);
+	if (bReuseBrushPolys)
+	{
+		TempModel->Polys->Element.Append(BrushPolys->Polys);
+	}
+
+	for( i=0; i<Brush->Polys->Element.Num() && !bReuseBrushPolys; i++ )
 	{
 		FPoly& CurrentPoly = Brush->Polys->Element[i];
 
@@ -1020,6 +1043,12 @@ int UHCsgUtils::ComposeBrushCSG
 		// Add poly to the temp model.
 		new(TempModel->Polys->Element)FPoly( DestEdPoly );
 	}
+
+	if (BrushPolys && !bReuseBrushPolys)
+	{
+		TArray<FPoly> WorldPolys(TempModel->Polys->Element);
+		BrushPolys->Update(Actor, PolyFlags, MoveTemp(WorldPolys));
+	}
 	if( ReallyBig ) GWarn->StatusUpdate( 0, 0, NSLOCTEXT("UnrealEd", "FilteringBrush", "Filtering brush") );
 
 	// Pass the brush polys through the world Bsp.
@@ -34,6 +34,8 @@
 
 #include "HCsgUtils.generated.h"
 
+struct FHoudiniBrushPolys;
+
 //USTRUCT()
 //struct FHCsgContext
 //{
@@ -66,8 +68,11 @@ public:
 	 * @param Model					The model to be rebuilt.
 	 * @param bSelectedBrushesOnly	Use all brushes in the current level or just the selected ones?.
 	 * @param bTreatMovableBrushesAsStatic	Treat moveable brushes as static?.
+	 * @param BrushPolysCache		Optional cache of the brushes' world space polygons, reused for unchanged brushes.
 	 */
-	static void RebuildModelFromBrushes(UModel* Model, TArray<ABrush*>& Brushes, bool bTreatMovableBrushesAsStatic);
+	static void RebuildModelFromBrushes(
+		UModel* Model, TArray<ABrush*>& Brushes, bool bTreatMovableBrushesAsStatic,
+		TMap<TWeakObjectPtr<ABrush>, FHoudiniBrushPolys>* BrushPolysCache = nullptr);
 
 	/**
 	 * Converts passed in brushes into a single static mesh actor. 
@@ -78,7 +83,8 @@ public:
 	 *
 	 * @return							Returns the newly created actor with the newly created static mesh.
 	 */
-	static UModel* BuildModelFromBrushes(TArray<ABrush*>& Brushes);
+	static UModel* BuildModelFromBrushes(
+		TArray<ABrush*>& Brushes, TMap<TWeakObjectPtr<ABrush>, FHoudiniBrushPolys>* BrushPolysCache = nullptr);
 
 	/**
 	 * Forked version of UEditorEngine::bspBrushCSG() from UnrealEd/Private/EditorBsp.cpp.
@@ -94,6 +100,7 @@ public:
 	 * @param	bMergePolys						If true, coplanar polygons are merged for CSG_Intersect or CSG_Deintersect operations.
 	 * @param	bReplaceNULLMaterialRefs		If true, replace NULL material references with a reference to the GB-selected material.
 	 * @param	bShowProgressBar				If true, display progress bar for complex brushes
+	 * @param	BrushPolys						If valid, the brush's world space polygons are reused from it when up to date, or stored in it.
 	 * @return									0 if nothing happened, 1 if the operation was error-free, or 1+N if N CSG errors occurred.
 	 */
 	int ComposeBrushCSG(
@@ -107,7 +114,8 @@ public:
 		bool		bReplaceNULLMaterialRefs,
 		bool		bShowProgressBar, /*=true*/
 		UHBspPointsGrid* BspPoints,
-		UHBspPointsGrid* BspVectors
+		UHBspPointsGrid* BspVectors,
+		FHoudiniBrushPolys* BrushPolys = nullptr
 	);
 
 protected:
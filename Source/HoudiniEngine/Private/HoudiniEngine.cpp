@@ -29,10 +29,13 @@
 
 #include "HoudiniApi.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineRuntime.h"
 #include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniEngineScheduler.h"
 #include "HoudiniEngineManager.h"
+#include "HoudiniInputTranslator.h"
+#include "HoudiniInstanceTranslator.h"
 #include "HoudiniEngineTask.h"
 #include "HoudiniEngineTaskInfo.h"
 #include "HoudiniAssetComponent.h"
@@ -48,6 +51,7 @@
 #include "Logging/LogMacros.h"
 
 #if WITH_EDITOR
+	#include "Editor.h"
 	#include "Widgets/Notifications/SNotificationList.h"
 	#include "Framework/Notifications/NotificationManager.h"
 #endif
@@ -121,6 +125,8 @@ FHoudiniEngine::StartupModule()
 			LOCTEXT("RuntimeSettingsDescription", "Configure the HoudiniEngine plugin"),
 			GetMutableDefault< UHoudiniRuntimeSettings >());
 	}
+
+	MapChangeHandle = FEditorDelegates::MapChange.AddRaw(this, &FHoudiniEngine::OnMapChange);
 #endif
 
 	// Before starting the module, we need to locate and load HAPI library.
@@ -292,6 +298,9 @@ FHoudiniEngine::ShutdownModule()
 	ISettingsModule * SettingsModule = FModuleManager::GetModulePtr<ISettingsModule>("Settings");
 	if (SettingsModule)
 		SettingsModule->UnregisterSettings("Project", "Plugins", "HoudiniEngine");
+
+	if (MapChangeHandle.IsValid())
+		FEditorDelegates::MapChange.Remove(MapChangeHandle);
 #endif
 
 	// Do scheduler and thread clean up.
@@ -317,6 +326,9 @@ FHoudiniEngine::ShutdownModule()
 	if (HoudiniEngineManager)
 		HoudiniEngineManager->StopHoudiniTicking();
 
+	// Stop tracking the changes that can affect the inputs
+	FHoudiniInputTranslator::ShutdownInputChangeTracker();
+
 	if (HoudiniEngineManager)
 	{
 		delete HoudiniEngineManager;
@@ -836,6 +848,10 @@ FHoudiniEngine::OnSessionLost()
 	bEnableSessionSync = false;
 	HoudiniEngineManager->StopHoudiniTicking();
 
+	// The shared input nodes were lost with the session
+	FHoudiniEngineRuntime::Get().ResetSharedInputNodes();
+	FHoudiniInstanceTranslator::ResetPendingInstanceActorSpawns();
+
 	// This indicates that we likely have lost the session due to a crash in HARS/Houdini
 	FString Notification = TEXT("Houdini Engine Session lost!");
 	FHoudiniEngineUtils::CreateSlateNotification(Notification, 2.0, 4.0);
@@ -871,9 +887,22 @@ FHoudiniEngine::StopSession(HAPI_Session*& SessionPtr)
 
 	HoudiniEngineManager->StopHoudiniTicking();
 
+	// The shared input nodes were deleted with the session
+	FHoudiniEngineRuntime::Get().ResetSharedInputNodes();
+	FHoudiniInstanceTranslator::ResetPendingInstanceActorSpawns();
+
 	return true;
 }
 
+#if WITH_EDITOR
+void
+FHoudiniEngine::OnMapChange(uint32 MapChangeFlags)
+{
+	// The pending spawns and released actors belong to the previous map
+	FHoudiniInstanceTranslator::ResetPendingInstanceActorSpawns();
+}
+#endif
+
 bool
 FHoudiniEngine::RestartSession()
 {
@@ -39,8 +39,12 @@ class FHoudiniEngineManager;
 class UHoudiniAssetComponent;
 class UStaticMesh;
 class UMaterial;
+class AActor;
+class ULevel;
+class UHoudiniInstancedActorComponent;
 
 struct FSlateDynamicImageBrush;
+struct FHoudiniGenericAttribute;
 
 enum class EHoudiniBGEOCommandletStatus : uint8;
 
@@ -58,6 +62,35 @@ enum class EHoudiniSessionStatus : int8
 	NoLicense,		// Failed to acquire a license
 };
 
+// Identifies a pool of released actors: actors are only reused in the level and by the HAC they were spawned for
+struct FHoudiniInstanceActorPoolKey
+{
+	TWeakObjectPtr<ULevel> Level;
+	TWeakObjectPtr<AActor> Owner;
+	TWeakObjectPtr<UObject> InstancedObject;
+
+	bool operator==(const FHoudiniInstanceActorPoolKey& InOther) const
+	{
+		return Level == InOther.Level && Owner == InOther.Owner && InstancedObject == InOther.InstancedObject;
+	}
+
+	friend uint32 GetTypeHash(const FHoudiniInstanceActorPoolKey& InKey)
+	{
+		return HashCombine(HashCombine(GetTypeHash(InKey.Level), GetTypeHash(InKey.Owner)), GetTypeHash(InKey.InstancedObject));
+	}
+};
+
+// Instanced actor spawns that were postponed to the next ticks by the spawn time budget
+struct FHoudiniPendingInstanceActorSpawn
+{
+	TWeakObjectPtr<UHoudiniInstancedActorComponent> IAC;
+	TWeakObjectPtr<ULevel> SpawnLevel;
+	int32 InstanceIndex = -1;
+	int32 OriginalIndex = -1;
+	FTransform Transform;
+	TSharedPtr<TArray<FHoudiniGenericAttribute>> PropertyAttributes;
+};
+
 // Not using the IHoudiniEngine interface for now
 class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 {
@@ -245,8 +278,20 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 		void UnregisterPostEngineInitCallback();
 
+		// Actors released by instanced actor components, per level, owner and instanced object.
+		// They are reused for the actors that need to be spawned until the pending spawns are done, then destroyed.
+		TMap<FHoudiniInstanceActorPoolKey, TArray<TWeakObjectPtr<AActor>>>& GetRecycledInstanceActors() { return RecycledInstanceActors; };
+
+		// Instanced actor spawns postponed to the next ticks by the spawn time budget
+		TArray<FHoudiniPendingInstanceActorSpawn>& GetPendingInstanceActorSpawns() { return PendingInstanceActorSpawns; };
+
 	private:
 
+#if WITH_EDITOR
+		// Resets the state tied to the previous map's actors
+		void OnMapChange(uint32 MapChangeFlags);
+#endif
+
 		// Singleton instance of Houdini Engine.
 		static FHoudiniEngine * HoudiniEngineInstance;
 
@@ -278,6 +323,14 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// Scheduler used to monitor and process Houdini Asset Components
 		FHoudiniEngineManager * HoudiniEngineManager;
 
+		// Released instanced actors kept for reuse, and the instanced actor spawns left for the next ticks
+		TMap<FHoudiniInstanceActorPoolKey, TArray<TWeakObjectPtr<AActor>>> RecycledInstanceActors;
+		TArray<FHoudiniPendingInstanceActorSpawn> PendingInstanceActorSpawns;
+
+#if WITH_EDITOR
+		FDelegateHandle MapChangeHandle;
+#endif
+
 		// Process Handle for session sync
 		FProcHandle HESS_ProcHandle;
 
@@ -38,7 +38,10 @@
 #include "HoudiniInputTranslator.h"
 #include "HoudiniOutputTranslator.h"
 #include "HoudiniHandleTranslator.h"
+#include "HoudiniInstanceTranslator.h"
+#include "HoudiniLandscapeTranslator.h"
 #include "HoudiniSplineTranslator.h"
+#include "HoudiniActorBoundsIndex.h"
 
 #include "Misc/MessageDialog.h"
 #include "Misc/ScopedSlowTask.h"
@@ -133,6 +136,12 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 
 	FHoudiniEngine::Get().TickPersistentNotification(DeltaTime);
 
+	// Spawn the instanced actors that were postponed by previous ticks
+	FHoudiniInstanceTranslator::TickPendingInstanceActorSpawns();
+
+	// Release the landscape backups of the HACs that have been destroyed
+	FHoudiniLandscapeTranslator::PruneLandscapeSnapshots();
+
 	if (bMustStopTicking)
 	{
 		// Ticking should be stopped immediately
@@ -647,6 +656,9 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 
 			HAC->OnPostOutputProcessing();
 			FHoudiniEngineUtils::UpdateBlueprintEditor(HAC);
+
+			// The output components have been rebuilt without any editor notification, update their bounds
+			FHoudiniActorBoundsIndex::Get().MarkActorDirty(HAC->GetOwner(), true);
 			break;
 		}
 
@@ -666,6 +678,7 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			else if (HAC->NeedOutputUpdate())
 			{
 				FHoudiniOutputTranslator::UpdateChangedOutputs(HAC);
+				FHoudiniActorBoundsIndex::Get().MarkActorDirty(HAC->GetOwner(), true);
 			}
 
 			// Update world inputs if we have any
@@ -188,6 +188,8 @@
 #define HAPI_UNREAL_ATTRIB_HIERARCHICAL_INSTANCED_SM		"unreal_hierarchical_instancer"
 #define HAPI_UNREAL_ATTRIB_INSTANCE_NUM_CUSTOM_FLOATS		"unreal_num_custom_floats"
 #define HAPI_UNREAL_ATTRIB_INSTANCE_CUSTOM_DATA_PREFIX		"unreal_per_instance_custom_data"
+// Size of the grid cells used to partition the instances (one HISM per cell), 0 disables the partitioning
+#define HAPI_UNREAL_ATTRIB_INSTANCE_CELL_SIZE				"unreal_instance_cell_size"
 
 
 #define HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_NAME				 HAPI_ATTRIB_NAME
@@ -46,6 +46,7 @@
 #include "HoudiniAssetActor.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniGeoPartObject.h"
+#include "HoudiniGeoWriter.h"
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniInput.h"
 #include "HoudiniAssetComponent.h"
@@ -4154,18 +4155,21 @@ bool
 FHoudiniEngineUtils::CreateGroupsFromTags(
 	const HAPI_NodeId& NodeId,
 	const HAPI_PartId& PartId, 
-	const TArray<FName>& Tags )
+	const TArray<FName>& Tags,
+	FHoudiniGeoWriter* InGeoWriter /* = nullptr */)
 {
 	if (Tags.Num() <= 0)
 		return true;
 
 	HAPI_Result Result = HAPI_RESULT_FAILURE;
+
+	FHoudiniGeoWriter DirectGeoWriter(false);
+	FHoudiniGeoWriter& GeoWriter = InGeoWriter ? *InGeoWriter : DirectGeoWriter;
 	
 	// Get the destination part info
 	HAPI_PartInfo PartInfo;
 	FHoudiniApi::PartInfo_Init(&PartInfo);
-	HOUDINI_CHECK_ERROR_RETURN(	FHoudiniApi::GetPartInfo(
-		FHoudiniEngine::Get().GetSession(),	NodeId, PartId, &PartInfo), false);
+	HOUDINI_CHECK_ERROR_RETURN(	GeoWriter.GetPartInfo(NodeId, PartId, &PartInfo), false);
 
 	bool NeedToCommitGeo = false;
 	for (int32 TagIdx = 0; TagIdx < Tags.Num(); TagIdx++)
@@ -4177,16 +4181,14 @@ FHoudiniEngineUtils::CreateGroupsFromTags(
 		const char * TagStr = FHoudiniEngineUtils::ExtractRawString(TagString);
 
 		// Create a primitive group for this tag
-		if ( HAPI_RESULT_SUCCESS == FHoudiniApi::AddGroup(
-			FHoudiniEngine::Get().GetSession(),
+		if ( HAPI_RESULT_SUCCESS == GeoWriter.AddGroup(
 			NodeId, 0, HAPI_GROUPTYPE_PRIM, TagStr) )
 		{
 			// Set the group's Memberships
 			TArray<int> GroupArray;
 			GroupArray.Init(1, PartInfo.faceCount);
 
-			if ( HAPI_RESULT_SUCCESS == FHoudiniApi::SetGroupMembership(
-				FHoudiniEngine::Get().GetSession(),
+			if ( HAPI_RESULT_SUCCESS == GeoWriter.SetGroupMembership(
 				NodeId, PartId, HAPI_GROUPTYPE_PRIM, TagStr,
 				GroupArray.GetData(), 0, PartInfo.faceCount) )
 			{
@@ -4777,9 +4779,11 @@ FHoudiniEngineUtils::AddLevelPathAttribute(
 	const HAPI_NodeId& InNodeId,
 	const HAPI_PartId& InPartId,
 	ULevel* InLevel,
-	const int32& InCount)
+	const int32& InCount,
+	FHoudiniGeoWriter* InGeoWriter /* = nullptr */)
 {
-	if (InNodeId < 0 || InCount <= 0)
+	// Buffered writers don't need the node yet
+	if ((InNodeId < 0 && !(InGeoWriter && InGeoWriter->IsBuffered())) || InCount <= 0)
 		return false;
 
 	if (!InLevel || InLevel->IsPendingKill())
@@ -4806,9 +4810,11 @@ FHoudiniEngineUtils::AddLevelPathAttribute(
 	AttributeInfoLevelPath.storage = HAPI_STORAGETYPE_STRING;
 	AttributeInfoLevelPath.originalOwner = HAPI_ATTROWNER_INVALID;
 
-	HAPI_Result Result = FHoudiniApi::AddAttribute(
-		FHoudiniEngine::Get().GetSession(), InNodeId, InPartId,
-		MarshallingAttributeLevelPath.c_str(), &AttributeInfoLevelPath);
+	FHoudiniGeoWriter DirectGeoWriter(false);
+	FHoudiniGeoWriter& GeoWriter = InGeoWriter ? *InGeoWriter : DirectGeoWriter;
+
+	HAPI_Result Result = GeoWriter.AddAttribute(
+		InNodeId, InPartId, MarshallingAttributeLevelPath.c_str(), &AttributeInfoLevelPath);
 
 	if (HAPI_RESULT_SUCCESS == Result)
 	{
@@ -4823,8 +4829,7 @@ FHoudiniEngineUtils::AddLevelPathAttribute(
 		}
 
 		// Set the attribute's string data
-		Result = FHoudiniApi::SetAttributeStringData(
-			FHoudiniEngine::Get().GetSession(),
+		Result = GeoWriter.SetAttributeStringData(
 			InNodeId, InPartId,
 			MarshallingAttributeLevelPath.c_str(), &AttributeInfoLevelPath,
 			PrimitiveAttrs.GetData(), 0, AttributeInfoLevelPath.count);
@@ -4847,9 +4852,11 @@ FHoudiniEngineUtils::AddActorPathAttribute(
 	const HAPI_NodeId& InNodeId,
 	const HAPI_PartId& InPartId,
 	AActor* InActor,
-	const int32& InCount)
+	const int32& InCount,
+	FHoudiniGeoWriter* InGeoWriter /* = nullptr */)
 {
-	if (InNodeId < 0 || InCount <= 0)
+	// Buffered writers don't need the node yet
+	if ((InNodeId < 0 && !(InGeoWriter && InGeoWriter->IsBuffered())) || InCount <= 0)
 		return false;
 
 	if (!InActor || InActor->IsPendingKill())
@@ -4871,9 +4878,11 @@ FHoudiniEngineUtils::AddActorPathAttribute(
 	AttributeInfoActorPath.storage = HAPI_STORAGETYPE_STRING;
 	AttributeInfoActorPath.originalOwner = HAPI_ATTROWNER_INVALID;
 
-	HAPI_Result Result = FHoudiniApi::AddAttribute(
-		FHoudiniEngine::Get().GetSession(), InNodeId, InPartId,
-		MarshallingAttributeActorPath.c_str(), &AttributeInfoActorPath);
+	FHoudiniGeoWriter DirectGeoWriter(false);
+	FHoudiniGeoWriter& GeoWriter = InGeoWriter ? *InGeoWriter : DirectGeoWriter;
+
+	HAPI_Result Result = GeoWriter.AddAttribute(
+		InNodeId, InPartId, MarshallingAttributeActorPath.c_str(), &AttributeInfoActorPath);
 
 	if (HAPI_RESULT_SUCCESS == Result)
 	{
@@ -4888,8 +4897,7 @@ FHoudiniEngineUtils::AddActorPathAttribute(
 		}
 
 		// Set the attribute's string data
-		Result = FHoudiniApi::SetAttributeStringData(
-			FHoudiniEngine::Get().GetSession(),
+		Result = GeoWriter.SetAttributeStringData(
 			InNodeId, InPartId,
 			MarshallingAttributeActorPath.c_str(), &AttributeInfoActorPath,
 			PrimitiveAttrs.GetData(), 0, AttributeInfoActorPath.count);
@@ -44,6 +44,7 @@ struct FHoudiniPartInfo;
 struct FHoudiniMeshSocket;
 struct FHoudiniGeoPartObject;
 struct FHoudiniGenericAttribute;
+struct FHoudiniGeoWriter;
 
 struct FRawMesh;
 
@@ -387,7 +388,7 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 
 		// 
 		static bool CreateGroupsFromTags(
-			const HAPI_NodeId& NodeId, const HAPI_PartId& PartId, const TArray<FName>& Tags);
+			const HAPI_NodeId& NodeId, const HAPI_PartId& PartId, const TArray<FName>& Tags, FHoudiniGeoWriter* InGeoWriter = nullptr);
 
 		//
 		static bool CreateAttributesFromTags(
@@ -449,14 +450,16 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			const HAPI_NodeId& InNodeId,
 			const HAPI_PartId& InPartId,
 			ULevel* InLevel,
-			const int32& InCount);
+			const int32& InCount,
+			FHoudiniGeoWriter* InGeoWriter = nullptr);
 
 		// Adds the "unreal_actor_path" primitive attribute
 		static bool AddActorPathAttribute(
 			const HAPI_NodeId& InNodeId,
 			const HAPI_PartId& InPartId,
 			AActor* InActor,
-			const int32& InCount);
+			const int32& InCount,
+			FHoudiniGeoWriter* InGeoWriter = nullptr);
 
 		// Helper function used to extract a const char* from a FString
 		// !! Allocates memory using malloc that will need to be freed afterwards!
@@ -0,0 +1,719 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "HoudiniGeoWriter.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineUtils.h"
+
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineMeshInputGeoUpload(
+	TEXT("HoudiniEngine.MeshInputGeoUpload"),
+	1,
+	TEXT("Controls when input meshes are sent to Houdini as a single geometry blob (LoadGeoFromMemory) instead of one HAPI call per attribute.\n")
+	TEXT("0: Never\n")
+	TEXT("1: For remote (socket / named pipe) sessions only\n")
+	TEXT("2: Always\n"));
+
+// Minimal JSON writer used to encode geometry
+struct FHoudiniGeoJsonStream
+{
+	TArray<ANSICHAR>& Buffer;
+
+	FHoudiniGeoJsonStream(TArray<ANSICHAR>& InBuffer) : Buffer(InBuffer) {}
+
+	void Raw(const ANSICHAR* InString)
+	{
+		Buffer.Append(InString, FCStringAnsi::Strlen(InString));
+	}
+
+	void Key(const ANSICHAR* InKey)
+	{
+		Buffer.Add('"');
+		Raw(InKey);
+		Raw("\",");
+	}
+
+	void Int(const int32& InValue)
+	{
+		ANSICHAR Temp[16];
+		const int32 Len = FCStringAnsi::Snprintf(Temp, sizeof(Temp), "%d", InValue);
+		Buffer.Append(Temp, Len);
+	}
+
+	void Float(const float& InValue)
+	{
+		// NaN / infinite values are not valid JSON
+		if (!FMath::IsFinite(InValue))
+		{
+			Buffer.Add('0');
+			return;
+		}
+
+		ANSICHAR Temp[32];
+		const int32 Len = FCStringAnsi::Snprintf(Temp, sizeof(Temp), "%.9g", InValue);
+		Buffer.Append(Temp, Len);
+	}
+
+	void String(const FString& InString)
+	{
+		Buffer.Add('"');
+		FTCHARToUTF8 Utf8(*InString);
+		for (int32 Idx = 0; Idx < Utf8.Length(); Idx++)
+		{
+			const ANSICHAR Char = Utf8.Get()[Idx];
+			if (Char == '"' || Char == '\\')
+			{
+				Buffer.Add('\\');
+				Buffer.Add(Char);
+			}
+			else if ((uint8)Char < 0x20)
+			{
+				ANSICHAR Temp[8];
+				const int32 Len = FCStringAnsi::Snprintf(Temp, sizeof(Temp), "\\u%04x", (int32)Char);
+				Buffer.Append(Temp, Len);
+			}
+			else
+			{
+				Buffer.Add(Char);
+			}
+		}
+		Buffer.Add('"');
+	}
+
+	void Separator(const int32& InIndex)
+	{
+		if (InIndex > 0)
+			Buffer.Add(',');
+	}
+};
+
+FHoudiniGeoWriter::FHoudiniGeoWriter(const bool& bInBuffered, const bool& bInDeferCommit /* = false */)
+	: bBuffered(bInBuffered || bInDeferCommit)
+	, bDeferCommit(bInDeferCommit)
+	, bHasDeferredCommit(false)
+	, bSentAsBlob(false)
+	, bHasPart(false)
+{
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+}
+
+bool
+FHoudiniGeoWriter::ShouldBufferMeshInputs()
+{
+	const int32 Mode = CVarHoudiniEngineMeshInputGeoUpload.GetValueOnAnyThread();
+	if (Mode <= 0)
+		return false;
+
+	if (Mode >= 2)
+		return true;
+
+	// Each HAPI call is a round trip in remote sessions
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	return Session && Session->type == HAPI_SESSION_THRIFT;
+}
+
+HAPI_Result
+FHoudiniGeoWriter::SetPartInfo(const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, const HAPI_PartInfo* InPartInfo)
+{
+	if (!bBuffered)
+		return FHoudiniApi::SetPartInfo(FHoudiniEngine::Get().GetSession(), InNodeId, InPartId, InPartInfo);
+
+	if (!InPartInfo || InPartId != 0)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	// Setting the part info discards the previous geometry
+	PartInfo = *InPartInfo;
+	bHasPart = true;
+	bHasDeferredCommit = false;
+	bSentAsBlob = false;
+
+	VertexList.Empty();
+	FaceCounts.Empty();
+	Attributes.Empty();
+	Groups.Empty();
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniGeoWriter::GetPartInfo(const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, HAPI_PartInfo* OutPartInfo)
+{
+	if (!bBuffered)
+		return FHoudiniApi::GetPartInfo(FHoudiniEngine::Get().GetSession(), InNodeId, InPartId, OutPartInfo);
+
+	if (!bHasPart || !OutPartInfo || InPartId != 0)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	*OutPartInfo = PartInfo;
+	return HAPI_RESULT_SUCCESS;
+}
+
+FHoudiniGeoWriter::FBufferedAttribute*
+FHoudiniGeoWriter::FindAttribute(const char* InName, const HAPI_AttributeOwner& InOwner)
+{
+	if (!InName)
+		return nullptr;
+
+	const FString Name = UTF8_TO_TCHAR(InName);
+	return Attributes.FindByPredicate([&](const FBufferedAttribute& Attribute)
+	{
+		return Attribute.Info.owner == InOwner && Attribute.Name.Equals(Name, ESearchCase::CaseSensitive);
+	});
+}
+
+FHoudiniGeoWriter::FBufferedGroup*
+FHoudiniGeoWriter::FindGroup(const char* InName, const HAPI_GroupType& InType)
+{
+	if (!InName)
+		return nullptr;
+
+	const FString Name = UTF8_TO_TCHAR(InName);
+	return Groups.FindByPredicate([&](const FBufferedGroup& Group)
+	{
+		return Group.Type == InType && Group.Name.Equals(Name, ESearchCase::CaseSensitive);
+	});
+}
+
+HAPI_Result
+FHoudiniGeoWriter::AddAttribute(
+	const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, const char* InName, const HAPI_AttributeInfo* InAttributeInfo)
+{
+	if (!bBuffered)
+		return FHoudiniApi::AddAttribute(FHoudiniEngine::Get().GetSession(), InNodeId, InPartId, InName, InAttributeInfo);
+
+	if (!bHasPart || !InName || !InAttributeInfo || InAttributeInfo->tupleSize <= 0)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	const HAPI_StorageType Storage = InAttributeInfo->storage;
+	if (Storage != HAPI_STORAGETYPE_FLOAT && Storage != HAPI_STORAGETYPE_INT && Storage != HAPI_STORAGETYPE_STRING)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	FBufferedAttribute* Attribute = FindAttribute(InName, InAttributeInfo->owner);
+	if (!Attribute)
+	{
+		Attribute = &Attributes.AddDefaulted_GetRef();
+		Attribute->Name = UTF8_TO_TCHAR(InName);
+	}
+
+	Attribute->Info = *InAttributeInfo;
+	Attribute->FloatValues.Empty();
+	Attribute->IntValues.Empty();
+	Attribute->Strings.Empty();
+	Attribute->StringIndices.Empty();
+
+	const int32 NumValues = InAttributeInfo->count * InAttributeInfo->tupleSize;
+	if (Storage == HAPI_STORAGETYPE_FLOAT)
+	{
+		Attribute->FloatValues.SetNumZeroed(NumValues);
+	}
+	else
+	{
+		// String values are indices in the string table, index 0 is the default, empty string
+		Attribute->IntValues.SetNumZeroed(NumValues);
+		if (Storage == HAPI_STORAGETYPE_STRING)
+		{
+			Attribute->Strings.Add(FString());
+			Attribute->StringIndices.Add(FString(), 0);
+		}
+	}
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniGeoWriter::SetAttributeFloatData(
+	const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, const char* InName, const HAPI_AttributeInfo* InAttributeInfo,
+	const float* InData, const int32& InStart, const int32& InLength)
+{
+	if (!bBuffered)
+	{
+		return FHoudiniApi::SetAttributeFloatData(
+			FHoudiniEngine::Get().GetSession(), InNodeId, InPartId, InName, InAttributeInfo, InData, InStart, InLength);
+	}
+
+	FBufferedAttribute* Attribute = InAttributeInfo ? FindAttribute(InName, InAttributeInfo->owner) : nullptr;
+	if (!Attribute || !InData || Attribute->Info.storage != HAPI_STORAGETYPE_FLOAT)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	const int32 TupleSize = Attribute->Info.tupleSize;
+	if (InStart < 0 || InLength < 0 || (InStart + InLength) * TupleSize > Attribute->FloatValues.Num())
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	FMemory::Memcpy(Attribute->FloatValues.GetData() + InStart * TupleSize, InData, InLength * TupleSize * sizeof(float));
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniGeoWriter::SetAttributeIntData(
+	const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, const char* InName, const HAPI_AttributeInfo* InAttributeInfo,
+	const int32* InData, const int32& InStart, const int32& InLength)
+{
+	if (!bBuffered)
+	{
+		return FHoudiniApi::SetAttributeIntData(
+			FHoudiniEngine::Get().GetSession(), InNodeId, InPartId, InName, InAttributeInfo, InData, InStart, InLength);
+	}
+
+	FBufferedAttribute* Attribute = InAttributeInfo ? FindAttribute(InName, InAttributeInfo->owner) : nullptr;
+	if (!Attribute || !InData || Attribute->Info.storage != HAPI_STORAGETYPE_INT)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	const int32 TupleSize = Attribute->Info.tupleSize;
+	if (InStart < 0 || InLength < 0 || (InStart + InLength) * TupleSize > Attribute->IntValues.Num())
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	FMemory::Memcpy(Attribute->IntValues.GetData() + InStart * TupleSize, InData, InLength * TupleSize * sizeof(int32));
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniGeoWriter::SetAttributeStringData(
+	const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, const char* InName, const HAPI_AttributeInfo* InAttributeInfo,
+	const char** InData, const int32& InStart, const int32& InLength)
+{
+	if (!bBuffered)
+	{
+		return FHoudiniApi::SetAttributeStringData(
+			FHoudiniEngine::Get().GetSession(), InNodeId, InPartId, InName, InAttributeInfo, InData, InStart, InLength);
+	}
+
+	FBufferedAttribute* Attribute = InAttributeInfo ? FindAttribute(InName, InAttributeInfo->owner) : nullptr;
+	if (!Attribute || !InData || Attribute->Info.storage != HAPI_STORAGETYPE_STRING)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	const int32 TupleSize = Attribute->Info.tupleSize;
+	if (InStart < 0 || InLength < 0 || (InStart + InLength) * TupleSize > Attribute->IntValues.Num())
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	// Most string attributes hold the same few values (material, actor path..), only convert each pointer once
+	TMap<const char*, int32> IndexByPointer;
+	for (int32 Idx = 0; Idx < InLength * TupleSize; Idx++)
+	{
+		const char* Value = InData[Idx];
+		int32* StringIndex = IndexByPointer.Find(Value);
+		if (!StringIndex)
+		{
+			const FString StringValue = Value ? UTF8_TO_TCHAR(Value) : TEXT("");
+			int32 NewIndex = Attribute->StringIndices.FindRef(StringValue);
+			if (NewIndex == 0 && !StringValue.IsEmpty())
+			{
+				NewIndex = Attribute->Strings.Add(StringValue);
+				Attribute->StringIndices.Add(StringValue, NewIndex);
+			}
+			StringIndex = &IndexByPointer.Add(Value, NewIndex);
+		}
+
+		Attribute->IntValues[InStart * TupleSize + Idx] = *StringIndex;
+	}
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniGeoWriter::SetVertexList(
+	const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, const int32* InVertexList, const int32& InStart, const int32& InLength)
+{
+	if (!bBuffered)
+		return FHoudiniApi::SetVertexList(FHoudiniEngine::Get().GetSession(), InNodeId, InPartId, InVertexList, InStart, InLength);
+
+	if (!bHasPart || !InVertexList || InStart < 0 || InLength < 0 || InStart + InLength > PartInfo.vertexCount)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	VertexList.SetNumZeroed(PartInfo.vertexCount);
+	FMemory::Memcpy(VertexList.GetData() + InStart, InVertexList, InLength * sizeof(int32));
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniGeoWriter::SetFaceCounts(
+	const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, const int32* InFaceCounts, const int32& InStart, const int32& InLength)
+{
+	if (!bBuffered)
+		return FHoudiniApi::SetFaceCounts(FHoudiniEngine::Get().GetSession(), InNodeId, InPartId, InFaceCounts, InStart, InLength);
+
+	if (!bHasPart || !InFaceCounts || InStart < 0 || InLength < 0 || InStart + InLength > PartInfo.faceCount)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	FaceCounts.SetNumZeroed(PartInfo.faceCount);
+	FMemory::Memcpy(FaceCounts.GetData() + InStart, InFaceCounts, InLength * sizeof(int32));
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniGeoWriter::AddGroup(
+	const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, const HAPI_GroupType& InGroupType, const char* InGroupName)
+{
+	if (!bBuffered)
+		return FHoudiniApi::AddGroup(FHoudiniEngine::Get().GetSession(), InNodeId, InPartId, InGroupType, InGroupName);
+
+	if (!bHasPart || !InGroupName || (InGroupType != HAPI_GROUPTYPE_POINT && InGroupType != HAPI_GROUPTYPE_PRIM))
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	if (FindGroup(InGroupName, InGroupType))
+		return HAPI_RESULT_SUCCESS;
+
+	FBufferedGroup& Group = Groups.AddDefaulted_GetRef();
+	Group.Name = UTF8_TO_TCHAR(InGroupName);
+	Group.Type = InGroupType;
+	Group.Membership.SetNumZeroed(InGroupType == HAPI_GROUPTYPE_POINT ? PartInfo.pointCount : PartInfo.faceCount);
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniGeoWriter::SetGroupMembership(
+	const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, const HAPI_GroupType& InGroupType, const char* InGroupName,
+	const int32* InMembership, const int32& InStart, const int32& InLength)
+{
+	if (!bBuffered)
+	{
+		return FHoudiniApi::SetGroupMembership(
+			FHoudiniEngine::Get().GetSession(), InNodeId, InPartId, InGroupType, InGroupName, InMembership, InStart, InLength);
+	}
+
+	FBufferedGroup* Group = FindGroup(InGroupName, InGroupType);
+	if (!Group || !InMembership || InStart < 0 || InLength < 0 || InStart + InLength > Group->Membership.Num())
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	for (int32 Idx = 0; Idx < InLength; Idx++)
+		Group->Membership[InStart + Idx] = InMembership[Idx] != 0 ? 1 : 0;
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniGeoWriter::CommitGeo(const HAPI_NodeId& InNodeId)
+{
+	if (!bBuffered)
+		return FHoudiniApi::CommitGeo(FHoudiniEngine::Get().GetSession(), InNodeId);
+
+	if (!bHasPart)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	if (bDeferCommit)
+	{
+		bHasDeferredCommit = true;
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	return SendBufferedGeo(InNodeId, true);
+}
+
+HAPI_Result
+FHoudiniGeoWriter::SendBufferedGeo(const HAPI_NodeId& InNodeId, const bool& bAsSingleBlob)
+{
+	bSentAsBlob = false;
+	if (!bBuffered || !bHasPart)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	TArray<ANSICHAR> GeoBuffer;
+	if (bAsSingleBlob && EncodeGeo(GeoBuffer) && GeoBuffer.Num() < MAX_int32)
+	{
+		const HAPI_Result Result = FHoudiniApi::LoadGeoFromMemory(
+			FHoudiniEngine::Get().GetSession(), InNodeId, "geo", GeoBuffer.GetData(), GeoBuffer.Num());
+
+		if (Result == HAPI_RESULT_SUCCESS)
+		{
+			bSentAsBlob = true;
+			return Result;
+		}
+
+		HOUDINI_LOG_WARNING(
+			TEXT("Failed to load the input geometry from memory, sending it with individual calls instead: %s"),
+			*FHoudiniEngineUtils::GetErrorDescription());
+	}
+
+	return SendBufferedCalls(InNodeId);
+}
+
+HAPI_Result
+FHoudiniGeoWriter::SendBufferedCalls(const HAPI_NodeId& InNodeId)
+{
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+
+	HAPI_Result Result = FHoudiniApi::SetPartInfo(Session, InNodeId, 0, &PartInfo);
+	if (Result != HAPI_RESULT_SUCCESS)
+		return Result;
+
+	if (VertexList.Num() > 0)
+	{
+		Result = FHoudiniApi::SetVertexList(Session, InNodeId, 0, VertexList.GetData(), 0, VertexList.Num());
+		if (Result != HAPI_RESULT_SUCCESS)
+			return Result;
+	}
+
+	if (FaceCounts.Num() > 0)
+	{
+		Result = FHoudiniApi::SetFaceCounts(Session, InNodeId, 0, FaceCounts.GetData(), 0, FaceCounts.Num());
+		if (Result != HAPI_RESULT_SUCCESS)
+			return Result;
+	}
+
+	for (const FBufferedAttribute& Attribute : Attributes)
+	{
+		std::string Name = TCHAR_TO_UTF8(*Attribute.Name);
+		Result = FHoudiniApi::AddAttribute(Session, InNodeId, 0, Name.c_str(), &Attribute.Info);
+		if (Result != HAPI_RESULT_SUCCESS)
+			return Result;
+
+		if (Attribute.Info.storage == HAPI_STORAGETYPE_FLOAT)
+		{
+			Result = FHoudiniApi::SetAttributeFloatData(
+				Session, InNodeId, 0, Name.c_str(), &Attribute.Info, Attribute.FloatValues.GetData(), 0, Attribute.Info.count);
+		}
+		else if (Attribute.Info.storage == HAPI_STORAGETYPE_INT)
+		{
+			Result = FHoudiniApi::SetAttributeIntData(
+				Session, InNodeId, 0, Name.c_str(), &Attribute.Info, Attribute.IntValues.GetData(), 0, Attribute.Info.count);
+		}
+		else
+		{
+			TArray<std::string> Utf8Strings;
+			for (const FString& String : Attribute.Strings)
+				Utf8Strings.Add(TCHAR_TO_UTF8(*String));
+
+			TArray<const char*> StringValues;
+			StringValues.SetNumUninitialized(Attribute.IntValues.Num());
+			for (int32 Idx = 0; Idx < Attribute.IntValues.Num(); Idx++)
+				StringValues[Idx] = Utf8Strings[Attribute.IntValues[Idx]].c_str();
+
+			Result = FHoudiniApi::SetAttributeStringData(
+				Session, InNodeId, 0, Name.c_str(), &Attribute.Info, StringValues.GetData(), 0, Attribute.Info.count);
+		}
+
+		if (Result != HAPI_RESULT_SUCCESS)
+			return Result;
+	}
+
+	for (const FBufferedGroup& Group : Groups)
+	{
+		std::string Name = TCHAR_TO_UTF8(*Group.Name);
+		Result = FHoudiniApi::AddGroup(Session, InNodeId, 0, Group.Type, Name.c_str());
+		if (Result != HAPI_RESULT_SUCCESS)
+			return Result;
+
+		TArray<int32> Membership;
+		Membership.SetNumUninitialized(Group.Membership.Num());
+		for (int32 Idx = 0; Idx < Group.Membership.Num(); Idx++)
+			Membership[Idx] = Group.Membership[Idx];
+
+		Result = FHoudiniApi::SetGroupMembership(
+			Session, InNodeId, 0, Group.Type, Name.c_str(), Membership.GetData(), 0, Membership.Num());
+		if (Result != HAPI_RESULT_SUCCESS)
+			return Result;
+	}
+
+	return FHoudiniApi::CommitGeo(Session, InNodeId);
+}
+
+// Writes an attribute in the format expected by the "attributes" section of a JSON geometry
+static void
+EncodeGeoAttribute(FHoudiniGeoJsonStream& Json, const FString& InName, const HAPI_AttributeInfo& InInfo,
+	const TArray<float>& InFloatValues, const TArray<int32>& InIntValues, const TArray<FString>& InStrings)
+{
+	const bool bIsString = InInfo.storage == HAPI_STORAGETYPE_STRING;
+	const bool bIsFloat = InInfo.storage == HAPI_STORAGETYPE_FLOAT;
+	const int32 TupleSize = InInfo.tupleSize;
+
+	Json.Raw("[[");
+	Json.Key("scope"); Json.Raw("\"public\",");
+	Json.Key("type"); Json.Raw(bIsString ? "\"string\"," : "\"numeric\",");
+	Json.Key("name"); Json.String(InName); Json.Raw(",");
+	Json.Key("options"); Json.Raw("{}],[");
+	Json.Key("size"); Json.Int(TupleSize); Json.Raw(",");
+
+	if (bIsString)
+	{
+		Json.Key("storage"); Json.Raw("\"int32\",");
+		Json.Key("strings"); Json.Raw("[");
+		for (int32 Idx = 0; Idx < InStrings.Num(); Idx++)
+		{
+			Json.Separator(Idx);
+			Json.String(InStrings[Idx]);
+		}
+		Json.Raw("],");
+		Json.Key("indices");
+	}
+	else
+	{
+		Json.Key("storage"); Json.Raw(bIsFloat ? "\"fpreal32\"," : "\"int32\",");
+		Json.Key("defaults"); Json.Raw("[\"size\",1,\"storage\",\"fpreal64\",\"values\",[0]],");
+		Json.Key("values");
+	}
+
+	Json.Raw("[");
+	Json.Key("size"); Json.Int(TupleSize); Json.Raw(",");
+	Json.Key("storage"); Json.Raw(bIsFloat ? "\"fpreal32\"," : "\"int32\",");
+
+	// Tuples are written per element, single values as one array
+	const int32 Count = InInfo.count;
+	if (TupleSize > 1)
+		Json.Key("tuples");
+	else
+		Json.Key("arrays");
+
+	Json.Raw(TupleSize > 1 ? "[" : "[[");
+	for (int32 Idx = 0; Idx < Count; Idx++)
+	{
+		Json.Separator(Idx);
+		if (TupleSize > 1)
+			Json.Raw("[");
+
+		for (int32 Component = 0; Component < TupleSize; Component++)
+		{
+			Json.Separator(Component);
+			if (bIsFloat)
+				Json.Float(InFloatValues[Idx * TupleSize + Component]);
+			else
+				Json.Int(InIntValues[Idx * TupleSize + Component]);
+		}
+
+		if (TupleSize > 1)
+			Json.Raw("]");
+	}
+	Json.Raw(TupleSize > 1 ? "]]]]" : "]]]]]");
+}
+
+bool
+FHoudiniGeoWriter::EncodeGeo(TArray<ANSICHAR>& OutBuffer) const
+{
+	if (!bHasPart || PartInfo.type != HAPI_PARTTYPE_MESH)
+		return false;
+
+	if (VertexList.Num() != PartInfo.vertexCount || FaceCounts.Num() != PartInfo.faceCount)
+		return false;
+
+	// Estimate ~12 characters per value to avoid most reallocations
+	int64 NumValues = VertexList.Num();
+	for (const FBufferedAttribute& Attribute : Attributes)
+		NumValues += (int64)Attribute.Info.count * Attribute.Info.tupleSize;
+
+	OutBuffer.Empty(FMath::Min<int64>(NumValues * 12 + 4096, MAX_int32));
+
+	FHoudiniGeoJsonStream Json(OutBuffer);
+	Json.Raw("[");
+	Json.Key("pointcount"); Json.Int(PartInfo.pointCount); Json.Raw(",");
+	Json.Key("vertexcount"); Json.Int(PartInfo.vertexCount); Json.Raw(",");
+	Json.Key("primitivecount"); Json.Int(PartInfo.faceCount); Json.Raw(",");
+
+	// Topology: the point referenced by each vertex
+	Json.Key("topology"); Json.Raw("[");
+	Json.Key("pointref"); Json.Raw("[");
+	Json.Key("indices"); Json.Raw("[");
+	for (int32 Idx = 0; Idx < VertexList.Num(); Idx++)
+	{
+		Json.Separator(Idx);
+		Json.Int(VertexList[Idx]);
+	}
+	Json.Raw("]]],");
+
+	// Attributes, by owner
+	static const HAPI_AttributeOwner Owners[4] = { HAPI_ATTROWNER_VERTEX, HAPI_ATTROWNER_POINT, HAPI_ATTROWNER_PRIM, HAPI_ATTROWNER_DETAIL };
+	static const ANSICHAR* OwnerKeys[4] = { "vertexattributes", "pointattributes", "primitiveattributes", "globalattributes" };
+
+	Json.Key("attributes"); Json.Raw("[");
+	for (int32 OwnerIdx = 0; OwnerIdx < 4; OwnerIdx++)
+	{
+		Json.Separator(OwnerIdx);
+		Json.Key(OwnerKeys[OwnerIdx]);
+		Json.Raw("[");
+
+		int32 NumWritten = 0;
+		for (const FBufferedAttribute& Attribute : Attributes)
+		{
+			if (Attribute.Info.owner != Owners[OwnerIdx])
+				continue;
+
+			Json.Separator(NumWritten++);
+			EncodeGeoAttribute(Json, Attribute.Name, Attribute.Info, Attribute.FloatValues, Attribute.IntValues, Attribute.Strings);
+		}
+		Json.Raw("]");
+	}
+	Json.Raw("],");
+
+	// Primitives: a single polygon run, with its vertex counts run-length encoded
+	Json.Key("primitives"); Json.Raw("[[[");
+	Json.Key("type"); Json.Raw("\"Polygon_run\"],[");
+	Json.Key("startvertex"); Json.Raw("0,");
+	Json.Key("nprimitives"); Json.Int(PartInfo.faceCount); Json.Raw(",");
+	Json.Key("nvertices_rle"); Json.Raw("[");
+	int32 NumRuns = 0;
+	for (int32 Idx = 0; Idx < FaceCounts.Num();)
+	{
+		int32 RunEnd = Idx + 1;
+		while (RunEnd < FaceCounts.Num() && FaceCounts[RunEnd] == FaceCounts[Idx])
+			RunEnd++;
+
+		Json.Separator(NumRuns++);
+		Json.Int(FaceCounts[Idx]);
+		Json.Raw(",");
+		Json.Int(RunEnd - Idx);
+		Idx = RunEnd;
+	}
+	Json.Raw("]]]]");
+
+	// Groups
+	for (const HAPI_GroupType GroupType : { HAPI_GROUPTYPE_POINT, HAPI_GROUPTYPE_PRIM })
+	{
+		Json.Raw(",");
+		Json.Key(GroupType == HAPI_GROUPTYPE_POINT ? "pointgroups" : "primitivegroups");
+		Json.Raw("[");
+
+		int32 NumWritten = 0;
+		for (const FBufferedGroup& Group : Groups)
+		{
+			if (Group.Type != GroupType)
+				continue;
+
+			Json.Separator(NumWritten++);
+			Json.Raw("[[");
+			Json.Key("name"); Json.String(Group.Name); Json.Raw("],[");
+			Json.Key("selection"); Json.Raw("[");
+			Json.Key("unordered"); Json.Raw("[");
+			Json.Key("i8"); Json.Raw("[");
+			for (int32 Idx = 0; Idx < Group.Membership.Num(); Idx++)
+			{
+				Json.Separator(Idx);
+				Json.Int(Group.Membership[Idx]);
+			}
+			Json.Raw("]]]]]");
+		}
+		Json.Raw("]");
+	}
+
+	Json.Raw("]");
+
+	return true;
+}
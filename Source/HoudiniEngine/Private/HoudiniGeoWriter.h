@@ -0,0 +1,140 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+
+#include "CoreMinimal.h"
+
+// Writes input geometry to an editable node.
+// Its functions mirror the HAPI geometry setters: when not buffered, each call is forwarded to HAPI.
+// When buffered, the calls are recorded and CommitGeo encodes the whole part in Houdini's JSON geometry
+// format, and sends it in a single LoadGeoFromMemory call, instead of one round trip per call.
+// Only a single part per writer is supported in buffered mode.
+// Deferred writers also ignore CommitGeo: the geometry can be prepared on any thread without
+// a node, and sent later on the game thread with SendBufferedGeo.
+struct HOUDINIENGINE_API FHoudiniGeoWriter
+{
+	public:
+
+		FHoudiniGeoWriter(const bool& bInBuffered, const bool& bInDeferCommit = false);
+
+		// Indicates if mesh inputs should be sent as a single geometry blob in the current session
+		static bool ShouldBufferMeshInputs();
+
+		bool IsBuffered() const { return bBuffered; }
+
+		// Indicates if CommitGeo has been called on a deferred writer
+		bool HasDeferredCommit() const { return bHasDeferredCommit; }
+
+		// Indicates if the last SendBufferedGeo loaded the part with a single LoadGeoFromMemory call
+		bool WasSentAsBlob() const { return bSentAsBlob; }
+
+		HAPI_Result SetPartInfo(const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, const HAPI_PartInfo* InPartInfo);
+
+		HAPI_Result GetPartInfo(const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, HAPI_PartInfo* OutPartInfo);
+
+		HAPI_Result AddAttribute(
+			const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, const char* InName, const HAPI_AttributeInfo* InAttributeInfo);
+
+		HAPI_Result SetAttributeFloatData(
+			const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, const char* InName, const HAPI_AttributeInfo* InAttributeInfo,
+			const float* InData, const int32& InStart, const int32& InLength);
+
+		HAPI_Result SetAttributeIntData(
+			const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, const char* InName, const HAPI_AttributeInfo* InAttributeInfo,
+			const int32* InData, const int32& InStart, const int32& InLength);
+
+		HAPI_Result SetAttributeStringData(
+			const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, const char* InName, const HAPI_AttributeInfo* InAttributeInfo,
+			const char** InData, const int32& InStart, const int32& InLength);
+
+		HAPI_Result SetVertexList(
+			const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, const int32* InVertexList, const int32& InStart, const int32& InLength);
+
+		HAPI_Result SetFaceCounts(
+			const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, const int32* InFaceCounts, const int32& InStart, const int32& InLength);
+
+		HAPI_Result AddGroup(
+			const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, const HAPI_GroupType& InGroupType, const char* InGroupName);
+
+		HAPI_Result SetGroupMembership(
+			const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, const HAPI_GroupType& InGroupType, const char* InGroupName,
+			const int32* InMembership, const int32& InStart, const int32& InLength);
+
+		// Sends the geometry to Houdini
+		HAPI_Result CommitGeo(const HAPI_NodeId& InNodeId);
+
+		// Sends the buffered part to a node, either as a single geometry blob or with individual HAPI calls
+		HAPI_Result SendBufferedGeo(const HAPI_NodeId& InNodeId, const bool& bAsSingleBlob);
+
+		// Encodes the buffered part in Houdini's JSON geometry format
+		bool EncodeGeo(TArray<ANSICHAR>& OutBuffer) const;
+
+	private:
+
+		struct FBufferedAttribute
+		{
+			FString Name;
+			HAPI_AttributeInfo Info;
+
+			TArray<float> FloatValues;
+			TArray<int32> IntValues;
+
+			// String attributes are stored as indices in the attribute's string table
+			TArray<FString> Strings;
+			TMap<FString, int32> StringIndices;
+		};
+
+		struct FBufferedGroup
+		{
+			FString Name;
+			HAPI_GroupType Type;
+			TArray<int8> Membership;
+		};
+
+		FBufferedAttribute* FindAttribute(const char* InName, const HAPI_AttributeOwner& InOwner);
+
+		FBufferedGroup* FindGroup(const char* InName, const HAPI_GroupType& InType);
+
+		// Sends the buffered part with individual HAPI calls
+		HAPI_Result SendBufferedCalls(const HAPI_NodeId& InNodeId);
+
+		bool bBuffered;
+		bool bDeferCommit;
+		bool bHasDeferredCommit;
+		bool bSentAsBlob;
+
+		bool bHasPart;
+		HAPI_PartInfo PartInfo;
+
+		TArray<int32> VertexList;
+		TArray<int32> FaceCounts;
+		TArray<FBufferedAttribute> Attributes;
+		TArray<FBufferedGroup> Groups;
+};
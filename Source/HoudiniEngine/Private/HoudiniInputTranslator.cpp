@@ -36,6 +36,8 @@
 #include "HoudiniAssetComponent.h"
 #include "HoudiniSplineComponent.h"
 #include "HoudiniInputObject.h"
+#include "HoudiniEngineRuntime.h"
+#include "HoudiniRuntimeSettings.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniSplineTranslator.h"
@@ -47,16 +49,21 @@
 #include "UnrealInstanceTranslator.h"
 #include "UnrealLandscapeTranslator.h"
 #include "UnrealFoliageTypeTranslator.h"
+#include "UnrealDataTableTranslator.h"
 
 #include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshSocket.h"
 #include "Engine/SkeletalMesh.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Components/SplineComponent.h"
 #include "Landscape.h"
 #include "Engine/Brush.h"
+#include "Engine/Polys.h"
 #include "Engine/DataTable.h"
+#include "Model.h"
 #include "Camera/CameraComponent.h"
+#include "PhysicsEngine/BodySetup.h"
 #include "FoliageType_InstancedStaticMesh.h"
 
 #include "Engine/SimpleConstructionScript.h"
@@ -71,9 +78,23 @@
 #include "HCsgUtils.h"
 
 #include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+static TAutoConsoleVariable<float> CVarHoudiniEngineSplineInputTolerance(
+	TEXT("HoudiniEngine.SplineInputTolerance"),
+	1.0f,
+	TEXT("Maximum distance (in cm) between a spline and the curve sent to Houdini when a world input merges its splines.\n")
+	TEXT("Straight parts of the splines only keep their control points, curved parts get more points.\n"));
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineDataTableInputTypedColumns(
+	TEXT("HoudiniEngine.DataTableInputTypedColumns"),
+	1,
+	TEXT("Controls how data table inputs send their columns.\n")
+	TEXT("0: Every column is sent as a string attribute.\n")
+	TEXT("1: Numeric, bool, vector and color columns are sent as int/float attributes.\n"));
+
 #if WITH_EDITOR
 // Allows checking of objects currently being dragged around
 struct FHoudiniMoveTracker
@@ -90,8 +111,301 @@ struct FHoudiniMoveTracker
 
 	bool IsObjectMoving;
 };
+
+static TAutoConsoleVariable<float> CVarHoudiniEngineWorldInputPollInterval(
+	TEXT("HoudiniEngine.WorldInputPollInterval"),
+	0.0f,
+	TEXT("Fallback polling of the world inputs' actors for changes.\n")
+	TEXT("0: Disabled, world inputs are only checked after the editor notified a change to one of their actors, components, meshes or brushes\n")
+	TEXT(">0: World inputs are also checked every N seconds\n"));
+
+// Maps the actors, components, meshes and brushes referenced by the inputs to the inputs that reference them,
+// so the editor's change notifications (property changed, object modified, actor moved/added/deleted) only
+// mark these inputs dirty. World inputs are only polled for changes once dirty, the mesh assets of the
+// other input types mark their input objects as changed directly.
+struct FHoudiniInputChangeTracker
+{
+	FHoudiniInputChangeTracker()
+	{
+		OnObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FHoudiniInputChangeTracker::OnObjectModified);
+		OnObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FHoudiniInputChangeTracker::OnObjectPropertyChanged);
+
+		if (GEngine)
+		{
+			OnActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FHoudiniInputChangeTracker::OnActorChanged);
+			OnLevelActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FHoudiniInputChangeTracker::OnLevelActorAdded);
+			OnLevelActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FHoudiniInputChangeTracker::OnActorChanged);
+			OnLevelActorListChangedHandle = GEngine->OnLevelActorListChanged().AddRaw(this, &FHoudiniInputChangeTracker::OnLevelActorListChanged);
+		}
+	}
+
+	~FHoudiniInputChangeTracker()
+	{
+		FCoreUObjectDelegates::OnObjectModified.Remove(OnObjectModifiedHandle);
+		FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(OnObjectPropertyChangedHandle);
+
+		if (GEngine)
+		{
+			GEngine->OnActorMoved().Remove(OnActorMovedHandle);
+			GEngine->OnLevelActorAdded().Remove(OnLevelActorAddedHandle);
+			GEngine->OnLevelActorDeleted().Remove(OnLevelActorDeletedHandle);
+			GEngine->OnLevelActorListChanged().Remove(OnLevelActorListChangedHandle);
+		}
+	}
+
+	static FHoudiniInputChangeTracker& Get()
+	{
+		if (!Instance.IsValid())
+			Instance = MakeUnique<FHoudiniInputChangeTracker>();
+
+		return *Instance;
+	}
+
+	// Releases the tracker and its event bindings
+	static void Shutdown() { Instance.Reset(); }
+
+	void OnObjectModified(UObject* InObject) { OnObjectChanged(InObject, false); }
+	void OnObjectPropertyChanged(UObject* InObject, FPropertyChangedEvent&) { OnObjectChanged(InObject, true); }
+	void OnActorChanged(AActor* InActor) { OnObjectChanged(InActor, false); }
+	// A new actor can only change the selection of the bound selectors
+	void OnLevelActorAdded(AActor*) { MarkBoundSelectorsDirty(); }
+	void OnLevelActorListChanged() { MarkBoundSelectorsDirty(); }
+
+	void OnObjectChanged(UObject* InObject, const bool& bPropertyChanged)
+	{
+		if (!InObject || WatchedInputs.Num() <= 0)
+			return;
+
+		// Components and brush models notify the inputs watching their actor
+		UObject* OwnerActor = nullptr;
+		if (UActorComponent* Component = Cast<UActorComponent>(InObject))
+			OwnerActor = Component->GetOwner();
+		else if (InObject->IsA<UModel>() || InObject->IsA<UPolys>())
+			OwnerActor = InObject->GetTypedOuter<ABrush>();
+
+		MarkWatchersDirty(InObject, bPropertyChanged);
+		if (OwnerActor)
+			MarkWatchersDirty(OwnerActor, bPropertyChanged);
+
+		// Brush inputs also depend on the subtractive brushes intersecting them,
+		// and moving any actor can change the selection of the bound selectors
+		AActor* ChangedActor = Cast<AActor>(OwnerActor ? OwnerActor : InObject);
+		if (ChangedActor)
+		{
+			const bool bIsBrush = ChangedActor->IsA<ABrush>();
+			for (auto& Watched : WatchedInputs)
+			{
+				if ((bIsBrush && Watched.Value.bHasBrushes) || IsAutoUpdatingBoundSelector(Watched.Key.Get()))
+					Watched.Value.bDirty = true;
+			}
+		}
+	}
+
+	void MarkWatchersDirty(UObject* InObject, const bool& bPropertyChanged)
+	{
+		TArray<TWeakObjectPtr<UHoudiniInput>>* Watchers = ObjectWatchers.Find(InObject);
+		if (!Watchers)
+			return;
+
+		for (const TWeakObjectPtr<UHoudiniInput>& Watcher : *Watchers)
+		{
+			UHoudiniInput* Input = Watcher.Get();
+			if (!IsValid(Input))
+				continue;
+
+			if (Input->GetInputType() == EHoudiniInputType::World)
+			{
+				FWatchedInput* Watched = WatchedInputs.Find(Watcher);
+				if (Watched)
+					Watched->bDirty = true;
+				continue;
+			}
+
+			// The other input types only watch mesh assets, only send them again once their edit is complete
+			if (!bPropertyChanged)
+				continue;
+
+			TArray<UHoudiniInputObject*>* InputObjects = Input->GetHoudiniInputObjectArray(Input->GetInputType());
+			if (!InputObjects)
+				continue;
+
+			for (UHoudiniInputObject* CurObject : *InputObjects)
+			{
+				if (!IsValid(CurObject) || CurObject->GetObject() != InObject)
+					continue;
+
+				CurObject->MarkChanged(true);
+				Input->MarkChanged(true);
+			}
+		}
+	}
+
+	void MarkBoundSelectorsDirty()
+	{
+		for (auto& Watched : WatchedInputs)
+		{
+			if (IsAutoUpdatingBoundSelector(Watched.Key.Get()))
+				Watched.Value.bDirty = true;
+		}
+	}
+
+	static bool IsAutoUpdatingBoundSelector(UHoudiniInput* InInput)
+	{
+		return IsValid(InInput)
+			&& InInput->GetInputType() == EHoudiniInputType::World
+			&& InInput->IsWorldInputBoundSelector()
+			&& InInput->GetWorldInputBoundSelectorAutoUpdates();
+	}
+
+	// Returns true if the world input needs to poll its actors for changes
+	bool NeedsUpdate(UHoudiniInput* InInput)
+	{
+		const FWatchedInput* Watched = WatchedInputs.Find(InInput);
+		if (!Watched || Watched->bDirty)
+			return true;
+
+		const float PollInterval = CVarHoudiniEngineWorldInputPollInterval.GetValueOnGameThread();
+		return PollInterval > 0.0f && (FPlatformTime::Seconds() - Watched->WatchTime) >= PollInterval;
+	}
+
+	// Updates the objects watched for this input, and marks it as up to date
+	void WatchInput(UHoudiniInput* InInput)
+	{
+		if (!IsValid(InInput))
+			return;
+
+		const TWeakObjectPtr<UHoudiniInput> InputPtr(InInput);
+		if (!WatchedInputs.Contains(InputPtr))
+		{
+			// Stop watching for the inputs that have been destroyed before adding a new one
+			TArray<TWeakObjectPtr<UHoudiniInput>> StaleInputs;
+			for (auto& Watched : WatchedInputs)
+			{
+				if (!Watched.Key.IsValid())
+					StaleInputs.Add(Watched.Key);
+			}
+
+			for (const TWeakObjectPtr<UHoudiniInput>& StaleInput : StaleInputs)
+				UnwatchInput(StaleInput);
+		}
+		else
+		{
+			UnwatchInput(InputPtr);
+		}
+
+		FWatchedInput& Watched = WatchedInputs.Add(InputPtr);
+		Watched.WatchTime = FPlatformTime::Seconds();
+
+		TArray<UObject*> Objects;
+		GetWatchedObjects(InInput, Objects, Watched.bHasBrushes);
+		for (UObject* CurObject : Objects)
+		{
+			if (!CurObject)
+				continue;
+
+			Watched.Objects.AddUnique(CurObject);
+			ObjectWatchers.FindOrAdd(CurObject).AddUnique(InputPtr);
+		}
+	}
+
+	void UnwatchInput(const TWeakObjectPtr<UHoudiniInput>& InInput)
+	{
+		FWatchedInput Watched;
+		if (!WatchedInputs.RemoveAndCopyValue(InInput, Watched))
+			return;
+
+		for (const TWeakObjectPtr<UObject>& CurObject : Watched.Objects)
+		{
+			TArray<TWeakObjectPtr<UHoudiniInput>>* Watchers = ObjectWatchers.Find(CurObject);
+			if (!Watchers)
+				continue;
+
+			Watchers->Remove(InInput);
+			if (Watchers->Num() <= 0)
+				ObjectWatchers.Remove(CurObject);
+		}
+	}
+
+	// The objects whose changes can change this input
+	static void GetWatchedObjects(UHoudiniInput* InInput, TArray<UObject*>& OutObjects, bool& bOutHasBrushes)
+	{
+		bOutHasBrushes = false;
+
+		const EHoudiniInputType InputType = InInput->GetInputType();
+		TArray<UHoudiniInputObject*>* InputObjects = InInput->GetHoudiniInputObjectArray(InputType);
+		if (!InputObjects)
+			return;
+
+		for (UHoudiniInputObject* CurObject : *InputObjects)
+		{
+			if (!IsValid(CurObject))
+				continue;
+
+			// Only the mesh assets of the other input types are watched,
+			// their other objects (curves, HDAs) already mark their input as changed
+			if (InputType != EHoudiniInputType::World)
+			{
+				if (CurObject->Type == EHoudiniInputObjectType::StaticMesh
+					|| CurObject->Type == EHoudiniInputObjectType::SkeletalMesh)
+				{
+					OutObjects.Add(CurObject->GetObject());
+				}
+				continue;
+			}
+
+			UHoudiniInputActor* ActorObject = Cast<UHoudiniInputActor>(CurObject);
+			if (!ActorObject)
+				continue;
+
+			OutObjects.Add(ActorObject->GetActor());
+			bOutHasBrushes |= ActorObject->IsA<UHoudiniInputBrush>();
+
+			for (UHoudiniInputSceneComponent* CurComponent : ActorObject->GetActorComponents())
+			{
+				if (!IsValid(CurComponent))
+					continue;
+
+				OutObjects.Add(CurComponent->GetObject());
+
+				UHoudiniInputMeshComponent* MeshComponent = Cast<UHoudiniInputMeshComponent>(CurComponent);
+				if (MeshComponent)
+					OutObjects.Add(MeshComponent->GetStaticMesh());
+			}
+		}
+	}
+
+	struct FWatchedInput
+	{
+		TArray<TWeakObjectPtr<UObject>> Objects;
+		double WatchTime = 0.0;
+		bool bDirty = false;
+		bool bHasBrushes = false;
+	};
+
+	TMap<TWeakObjectPtr<UHoudiniInput>, FWatchedInput> WatchedInputs;
+	TMap<TWeakObjectPtr<UObject>, TArray<TWeakObjectPtr<UHoudiniInput>>> ObjectWatchers;
+
+	FDelegateHandle OnObjectModifiedHandle;
+	FDelegateHandle OnObjectPropertyChangedHandle;
+	FDelegateHandle OnActorMovedHandle;
+	FDelegateHandle OnLevelActorAddedHandle;
+	FDelegateHandle OnLevelActorDeletedHandle;
+	FDelegateHandle OnLevelActorListChangedHandle;
+
+	static TUniquePtr<FHoudiniInputChangeTracker> Instance;
+};
+
+TUniquePtr<FHoudiniInputChangeTracker> FHoudiniInputChangeTracker::Instance;
 #endif
 
+void
+FHoudiniInputTranslator::ShutdownInputChangeTracker()
+{
+#if WITH_EDITOR
+	FHoudiniInputChangeTracker::Shutdown();
+#endif
+}
+
 // 
 bool
 FHoudiniInputTranslator::UpdateInputs(UHoudiniAssetComponent* HAC)
@@ -395,6 +709,7 @@ FHoudiniInputTranslator::DestroyInputNodes(UHoudiniInput* InputToDestroy, const
 						// No need to delete the nodes created for an asset component manually here,
 						// As they will be deleted when we clean up the CreateNodeIds array
 						CurActorComponent->InputNodeId = -1;
+						CurActorComponent->ReleaseSharedInputNode();
 					}
 				}
 			}
@@ -420,6 +735,9 @@ FHoudiniInputTranslator::DestroyInputNodes(UHoudiniInput* InputToDestroy, const
 					FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), ParentNodeId);
 			}
 
+			// The object's node is gone, release the shared input node it referenced
+			CurInputObject->ReleaseSharedInputNode();
+
 			// Also directly invalidate HoudiniSplineComponent's node IDs.
 			UHoudiniInputHoudiniSplineComponent* HoudiniSplineInputObject = Cast<UHoudiniInputHoudiniSplineComponent>(CurInputObject);
 			if (IsValid(HoudiniSplineInputObject) && !IsGarbageCollecting())
@@ -720,6 +1038,11 @@ FHoudiniInputTranslator::UploadChangedInputs(UHoudiniAssetComponent * HAC)
 			CurrentInput->MarkAllInputObjectsChanged(false);
 		}
 
+#if WITH_EDITOR
+		// Watch the objects the input now references for changes
+		FHoudiniInputChangeTracker::Get().WatchInput(CurrentInput);
+#endif
+
 		if (CurrentInput->HasInputTypeChanged())
 			CurrentInput->SetPreviousInputType(EHoudiniInputType::Invalid);
 
@@ -912,6 +1235,58 @@ FHoudiniInputTranslator::UpdateTransformOffset(UHoudiniInput* InInput)
 	return true;
 }
 
+static bool UploadWorldInputSharedMeshInstances(UHoudiniInput* InInput, TArray<int32>& OutCreatedNodeIds);
+
+static bool UploadWorldInputMergedSplines(UHoudiniInput* InInput, TArray<int32>& OutCreatedNodeIds);
+
+// Adds the static mesh of an input object that is going to be uploaded to the list of meshes to prepare
+static void
+AddStaticMeshToPrepare(
+	UHoudiniInput* InInput, UHoudiniInputObject* InObject, TArray<TPair<UStaticMesh*, UStaticMeshComponent*>>& OutMeshes)
+{
+	if (!InObject || InObject->IsPendingKill() || InInput->GetImportAsReference())
+		return;
+
+	if (InObject->Type == EHoudiniInputObjectType::StaticMeshComponent)
+	{
+		if (InInput->GetInstancedWorldInputComponents().Contains(InObject))
+			return;
+
+		UHoudiniInputMeshComponent* InputSMC = Cast<UHoudiniInputMeshComponent>(InObject);
+		UStaticMeshComponent* SMC = InputSMC ? InputSMC->GetStaticMeshComponent() : nullptr;
+		if (SMC && !SMC->IsPendingKill() && InputSMC->GetStaticMesh())
+			OutMeshes.Add(TPair<UStaticMesh*, UStaticMeshComponent*>(InputSMC->GetStaticMesh(), SMC));
+	}
+	else if (InObject->Type == EHoudiniInputObjectType::StaticMesh)
+	{
+		// Shared input nodes may not need to be converted at all
+		const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+		if (HoudiniRuntimeSettings && HoudiniRuntimeSettings->bMarshallingShareStaticMeshInputNodes)
+			return;
+
+		UHoudiniInputStaticMesh* InputSM = Cast<UHoudiniInputStaticMesh>(InObject);
+		if (InputSM && !InputSM->bIsBlueprint() && InputSM->GetStaticMesh())
+			OutMeshes.Add(TPair<UStaticMesh*, UStaticMeshComponent*>(InputSM->GetStaticMesh(), nullptr));
+	}
+	else if (InObject->Type == EHoudiniInputObjectType::Actor)
+	{
+		UHoudiniInputActor* InputActor = Cast<UHoudiniInputActor>(InObject);
+		if (!InputActor)
+			return;
+
+		// Changed actors upload all their components
+		const bool bActorNeedsUpload = InObject->HasChanged();
+		for (UHoudiniInputSceneComponent* CurrentComp : InputActor->GetActorComponents())
+		{
+			if (!CurrentComp || CurrentComp->IsPendingKill())
+				continue;
+
+			if (bActorNeedsUpload || CurrentComp->HasChanged() || CurrentComp->InputObjectNodeId < 0)
+				AddStaticMeshToPrepare(InInput, CurrentComp, OutMeshes);
+		}
+	}
+}
+
 bool
 FHoudiniInputTranslator::UploadInputData(UHoudiniInput* InInput)
 {
@@ -923,17 +1298,46 @@ FHoudiniInputTranslator::UploadInputData(UHoudiniInput* InInput)
 	if (!ensure(InputObjectsArray))
 		return false;
 
-	// Iterate on all the input objects and see if they need to be uploaded
+	// Send the static meshes shared by the world input's actors first,
+	// the components sent by the instancers are skipped afterwards
 	bool bSuccess = true;
 	TArray<int32> CreatedNodeIds;
+	if (!UploadWorldInputSharedMeshInstances(InInput, CreatedNodeIds))
+		bSuccess = false;
+
+	// Same for the merged splines
+	if (!UploadWorldInputMergedSplines(InInput, CreatedNodeIds))
+		bSuccess = false;
+
+	// Convert the meshes of the objects that need to be uploaded in parallel first,
+	// so the loop below only has to make the HAPI calls
+	TArray<TPair<UStaticMesh*, UStaticMeshComponent*>> MeshesToPrepare;
+	for (UHoudiniInputObject* CurrentInputObject : *InputObjectsArray)
+	{
+		if (!CurrentInputObject || CurrentInputObject->IsPendingKill())
+			continue;
+
+		if (CurrentInputObject->Type == EHoudiniInputObjectType::Actor
+			|| CurrentInputObject->HasChanged() || CurrentInputObject->InputObjectNodeId < 0)
+			AddStaticMeshToPrepare(InInput, CurrentInputObject, MeshesToPrepare);
+	}
+
+	if (MeshesToPrepare.Num() > 1)
+		FUnrealMeshTranslator::PrepareStaticMeshInputGeos(MeshesToPrepare, InInput->GetExportLODs());
+
+	// Iterate on all the input objects and see if they need to be uploaded
+	const double UploadStartTime = FPlatformTime::Seconds();
+	int32 NumUploadedObjects = 0;
 	for (int32 ObjIdx = 0; ObjIdx < InputObjectsArray->Num(); ObjIdx++)
 	{
 		UHoudiniInputObject* CurrentInputObject = (*InputObjectsArray)[ObjIdx];
 		if (!CurrentInputObject || CurrentInputObject->IsPendingKill())
 			continue;
 
+		// Actors don't have nodes of their own, their components are checked individually
 		int32& CurrentInputObjectNodeId = CurrentInputObject->InputObjectNodeId;
-		if (!CurrentInputObject->HasChanged() && CurrentInputObjectNodeId >= 0)
+		const bool bHasNodes = CurrentInputObjectNodeId >= 0 || CurrentInputObject->Type == EHoudiniInputObjectType::Actor;
+		if (!CurrentInputObject->HasChanged() && bHasNodes)
 		{
 			// If this object hasn't changed, no need to upload it
 			// but we need to keep its created input node
@@ -949,6 +1353,9 @@ FHoudiniInputTranslator::UploadInputData(UHoudiniInput* InInput)
 						if (!CurrentComp || CurrentComp->IsPendingKill())
 							continue;
 
+						if (InInput->GetInstancedWorldInputComponents().Contains(CurrentComp) || InInput->GetMergedWorldInputSplines().Contains(CurrentComp))
+							continue;
+
 						int32& CurrentCompNodeId = CurrentComp->InputObjectNodeId;
 						if (!CurrentComp->HasChanged() && CurrentCompNodeId >= 0)
 						{
@@ -960,6 +1367,7 @@ FHoudiniInputTranslator::UploadInputData(UHoudiniInput* InInput)
 							// Upload the component input object to Houdini	
 							if (!UploadHoudiniInputObject(InInput, CurrentComp, CreatedNodeIds))
 								bSuccess = false;
+							NumUploadedObjects++;
 						}
 					}
 				}
@@ -975,9 +1383,21 @@ FHoudiniInputTranslator::UploadInputData(UHoudiniInput* InInput)
 			// Upload the current input object to Houdini
 			if (!UploadHoudiniInputObject(InInput, CurrentInputObject, CreatedNodeIds))
 				bSuccess = false;
+			NumUploadedObjects++;
 		}
 	}
 
+	if (NumUploadedObjects > 0)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("Uploading %d input object(s) of %s completed in %.4f seconds"),
+			NumUploadedObjects, *InInput->GetName(), FPlatformTime::Seconds() - UploadStartTime);
+	}
+
+	// Discard the prepared geometry that wasn't used
+	FUnrealMeshTranslator::ResetPreparedStaticMeshInputGeos();
+	InInput->GetInstancedWorldInputComponents().Empty();
+	InInput->GetMergedWorldInputSplines().Empty();
+
 	// If we haven't created any input, invalidate our input node id
 	if (CreatedNodeIds.Num() == 0)
 	{
@@ -1189,7 +1609,16 @@ FHoudiniInputTranslator::UploadHoudiniInputObject(
 	if (!InInput || !InInputObject)
 		return false;
 
+	// This component has already been sent by its mesh's instancer, or in the merged splines
+	if (InInput->GetInstancedWorldInputComponents().Contains(InInputObject) || InInput->GetMergedWorldInputSplines().Contains(InInputObject))
+	{
+		InInputObject->MarkChanged(false);
+		InInputObject->SetNeedsToTriggerUpdate(false);
+		return true;
+	}
+
 	FString ObjBaseName = InInput->GetNodeBaseName();
+	const double StartTime = FPlatformTime::Seconds();
 
 	bool bSuccess = true;
 	switch (InInputObject->Type)
@@ -1390,6 +1819,8 @@ FHoudiniInputTranslator::UploadHoudiniInputObject(
 		InInputObject->SetNeedsToTriggerUpdate(false);
 	}
 
+	HOUDINI_LOG_HELPER(Verbose, TEXT("Uploading input object %s completed in %.4f seconds"), *InInputObject->GetName(), FPlatformTime::Seconds() - StartTime);
+
 	return bSuccess;
 }
 
@@ -1439,7 +1870,11 @@ FHoudiniInputTranslator::UploadHoudiniInputTransform(
 			}
 
 			FTransform NewTransform = InSMC->GetStaticMeshComponent() ? InSMC->GetStaticMeshComponent()->GetComponentTransform() : InInputObject->Transform;
-			if(!UpdateTransform(NewTransform, InInputObject->InputObjectNodeId))
+
+			// Instanced components' transforms are sent with their instancer's points
+			const bool bIsInstanced = !InSMC->SharedInputNodeKey.IsEmpty()
+				|| (InInput->GetWorldInputInstanceSharedMeshes() && InInputObject->InputObjectNodeId < 0);
+			if (!bIsInstanced && !UpdateTransform(NewTransform, InInputObject->InputObjectNodeId))
 				bSuccess = false;
 
 			// Update the InputObject's transform
@@ -1721,6 +2156,436 @@ FHoudiniInputTranslator::HapiCreateInputNodeForObject(const FString& InObjNodeNa
 	return true;
 }
 
+// Returns the key identifying the data sent to Houdini for a static mesh asset with the given export options
+static FString
+GetStaticMeshSharedInputNodeKey(
+	UStaticMesh* InStaticMesh, const bool& bExportLODs, const bool& bExportSockets, const bool& bExportColliders)
+{
+	FString Content;
+#if WITH_EDITORONLY_DATA
+	// The render data's DDC key changes with the mesh's source data and build settings
+	if (InStaticMesh->RenderData)
+		Content += InStaticMesh->RenderData->DerivedDataKey;
+#endif
+
+	for (const FStaticMaterial& StaticMaterial : InStaticMesh->StaticMaterials)
+	{
+		Content += StaticMaterial.MaterialSlotName.ToString();
+		if (StaticMaterial.MaterialInterface)
+			Content += StaticMaterial.MaterialInterface->GetPathName();
+	}
+
+	if (bExportLODs)
+	{
+		Content += InStaticMesh->bAutoComputeLODScreenSize ? TEXT("auto") : TEXT("manual");
+		for (int32 LODIndex = 0; LODIndex < InStaticMesh->GetNumSourceModels(); LODIndex++)
+			Content += FString::SanitizeFloat(InStaticMesh->GetSourceModel(LODIndex).ScreenSize.Default);
+	}
+
+	if (bExportSockets)
+	{
+		for (UStaticMeshSocket* Socket : InStaticMesh->Sockets)
+		{
+			if (!Socket)
+				continue;
+
+			Content += Socket->SocketName.ToString() + Socket->Tag;
+			Content += Socket->RelativeLocation.ToString() + Socket->RelativeRotation.ToString() + Socket->RelativeScale.ToString();
+		}
+	}
+
+	if (bExportColliders && InStaticMesh->BodySetup)
+		Content += InStaticMesh->BodySetup->BodySetupGuid.ToString();
+
+	return FString::Printf(
+		TEXT("%s|%d%d%d|%08x"), *InStaticMesh->GetPathName(),
+		bExportLODs ? 1 : 0, bExportSockets ? 1 : 0, bExportColliders ? 1 : 0, FCrc::StrCrc32(*Content));
+}
+
+// Deletes an input object's node if it references a shared input node, and releases the shared node
+static void
+ReleaseSharedInputNodeReference(UHoudiniInputObject* InObject)
+{
+	if (InObject->SharedInputNodeKey.IsEmpty())
+		return;
+
+	FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InObject->InputNodeId, true);
+	InObject->InputNodeId = -1;
+	InObject->InputObjectNodeId = -1;
+
+	InObject->ReleaseSharedInputNode();
+}
+
+// Sends a static mesh asset to Houdini via the session's shared input nodes.
+// The mesh is only marshalled once per content key, the input object's node is an object merge
+// referencing the shared node, in its own OBJ node so the input object can still set its transform.
+static bool
+HapiCreateSharedInputNodeForStaticMesh(
+	UStaticMesh* InStaticMesh,
+	UHoudiniInputObject* InObject,
+	const FString& InNodeName,
+	const bool& bExportLODs,
+	const bool& bExportSockets,
+	const bool& bExportColliders)
+{
+	FHoudiniEngineRuntime& EngineRuntime = FHoudiniEngineRuntime::Get();
+	const FString SharedKey = GetStaticMeshSharedInputNodeKey(InStaticMesh, bExportLODs, bExportSockets, bExportColliders);
+
+	// Marshall the mesh if no valid node has been created for this content yet
+	HAPI_NodeId SharedNodeId = EngineRuntime.GetSharedInputNodeId(SharedKey);
+	if (SharedNodeId < 0 || !FHoudiniEngineUtils::IsHoudiniNodeValid(SharedNodeId))
+	{
+		SharedNodeId = -1;
+		if (!FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
+			InStaticMesh, SharedNodeId, TEXT("SharedInput_") + InStaticMesh->GetName(), nullptr, bExportLODs, bExportSockets, bExportColliders))
+		{
+			EngineRuntime.MarkNodeIdAsPendingDelete(SharedNodeId, true);
+			return false;
+		}
+
+		EngineRuntime.SetSharedInputNodeId(SharedKey, SharedNodeId);
+	}
+
+	if (InObject->SharedInputNodeKey != SharedKey)
+	{
+		if (InObject->SharedInputNodeKey.IsEmpty())
+		{
+			// The object's previous node contains its own copy of the mesh, delete it
+			if (InObject->InputNodeId >= 0)
+				EngineRuntime.MarkNodeIdAsPendingDelete(InObject->InputNodeId, true);
+
+			InObject->InputNodeId = -1;
+			InObject->InputObjectNodeId = -1;
+		}
+
+		EngineRuntime.AcquireSharedInputNode(SharedKey);
+		if (!InObject->SharedInputNodeKey.IsEmpty())
+			EngineRuntime.ReleaseSharedInputNode(InObject->SharedInputNodeKey);
+
+		InObject->SharedInputNodeKey = SharedKey;
+	}
+
+	if (InObject->InputNodeId < 0 || !FHoudiniEngineUtils::IsHoudiniNodeValid(InObject->InputNodeId))
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::CreateNode(
+			-1, TEXT("SOP/object_merge"), InNodeName, true, &InObject->InputNodeId), false);
+	}
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetParmNodeValue(
+		FHoudiniEngine::Get().GetSession(), InObject->InputNodeId, "objpath1", SharedNodeId), false);
+
+	return true;
+}
+
+// Sends the static mesh components of a world input that share the same mesh as a single
+// shared mesh node instanced on a point cloud of the components' transforms.
+// The first component of each group owns the instancer's nodes, the others have no nodes.
+static bool
+UploadWorldInputSharedMeshInstances(UHoudiniInput* InInput, TArray<int32>& OutCreatedNodeIds)
+{
+	if (!InInput || InInput->GetInputType() != EHoudiniInputType::World)
+		return true;
+
+	TSet<UHoudiniInputObject*>& InstancedWorldInputComponents = InInput->GetInstancedWorldInputComponents();
+	TMap<TWeakObjectPtr<UHoudiniInputObject>, uint32>& SharedMeshInstancerSignatures = InInput->GetSharedMeshInstancerSignatures();
+	InstancedWorldInputComponents.Empty();
+
+	TArray<UHoudiniInputObject*>* InputObjectsArray = InInput->GetHoudiniInputObjectArray(EHoudiniInputType::World);
+	if (!InputObjectsArray)
+		return true;
+
+	const bool bInstanceSharedMeshes = InInput->GetWorldInputInstanceSharedMeshes() && !InInput->GetImportAsReference();
+
+	// Group the static mesh components by mesh
+	TMap<UStaticMesh*, TArray<UHoudiniInputMeshComponent*>> ComponentsByMesh;
+	for (UHoudiniInputObject* CurrentInputObject : *InputObjectsArray)
+	{
+		UHoudiniInputActor* InputActor = Cast<UHoudiniInputActor>(CurrentInputObject);
+		if (!InputActor || InputActor->IsPendingKill())
+			continue;
+
+		for (UHoudiniInputSceneComponent* CurrentComp : InputActor->GetActorComponents())
+		{
+			if (!CurrentComp || CurrentComp->IsPendingKill())
+				continue;
+
+			// Instanced static mesh components already have their own instancer
+			if (CurrentComp->Type != EHoudiniInputObjectType::StaticMeshComponent)
+				continue;
+
+			UHoudiniInputMeshComponent* InputSMC = Cast<UHoudiniInputMeshComponent>(CurrentComp);
+			UStaticMeshComponent* SMC = InputSMC ? InputSMC->GetStaticMeshComponent() : nullptr;
+			UStaticMesh* SM = SMC ? SMC->GetStaticMesh() : nullptr;
+			if (!SM || SM->IsPendingKill())
+				continue;
+
+			// The shared mesh is sent with its own materials, so components overriding them are sent normally
+			bool bHasMaterialOverrides = false;
+			for (int32 MatIdx = 0; MatIdx < SMC->GetNumMaterials(); MatIdx++)
+			{
+				if (SMC->GetMaterial(MatIdx) != SM->GetMaterial(MatIdx))
+				{
+					bHasMaterialOverrides = true;
+					break;
+				}
+			}
+
+			if (bInstanceSharedMeshes && !bHasMaterialOverrides)
+				ComponentsByMesh.FindOrAdd(SM).Add(InputSMC);
+			else
+				ReleaseSharedInputNodeReference(InputSMC);
+		}
+	}
+
+	// Forget the signatures of the leaders that have been destroyed
+	for (auto It = SharedMeshInstancerSignatures.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+
+	bool bSuccess = true;
+	FString ObjBaseName = InInput->GetNodeBaseName();
+	for (auto& CurrentGroup : ComponentsByMesh)
+	{
+		TArray<UHoudiniInputMeshComponent*>& GroupComponents = CurrentGroup.Value;
+		if (GroupComponents.Num() < 2)
+		{
+			// Meshes that aren't shared are sent normally
+			for (UHoudiniInputMeshComponent* InputSMC : GroupComponents)
+			{
+				ReleaseSharedInputNodeReference(InputSMC);
+				SharedMeshInstancerSignatures.Remove(InputSMC);
+			}
+
+			continue;
+		}
+
+		UHoudiniInputMeshComponent* LeaderSMC = GroupComponents[0];
+
+		// The signature covers the mesh's content, the export options and the group's members
+		const FString SharedKey = GetStaticMeshSharedInputNodeKey(
+			CurrentGroup.Key, InInput->GetExportLODs(), InInput->GetExportSockets(), InInput->GetExportColliders());
+		uint32 GroupSignature = GetTypeHash(SharedKey);
+		bool bGroupChanged = false;
+		for (UHoudiniInputMeshComponent* InputSMC : GroupComponents)
+		{
+			GroupSignature = HashCombine(GroupSignature, GetTypeHash(InputSMC));
+			bGroupChanged |= InputSMC->HasChanged() || InputSMC->HasTransformChanged();
+		}
+
+		// Keep the previous instancer if none of the group's components changed
+		const uint32* PreviousSignature = SharedMeshInstancerSignatures.Find(LeaderSMC);
+		if (!bGroupChanged && PreviousSignature && *PreviousSignature == GroupSignature
+			&& LeaderSMC->SharedInputNodeKey == SharedKey
+			&& LeaderSMC->InputObjectNodeId >= 0
+			&& FHoudiniEngineUtils::IsHoudiniNodeValid(LeaderSMC->InputNodeId)
+			&& FHoudiniEngineUtils::IsHoudiniNodeValid(FHoudiniEngineRuntime::Get().GetSharedInputNodeId(SharedKey)))
+		{
+			for (UHoudiniInputMeshComponent* InputSMC : GroupComponents)
+				InstancedWorldInputComponents.Add(InputSMC);
+
+			OutCreatedNodeIds.Add(LeaderSMC->InputObjectNodeId);
+			continue;
+		}
+
+		// The instancer is recreated in a new OBJ node, the mesh itself is reused from the shared input nodes
+		SharedMeshInstancerSignatures.Remove(LeaderSMC);
+		HAPI_NodeId PreviousNodeId = -1;
+		if (!LeaderSMC->SharedInputNodeKey.IsEmpty())
+		{
+			PreviousNodeId = LeaderSMC->InputNodeId;
+			LeaderSMC->InputNodeId = -1;
+		}
+
+		const FString NodeName = ObjBaseName + TEXT("_") + CurrentGroup.Key->GetName() + TEXT("_Instances");
+		bool bGroupSuccess = HapiCreateSharedInputNodeForStaticMesh(
+			CurrentGroup.Key, LeaderSMC, NodeName, InInput->GetExportLODs(), InInput->GetExportSockets(), InInput->GetExportColliders());
+
+		if (PreviousNodeId >= 0)
+			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(PreviousNodeId, true);
+
+		LeaderSMC->InputObjectNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(LeaderSMC->InputNodeId);
+
+		TArray<UStaticMeshComponent*> GroupSMCs;
+		for (int32 Idx = 0; Idx < GroupComponents.Num(); Idx++)
+		{
+			UHoudiniInputMeshComponent* InputSMC = GroupComponents[Idx];
+			if (Idx > 0)
+			{
+				// The other components' own nodes are not needed anymore
+				if (!InputSMC->SharedInputNodeKey.IsEmpty())
+				{
+					ReleaseSharedInputNodeReference(InputSMC);
+				}
+				else if (InputSMC->InputNodeId >= 0)
+				{
+					FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputSMC->InputNodeId, true);
+					InputSMC->InputNodeId = -1;
+					InputSMC->InputObjectNodeId = -1;
+				}
+			}
+
+			UStaticMeshComponent* SMC = InputSMC->GetStaticMeshComponent();
+			GroupSMCs.Add(SMC);
+			InputSMC->Update(SMC);
+			InstancedWorldInputComponents.Add(InputSMC);
+		}
+
+		HAPI_NodeId InstancerNodeId = -1;
+		if (bGroupSuccess)
+		{
+			bGroupSuccess = FUnrealInstanceTranslator::HapiCreateInputNodeForComponentInstances(
+				GroupSMCs, LeaderSMC->InputNodeId, InstancerNodeId);
+		}
+
+		if (!bGroupSuccess)
+		{
+			HOUDINI_LOG_WARNING(TEXT("Failed to create the instancer for the %d components using %s."),
+				GroupComponents.Num(), *CurrentGroup.Key->GetPathName());
+			bSuccess = false;
+
+			// Send these components normally instead
+			ReleaseSharedInputNodeReference(LeaderSMC);
+			for (UHoudiniInputMeshComponent* InputSMC : GroupComponents)
+				InstancedWorldInputComponents.Remove(InputSMC);
+
+			continue;
+		}
+
+		SharedMeshInstancerSignatures.Add(LeaderSMC, GroupSignature);
+		OutCreatedNodeIds.Add(LeaderSMC->InputObjectNodeId);
+	}
+
+	return bSuccess;
+}
+
+// Sends all the spline components of a world input as a single curve geometry.
+// The first spline component owns the merged node, the others have no nodes.
+static bool
+UploadWorldInputMergedSplines(UHoudiniInput* InInput, TArray<int32>& OutCreatedNodeIds)
+{
+	if (!InInput)
+		return true;
+
+	TSet<UHoudiniInputObject*>& MergedWorldInputSplines = InInput->GetMergedWorldInputSplines();
+	TMap<TWeakObjectPtr<UHoudiniInputObject>, uint32>& MergedSplineSignatures = InInput->GetMergedSplineSignatures();
+	MergedWorldInputSplines.Empty();
+	if (InInput->GetInputType() != EHoudiniInputType::World || !InInput->GetWorldInputMergeSplines())
+		return true;
+
+	TArray<UHoudiniInputObject*>* InputObjectsArray = InInput->GetHoudiniInputObjectArray(EHoudiniInputType::World);
+	if (!InputObjectsArray)
+		return true;
+
+	TArray<UHoudiniInputSplineComponent*> InputSplines;
+	TArray<USplineComponent*> Splines;
+	for (UHoudiniInputObject* CurrentInputObject : *InputObjectsArray)
+	{
+		UHoudiniInputActor* InputActor = Cast<UHoudiniInputActor>(CurrentInputObject);
+		if (!InputActor || InputActor->IsPendingKill())
+			continue;
+
+		for (UHoudiniInputSceneComponent* CurrentComp : InputActor->GetActorComponents())
+		{
+			if (!CurrentComp || CurrentComp->IsPendingKill())
+				continue;
+
+			if (CurrentComp->Type != EHoudiniInputObjectType::SplineComponent)
+				continue;
+
+			UHoudiniInputSplineComponent* InputSpline = Cast<UHoudiniInputSplineComponent>(CurrentComp);
+			USplineComponent* Spline = InputSpline ? InputSpline->GetSplineComponent() : nullptr;
+			if (!Spline || Spline->IsPendingKill())
+				continue;
+
+			InputSplines.Add(InputSpline);
+			Splines.Add(Spline);
+		}
+	}
+
+	// Forget the signatures of the leaders that have been destroyed
+	for (auto It = MergedSplineSignatures.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+
+	if (InputSplines.Num() < 1)
+		return true;
+
+	UHoudiniInputSplineComponent* LeaderSpline = InputSplines[0];
+	const float SplineResolution = InInput->GetUnrealSplineResolution();
+	const float SplineTolerance = CVarHoudiniEngineSplineInputTolerance.GetValueOnAnyThread();
+
+	// The signature covers the sampling settings and the merged splines
+	uint32 MergedSignature = HashCombine(GetTypeHash(SplineResolution), GetTypeHash(SplineTolerance));
+	bool bSplinesChanged = false;
+	for (UHoudiniInputSplineComponent* InputSpline : InputSplines)
+	{
+		MergedSignature = HashCombine(MergedSignature, GetTypeHash(InputSpline));
+		bSplinesChanged |= InputSpline->HasChanged() || InputSpline->HasTransformChanged();
+	}
+
+	// Keep the previous merged node if no spline was changed, added or removed
+	const uint32* PreviousSignature = MergedSplineSignatures.Find(LeaderSpline);
+	if (!bSplinesChanged && PreviousSignature && *PreviousSignature == MergedSignature
+		&& LeaderSpline->InputObjectNodeId >= 0
+		&& FHoudiniEngineUtils::IsHoudiniNodeValid(LeaderSpline->InputNodeId))
+	{
+		for (UHoudiniInputSplineComponent* InputSpline : InputSplines)
+			MergedWorldInputSplines.Add(InputSpline);
+
+		OutCreatedNodeIds.Add(LeaderSpline->InputObjectNodeId);
+		return true;
+	}
+
+	// The merged node is recreated, the other splines' own nodes are not needed anymore
+	MergedSplineSignatures.Remove(LeaderSpline);
+	HAPI_NodeId PreviousNodeId = LeaderSpline->InputNodeId;
+	LeaderSpline->InputNodeId = -1;
+	LeaderSpline->InputObjectNodeId = -1;
+	for (int32 Idx = 1; Idx < InputSplines.Num(); Idx++)
+	{
+		UHoudiniInputSplineComponent* InputSpline = InputSplines[Idx];
+		if (InputSpline->InputNodeId >= 0)
+			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputSpline->InputNodeId, true);
+
+		InputSpline->InputNodeId = -1;
+		InputSpline->InputObjectNodeId = -1;
+	}
+
+	const FString NodeName = InInput->GetNodeBaseName() + TEXT("_Splines");
+	bool bSuccess = FUnrealSplineTranslator::CreateInputNodeForSplineComponents(
+		Splines, SplineResolution, SplineTolerance, LeaderSpline->InputNodeId, NodeName);
+
+	if (PreviousNodeId >= 0)
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(PreviousNodeId, true);
+
+	if (!bSuccess)
+	{
+		// The splines will be sent individually instead
+		HOUDINI_LOG_WARNING(TEXT("Failed to create the merged node for the %d splines of %s."), InputSplines.Num(), *NodeName);
+		return false;
+	}
+
+	for (int32 Idx = 0; Idx < InputSplines.Num(); Idx++)
+	{
+		// Update the components' cached data
+		InputSplines[Idx]->Update(Splines[Idx]);
+		MergedWorldInputSplines.Add(InputSplines[Idx]);
+	}
+
+	if (LeaderSpline->InputNodeId >= 0)
+	{
+		LeaderSpline->InputObjectNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(LeaderSpline->InputNodeId);
+		OutCreatedNodeIds.Add(LeaderSpline->InputObjectNodeId);
+		MergedSplineSignatures.Add(LeaderSpline, MergedSignature);
+	}
+
+	return true;
+}
+
 bool
 FHoudiniInputTranslator::HapiCreateInputNodeForStaticMesh(
 	const FString& InObjNodeName,
@@ -1759,6 +2624,13 @@ FHoudiniInputTranslator::HapiCreateInputNodeForStaticMesh(
 	// Marshall the Static Mesh to Houdini
 	bool bSuccess = true;
 
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	const bool bShareInputNodes = HoudiniRuntimeSettings && HoudiniRuntimeSettings->bMarshallingShareStaticMeshInputNodes;
+
+	// Only input nodes sending the static mesh itself can be shared
+	if (bImportAsReference || !bShareInputNodes || InObject->bIsBlueprint())
+		ReleaseSharedInputNodeReference(InObject);
+
 	if (bImportAsReference) 
 	{
 		// Start by getting the Object's full name
@@ -1834,8 +2706,16 @@ FHoudiniInputTranslator::HapiCreateInputNodeForStaticMesh(
 				if (!SMObject || SMObject->IsPendingKill())
 					continue;
 
-				bSuccess &= FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
-					CurSMC->GetStaticMesh(), SMObject->InputNodeId, SMName, nullptr, bExportLODs, bExportSockets, bExportColliders);
+				if (bShareInputNodes)
+				{
+					bSuccess &= HapiCreateSharedInputNodeForStaticMesh(
+						CurSMC->GetStaticMesh(), SMObject, SMName, bExportLODs, bExportSockets, bExportColliders);
+				}
+				else
+				{
+					bSuccess &= FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
+						CurSMC->GetStaticMesh(), SMObject->InputNodeId, SMName, nullptr, bExportLODs, bExportSockets, bExportColliders);
+				}
 
 				InObject->SetImportAsReference(false);
 
@@ -1862,7 +2742,12 @@ FHoudiniInputTranslator::HapiCreateInputNodeForStaticMesh(
 			return true;
 		}
 		// This is a normal static mesh input, process it normally as a static mesh Input Object
-		else 
+		else if (bShareInputNodes)
+		{
+			bSuccess = HapiCreateSharedInputNodeForStaticMesh(
+				SM, InObject, SMName, bExportLODs, bExportSockets, bExportColliders);
+		}
+		else
 		{
 			bSuccess = FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 				SM, InObject->InputNodeId, SMName, nullptr, bExportLODs, bExportSockets, bExportColliders);
@@ -2362,7 +3247,8 @@ FHoudiniInputTranslator::HapiCreateInputNodeForLandscape(
 	{
 		// Ensure we destroy any (Houdini) input nodes before clobbering this object with a new heightfield.
 		//DestroyInputNodes(InInput, InInput->GetInputType());
-		bSucess = FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(Landscape, InObject->InputNodeId, InObjNodeName);
+		bSucess = FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
+			Landscape, InObject->InputNodeId, InObjNodeName, InObject, InInput->bLandscapeExportSelectionOnly);
 	}
 	else
 	{
@@ -2542,7 +3428,49 @@ FHoudiniInputTranslator::UpdateWorldInputs(UHoudiniAssetComponent* HAC)
 		if (CurrentInput->GetInputType() != EHoudiniInputType::World)
 			continue;
 
+#if WITH_EDITOR
+		// Only poll the input's actors if something could have changed them
+		FHoudiniInputChangeTracker& ChangeTracker = FHoudiniInputChangeTracker::Get();
+		if (!ChangeTracker.NeedsUpdate(CurrentInput))
+			continue;
+#endif
+
 		UpdateWorldInput(CurrentInput);
+
+#if WITH_EDITOR
+		// The input's actors and components may have changed
+		ChangeTracker.WatchInput(CurrentInput);
+#endif
+	}
+
+	return true;
+}
+
+// Returns true if moving this world input object only requires its transform to be uploaded,
+// and not its geometry, see UploadHoudiniInputTransform()
+static bool
+CanUploadTransformOnly(UHoudiniInput* InInput, UHoudiniInputActor* InActorObject)
+{
+	if (InActorObject->Type == EHoudiniInputObjectType::Landscape)
+		return true;
+
+	if (InActorObject->Type != EHoudiniInputObjectType::Actor)
+		return false;
+
+	for (UHoudiniInputSceneComponent* CurrentComp : InActorObject->GetActorComponents())
+	{
+		if (!CurrentComp || CurrentComp->IsPendingKill())
+			continue;
+
+		if (CurrentComp->Type == EHoudiniInputObjectType::SceneComponent)
+			continue;
+
+		// The transforms of instanced shared meshes are in their instancer's points
+		if (CurrentComp->Type == EHoudiniInputObjectType::StaticMeshComponent
+			&& !InInput->GetWorldInputInstanceSharedMeshes())
+			continue;
+
+		return false;
 	}
 
 	return true;
@@ -2562,6 +3490,7 @@ FHoudiniInputTranslator::UpdateWorldInput(UHoudiniInput* InInput)
 		return false;
 
 	bool bHasChanged = false;
+	bool bHasTransformChanged = false;
 	if (InInput->IsWorldInputBoundSelector() && InInput->GetWorldInputBoundSelectorAutoUpdates())
 	{
 		// If the input is in bound selector mode, and auto-update is enabled
@@ -2611,7 +3540,7 @@ FHoudiniInputTranslator::UpdateWorldInput(UHoudiniInput* InInput)
 		if (ActorObject->HasActorTransformChanged())
 		{
 			ActorObject->MarkTransformChanged(true);
-			bHasChanged = true;
+			bHasTransformChanged = true;
 		}	
 
 		if (ActorObject->HasContentChanged())
@@ -2628,8 +3557,10 @@ FHoudiniInputTranslator::UpdateWorldInput(UHoudiniInput* InInput)
 		{
 			if (CurActorComp->HasComponentTransformChanged())
 			{
+				// The actor uploads its components' transforms
 				CurActorComp->MarkTransformChanged(true);
-				bHasChanged = true;
+				ActorObject->MarkTransformChanged(true);
+				bHasTransformChanged = true;
 			}
 
 			if (CurActorComp->HasComponentChanged())
@@ -2646,15 +3577,25 @@ FHoudiniInputTranslator::UpdateWorldInput(UHoudiniInput* InInput)
 			if (ActorObject->GetLastUpdateNumComponentsRemoved() > 0)
 				TryCollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
 		}
+
+		// Objects whose transform can't be updated on its own need to be uploaded again
+		if (ActorObject->HasTransformChanged() && !CanUploadTransformOnly(InInput, ActorObject))
+		{
+			ActorObject->MarkChanged(true);
+			bHasChanged = true;
+		}
 	}
 
 	// Delete the actor objects that were marked for deletion
 	for (int32 ToDeleteIdx = ObjectToDeleteIndices.Num() - 1; ToDeleteIdx >= 0; ToDeleteIdx--)
 		InputObjectsPtr->RemoveAt(ObjectToDeleteIndices[ToDeleteIdx]);
 
-	// Mark the input as changed if need so it will trigger an upload
+	// Mark the input as changed if need so it will trigger an upload,
+	// moved objects only need their transform to be uploaded
 	if (bHasChanged)
 		InInput->MarkChanged(true);
+	else if (bHasTransformChanged)
+		InInput->MarkTransformsOnlyChanged();
 
 	return true;
 }
@@ -2796,6 +3737,22 @@ FHoudiniInputTranslator::HapiCreateInputNodeForDataTable(const FString& InNodeNa
 	UDataTable* DataTable = InInputObject->GetDataTable();
 	if (!DataTable || DataTable->IsPendingKill())
 		return true;
+
+	if (CVarHoudiniEngineDataTableInputTypedColumns.GetValueOnAnyThread() != 0)
+	{
+		HAPI_NodeId CreatedNodeId = -1;
+		const bool bSuccess = FUnrealDataTableTranslator::CreateInputNodeForDataTable(DataTable, CreatedNodeId, InNodeName + TEXT("_") + DataTable->GetName());
+
+		// Update this input object's NodeId and ObjectNodeId even if the upload failed,
+		// so the created node is cleaned up with the input object
+		if (CreatedNodeId >= 0)
+		{
+			InInputObject->InputNodeId = (int32)CreatedNodeId;
+			InInputObject->InputObjectNodeId = (int32)FHoudiniEngineUtils::HapiGetParentNodeId(CreatedNodeId);
+		}
+
+		return bSuccess;
+	}
 	
 	// Get the DataTable data as string
 	TArray<TArray<FString>> TableData = DataTable->GetTableData(EDataTableExportFlags::None);
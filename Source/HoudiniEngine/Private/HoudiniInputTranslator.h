@@ -115,6 +115,9 @@ struct HOUDINIENGINE_API FHoudiniInputTranslator
 	// Updates/ticks the given world input
 	static bool UpdateWorldInput(UHoudiniInput* InInput);
 
+	// Releases the editor change notifications tracking used by the inputs
+	static void ShutdownInputChangeTracker();
+
 	// Connect an input's nodes to its linked HDA node
 	static bool ConnectInputNode(UHoudiniInput* InInput);
 
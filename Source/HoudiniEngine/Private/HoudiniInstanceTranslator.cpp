@@ -43,6 +43,7 @@
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "InstancedFoliageActor.h"
+#include "Async/ParallelFor.h"
 
 #if WITH_EDITOR
 	//#include "ScopedTransaction.h"
@@ -60,6 +61,257 @@ inline int fastrand(int& nSeed)
 	return (nSeed >> 16) & 0x7FFF;
 }
 
+// Returns the fastrand seed obtained after InSteps calls, starting from InSeed.
+// Uses the LCG jump-ahead so a sequence can be split in independent batches.
+inline int fastrand_skip(const int& InSeed, int32 InSteps)
+{
+	uint32 AccMul = 1;
+	uint32 AccAdd = 0;
+	uint32 CurMul = 214013;
+	uint32 CurAdd = 2531011;
+	while (InSteps > 0)
+	{
+		if (InSteps & 1)
+		{
+			AccMul *= CurMul;
+			AccAdd = AccAdd * CurMul + CurAdd;
+		}
+		CurAdd = (CurMul + 1) * CurAdd;
+		CurMul *= CurMul;
+		InSteps >>= 1;
+	}
+
+	return (int)(AccMul * (uint32)InSeed + AccAdd);
+}
+
+// Number of instances processed per task by the parallel instance passes
+static const int32 HoudiniInstanceBatchSize = 16384;
+
+// Converts HAPI transforms to Unreal transforms, in parallel batches
+static void
+ConvertHapiInstanceTransforms(const TArray<HAPI_Transform>& InHapiTransforms, TArray<FTransform>& OutUnrealTransforms)
+{
+	const int32 NumTransforms = InHapiTransforms.Num();
+	OutUnrealTransforms.SetNumUninitialized(NumTransforms);
+
+	const int32 NumBatches = FMath::DivideAndRoundUp(NumTransforms, HoudiniInstanceBatchSize);
+	ParallelFor(NumBatches, [&InHapiTransforms, &OutUnrealTransforms, NumTransforms](int32 BatchIdx)
+	{
+		const int32 Start = BatchIdx * HoudiniInstanceBatchSize;
+		const int32 End = FMath::Min(Start + HoudiniInstanceBatchSize, NumTransforms);
+		for (int32 Idx = Start; Idx < End; Idx++)
+			FHoudiniEngineUtils::TranslateHapiTransform(InHapiTransforms[Idx], OutUnrealTransforms[Idx]);
+	});
+}
+
+// Applies a variation's transform offset to the given instance transforms, in parallel batches
+static void
+ApplyVariationTransformOffset(const FTransform& InTransformOffset, TArray<FTransform>& InOutTransforms)
+{
+	const FVector PositionOffset = InTransformOffset.GetLocation();
+	const FQuat RotationOffset = InTransformOffset.GetRotation();
+	const FVector ScaleOffset = InTransformOffset.GetScale3D();
+
+	const int32 NumTransforms = InOutTransforms.Num();
+	const int32 NumBatches = FMath::DivideAndRoundUp(NumTransforms, HoudiniInstanceBatchSize);
+	ParallelFor(NumBatches, [&](int32 BatchIdx)
+	{
+		const int32 Start = BatchIdx * HoudiniInstanceBatchSize;
+		const int32 End = FMath::Min(Start + HoudiniInstanceBatchSize, NumTransforms);
+		for (int32 TransformIndex = Start; TransformIndex < End; TransformIndex++)
+		{
+			FTransform CurrentTransform = InOutTransforms[TransformIndex];
+
+			// Compute new rotation and scale.
+			FVector Position = CurrentTransform.GetLocation() + PositionOffset;
+			FQuat TransformRotation = CurrentTransform.GetRotation() * RotationOffset;
+			FVector TransformScale3D = CurrentTransform.GetScale3D() * ScaleOffset;
+
+			// Make sure inverse matrix exists - seems to be a bug in Unreal when submitting instances.
+			// Happens in blueprint as well.
+			// We want to make sure the scale is not too small, but keep negative values! (Bug 90876)
+			if (FMath::Abs(TransformScale3D.X) < HAPI_UNREAL_SCALE_SMALL_VALUE)
+				TransformScale3D.X = (TransformScale3D.X > 0) ? HAPI_UNREAL_SCALE_SMALL_VALUE : -HAPI_UNREAL_SCALE_SMALL_VALUE;
+
+			if (FMath::Abs(TransformScale3D.Y) < HAPI_UNREAL_SCALE_SMALL_VALUE)
+				TransformScale3D.Y = (TransformScale3D.Y > 0) ? HAPI_UNREAL_SCALE_SMALL_VALUE : -HAPI_UNREAL_SCALE_SMALL_VALUE;
+
+			if (FMath::Abs(TransformScale3D.Z) < HAPI_UNREAL_SCALE_SMALL_VALUE)
+				TransformScale3D.Z = (TransformScale3D.Z > 0) ? HAPI_UNREAL_SCALE_SMALL_VALUE : -HAPI_UNREAL_SCALE_SMALL_VALUE;
+
+			CurrentTransform.SetLocation(Position);
+			CurrentTransform.SetRotation(TransformRotation);
+			CurrentTransform.SetScale3D(TransformScale3D);
+
+			if (CurrentTransform.IsValid())
+				InOutTransforms[TransformIndex] = CurrentTransform;
+		}
+	});
+}
+
+// Hashes the transform of a foliage instance, used to match existing instances with new ones
+static uint32
+GetFoliageInstanceHash(const FFoliageInstance& InInstance)
+{
+	uint32 Hash = FCrc::MemCrc32(&InInstance.Location, sizeof(FVector));
+	Hash = FCrc::MemCrc32(&InInstance.Rotation, sizeof(FRotator), Hash);
+	return FCrc::MemCrc32(&InInstance.DrawScale3D, sizeof(FVector), Hash);
+}
+
+// Returns the component as a foliage HISMC if it is owned by an Instanced Foliage Actor
+static UHierarchicalInstancedStaticMeshComponent*
+GetFoliageHISMC(UObject* InComponent)
+{
+	UHierarchicalInstancedStaticMeshComponent* HISMC = Cast<UHierarchicalInstancedStaticMeshComponent>(InComponent);
+	if (!IsValid(HISMC))
+		return nullptr;
+
+	if (!HISMC->GetOwner() || !HISMC->GetOwner()->IsA<AInstancedFoliageActor>())
+		return nullptr;
+
+	return HISMC;
+}
+
+// Asynchronously rebuilds the trees of the foliage HISMCs used by the given output objects.
+// Foliage instances are added/removed without rebuilding the tree, so this is done once per HISMC.
+static void
+BuildFoliageTrees(const TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& InOutputObjects)
+{
+	TSet<UHierarchicalInstancedStaticMeshComponent*> FoliageHISMCs;
+	for (const auto& CurrentPair : InOutputObjects)
+	{
+		UHierarchicalInstancedStaticMeshComponent* HISMC = Cast<UHierarchicalInstancedStaticMeshComponent>(CurrentPair.Value.OutputComponent);
+		if (!IsValid(HISMC))
+			continue;
+
+		if (HISMC->GetOwner() && HISMC->GetOwner()->IsA<AInstancedFoliageActor>())
+			FoliageHISMCs.Add(HISMC);
+	}
+
+	for (UHierarchicalInstancedStaticMeshComponent* HISMC : FoliageHISMCs)
+	{
+		HISMC->BuildTreeIfOutdated(true, true);
+	}
+}
+
+// Time spent spawning instanced actors during the current frame, shared by all the instancers and pending spawns
+static uint64 InstanceActorSpawnFrame = 0;
+static double InstanceActorSpawnTime = 0.0;
+
+// Returns the key of the pool an instanced actor component's actors are released to and acquired from
+static FHoudiniInstanceActorPoolKey
+GetInstanceActorPoolKey(UHoudiniInstancedActorComponent* InIAC, UObject* InInstancedObject)
+{
+	FHoudiniInstanceActorPoolKey Key;
+	Key.Owner = InIAC->GetOwner();
+	Key.Level = Key.Owner.IsValid() ? Key.Owner->GetLevel() : nullptr;
+	Key.InstancedObject = InInstancedObject;
+	return Key;
+}
+
+// Keeps an actor released by an instanced actor component so it can be reused
+static void
+RecycleInstanceActor(UHoudiniInstancedActorComponent* InIAC, UObject* InInstancedObject, AActor* InActor)
+{
+	if (!InIAC || !InInstancedObject || !InActor || InActor->IsPendingKill())
+		return;
+
+	InActor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+	FHoudiniEngine::Get().GetRecycledInstanceActors().FindOrAdd(GetInstanceActorPoolKey(InIAC, InInstancedObject)).Add(InActor);
+}
+
+// Releases all the actors of an instanced actor component so they can be reused
+static void
+RecycleAllInstanceActors(UHoudiniInstancedActorComponent* InIAC)
+{
+	if (!InIAC || InIAC->IsPendingKill())
+		return;
+
+	TArray<AActor*> ReleasedActors;
+	InIAC->ReleaseInstances(0, ReleasedActors);
+	for (AActor* CurrentActor : ReleasedActors)
+		RecycleInstanceActor(InIAC, InIAC->GetInstancedObject(), CurrentActor);
+}
+
+// Returns an actor previously released for the given object in the component's level and owner, if any
+static AActor*
+AcquireRecycledInstanceActor(UHoudiniInstancedActorComponent* InIAC, UObject* InInstancedObject)
+{
+	TArray<TWeakObjectPtr<AActor>>* RecycledActors = FHoudiniEngine::Get().GetRecycledInstanceActors().Find(GetInstanceActorPoolKey(InIAC, InInstancedObject));
+	if (!RecycledActors)
+		return nullptr;
+
+	while (RecycledActors->Num() > 0)
+	{
+		AActor* RecycledActor = RecycledActors->Pop(false).Get();
+		if (RecycledActor && !RecycledActor->IsPendingKill())
+			return RecycledActor;
+	}
+
+	return nullptr;
+}
+
+// Destroys the released actors that haven't been reused, once there are no more pending spawns
+static void
+FlushRecycledInstanceActors()
+{
+	if (FHoudiniEngine::Get().GetPendingInstanceActorSpawns().Num() > 0)
+		return;
+
+	TMap<FHoudiniInstanceActorPoolKey, TArray<TWeakObjectPtr<AActor>>>& RecycledInstanceActors = FHoudiniEngine::Get().GetRecycledInstanceActors();
+
+	int32 NumDestroyed = 0;
+	for (auto& CurrentPair : RecycledInstanceActors)
+	{
+		for (TWeakObjectPtr<AActor>& CurrentActor : CurrentPair.Value)
+		{
+			if (CurrentActor.IsValid() && !CurrentActor->IsPendingKill())
+			{
+				CurrentActor->Destroy();
+				NumDestroyed++;
+			}
+		}
+	}
+	RecycledInstanceActors.Empty();
+
+	if (NumDestroyed > 0)
+		HOUDINI_LOG_MESSAGE(TEXT("Destroyed %d unused instanced actor(s)."), NumDestroyed);
+}
+
+// Returns the time spent spawning instanced actors during this frame
+static double&
+GetInstanceActorSpawnTime()
+{
+	if (InstanceActorSpawnFrame != GFrameCounter)
+	{
+		InstanceActorSpawnFrame = GFrameCounter;
+		InstanceActorSpawnTime = 0.0;
+	}
+
+	return InstanceActorSpawnTime;
+}
+
+// Returns true if the spawn time budget for this tick has been used, by any instancer
+static bool
+IsInstanceActorSpawnBudgetExceeded()
+{
+	const float TimeBudget = GetDefault<UHoudiniRuntimeSettings>()->InstancedActorSpawnTimeBudget;
+	if (TimeBudget <= 0.0f)
+		return false;
+
+	return GetInstanceActorSpawnTime() * 1000.0 > TimeBudget;
+}
+
+// Spawns an instanced actor, counting the time spent against this tick's spawn budget
+static AActor*
+SpawnInstanceActorWithinBudget(const FTransform& InTransform, ULevel* InSpawnLevel, UHoudiniInstancedActorComponent* InIAC)
+{
+	const double SpawnStartTime = FPlatformTime::Seconds();
+	AActor* NewActor = FHoudiniInstanceTranslator::SpawnInstanceActor(InTransform, InSpawnLevel, InIAC);
+	GetInstanceActorSpawnTime() += FPlatformTime::Seconds() - SpawnStartTime;
+	return NewActor;
+}
+
 //
 bool
 FHoudiniInstanceTranslator::PopulateInstancedOutputPartData(
@@ -87,6 +339,9 @@ FHoudiniInstanceTranslator::PopulateInstancedOutputPartData(
 
 	OutInstancedOutputPartData.bIsFoliageInstancer = IsFoliageInstancer(InHGPO.GeoId, InHGPO.PartId);
 
+	// Get the cell size used to partition the instances
+	OutInstancedOutputPartData.CellSize = GetInstancerCellSize(InHGPO.GeoId, InHGPO.PartId);
+
 	// Extract the generic attributes
 	GetGenericPropertiesAttributes(InHGPO.GeoId, InHGPO.PartId, OutInstancedOutputPartData.AllPropertyAttributes);
 
@@ -172,7 +427,8 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 	// the UI (foliage mode) at the end
 	bool bHaveAnyFoliageInstancers = false;
 
-	// We also need to cleanup the previous foliages instances (if we have any)
+	// The previous foliage instances (if we have any) are cleaned up after the new instancers have been created:
+	// foliage types that are still in use only remove the instances whose transforms have changed
 	for (auto& CurrentPair : OldOutputObjects)
 	{
 		// Foliage instancers store a HISMC in the components
@@ -180,8 +436,12 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 		if (!IsValid(FoliageHISMC))
 			continue;
 
-		CleanupFoliageInstances(FoliageHISMC, CurrentPair.Value.OutputObject, ParentComponent);
 		bHaveAnyFoliageInstancers = true;
+
+		// Foliage instances that weren't recorded on their output object can't be told apart
+		// from the other instancers' ones, clean them all up before recreating them
+		if (CurrentPair.Value.FoliageInstanceHashes.Num() <= 0 && GetFoliageHISMC(FoliageHISMC))
+			CleanupFoliageInstances(FoliageHISMC, CurrentPair.Value.OutputObject, ParentComponent);
 	}
 
 	// The default SM to be used if the instanced object has not been found (when using attribute instancers)
@@ -319,110 +579,176 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 			if (!GetVariationMaterials(FoundInstancedOutput, InstanceObjectIdx, InstancedOutputPartData.OriginalInstancedIndices[VariationOriginalIndex], InstancerMaterials, VariationMaterials))
 				VariationMaterials.Empty();
 
-			USceneComponent* NewInstancerComponent = nullptr;
-			if (!CreateOrUpdateInstanceComponent(
+			const TArray<int32>& OriginalInstancerObjectIndices = InstancedOutputPartData.OriginalInstancedIndices[VariationOriginalIndex];
+			const TArray<float>* PerInstanceCustomData = InstancedOutputPartData.PerInstanceCustomData.IsValidIndex(VariationOriginalIndex)
+				? &InstancedOutputPartData.PerInstanceCustomData[VariationOriginalIndex] : nullptr;
+			const int32 NumCustomFloats = InstancedOutputPartData.NumCustomFloatsPerObject.IsValidIndex(VariationOriginalIndex)
+				? InstancedOutputPartData.NumCustomFloatsPerObject[VariationOriginalIndex] : 0;
+
+			// The components created for this variation and their output identifiers
+			// Partitioned instancers create one component per cell, others only one
+			TArray<TPair<FHoudiniOutputObjectIdentifier, USceneComponent*>> NewInstancerComponents;
+			if (FoundInstancedOutput)
+				FoundInstancedOutput->CellSize = InstancedOutputPartData.CellSize;
+
+			// The foliage instances owned by this variation's output object
+			TArray<uint32> FoliageInstanceHashes;
+
+			if (FoundInstancedOutput && ShouldPartitionInstancesInCells(
 				InstancedObject,
 				InstancedObjectTransforms,
-				InstancedOutputPartData.AllPropertyAttributes,
-				CurHGPO,
-				ParentComponent,
-				OldInstancerComponent,
-				NewInstancerComponent,
+				InstancedOutputPartData.CellSize,
 				InstancedOutputPartData.bSplitMeshInstancer,
-				InstancedOutputPartData.bIsFoliageInstancer,
-				VariationMaterials,
-				InstancedOutputPartData.OriginalInstancedIndices[VariationOriginalIndex],
-				InstanceObjectIdx,
-				InstancedOutputPartData.bForceHISM))
+				InstancedOutputPartData.bIsFoliageInstancer))
 			{
-				// TODO??
-				continue;
+				if (!CreateOrUpdateInstanceCellComponents(
+					InstancedObject,
+					InstancedObjectTransforms,
+					InstancedOutputPartData.AllPropertyAttributes,
+					CurHGPO,
+					ParentComponent,
+					OutputIdentifier,
+					VariationIndices[InstanceObjectIdx],
+					OldOutputObjects,
+					*FoundInstancedOutput,
+					VariationMaterials,
+					OriginalInstancerObjectIndices,
+					PerInstanceCustomData,
+					NumCustomFloats,
+					NewInstancerComponents))
+				{
+					continue;
+				}
 			}
+			else
+			{
+				// This variation isn't partitioned (anymore), forget its cells
+				if (FoundInstancedOutput)
+				{
+					const int32 VariationIndex = VariationIndices[InstanceObjectIdx];
+					FoundInstancedOutput->Cells.RemoveAll([VariationIndex](const FHoudiniInstancedOutputCell& Cell)
+					{
+						return Cell.VariationIndex == VariationIndex;
+					});
+				}
 
-			if (!NewInstancerComponent)
-				continue;
+				if (FoundOutputObject)
+					FoliageInstanceHashes = FoundOutputObject->FoliageInstanceHashes;
+
+				USceneComponent* NewInstancerComponent = nullptr;
+				if (!CreateOrUpdateInstanceComponent(
+					InstancedObject,
+					InstancedObjectTransforms,
+					InstancedOutputPartData.AllPropertyAttributes,
+					CurHGPO,
+					ParentComponent,
+					OldInstancerComponent,
+					NewInstancerComponent,
+					InstancedOutputPartData.bSplitMeshInstancer,
+					InstancedOutputPartData.bIsFoliageInstancer,
+					VariationMaterials,
+					OriginalInstancerObjectIndices,
+					InstanceObjectIdx,
+					InstancedOutputPartData.bForceHISM,
+					&FoliageInstanceHashes))
+				{
+					// TODO??
+					continue;
+				}
 
-			// Copy the per-instance custom data if we have any
-			if (InstancedOutputPartData.PerInstanceCustomData.Num() > 0)
-			{
-				UpdateChangedPerInstanceCustomData(
-					InstancedOutputPartData.PerInstanceCustomData[VariationOriginalIndex], NewInstancerComponent);
-			}
+				if (!NewInstancerComponent)
+					continue;
 
-			// If the instanced object (by ref) wasn't found, hide the component
-			if(InstancedObject == DefaultReferenceSM)
-				NewInstancerComponent->SetHiddenInGame(true);
-			else
-				NewInstancerComponent->SetHiddenInGame(false);
+				// Copy the per-instance custom data if we have any
+				if (PerInstanceCustomData && PerInstanceCustomData->Num() > 0)
+				{
+					UpdateChangedPerInstanceCustomData(*PerInstanceCustomData, NewInstancerComponent);
+				}
 
-			FHoudiniOutputObject& NewOutputObject = NewOutputObjects.FindOrAdd(OutputIdentifier);
-			if (bIsProxyMesh)
-			{
-				NewOutputObject.ProxyComponent = NewInstancerComponent;
-				NewOutputObject.ProxyObject = InstancedObject;
+				NewInstancerComponents.Add(TPair<FHoudiniOutputObjectIdentifier, USceneComponent*>(OutputIdentifier, NewInstancerComponent));
 			}
-			else
+
+			for (const auto& NewComponentPair : NewInstancerComponents)
 			{
-				NewOutputObject.OutputComponent = NewInstancerComponent;
-				NewOutputObject.OutputObject = InstancedObject;
-			}
+				const FHoudiniOutputObjectIdentifier& NewOutputIdentifier = NewComponentPair.Key;
+				USceneComponent* NewInstancerComponent = NewComponentPair.Value;
 
-			// If this is not a new output object we have to clear the CachedAttributes and CachedTokens before
-			// setting the new values (so that we do not re-use any values from the previous cook)
-			NewOutputObject.CachedAttributes.Empty();
-			NewOutputObject.CachedTokens.Empty();
+				// If the instanced object (by ref) wasn't found, hide the component
+				if(InstancedObject == DefaultReferenceSM)
+					NewInstancerComponent->SetHiddenInGame(true);
+				else
+					NewInstancerComponent->SetHiddenInGame(false);
 
-			// Cache the level path, output name and tile attributes on the output object So they can be reused for baking
-			int32 FirstOriginalInstanceIndex = 0;
-			if(InstancedOutputPartData.OriginalInstancedIndices.IsValidIndex(VariationOriginalIndex) && InstancedOutputPartData.OriginalInstancedIndices[VariationOriginalIndex].Num() > 0)
-				FirstOriginalInstanceIndex = InstancedOutputPartData.OriginalInstancedIndices[VariationOriginalIndex][0];
+				FHoudiniOutputObject& NewOutputObject = NewOutputObjects.FindOrAdd(NewOutputIdentifier);
+				if (bIsProxyMesh)
+				{
+					NewOutputObject.ProxyComponent = NewInstancerComponent;
+					NewOutputObject.ProxyObject = InstancedObject;
+				}
+				else
+				{
+					NewOutputObject.OutputComponent = NewInstancerComponent;
+					NewOutputObject.OutputObject = InstancedObject;
+				}
+				NewOutputObject.FoliageInstanceHashes = FoliageInstanceHashes;
 
-			if(InstancedOutputPartData.AllLevelPaths.IsValidIndex(FirstOriginalInstanceIndex) && !InstancedOutputPartData.AllLevelPaths[FirstOriginalInstanceIndex].IsEmpty())
-				NewOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_LEVEL_PATH, InstancedOutputPartData.AllLevelPaths[FirstOriginalInstanceIndex]);
+				// If this is not a new output object we have to clear the CachedAttributes and CachedTokens before
+				// setting the new values (so that we do not re-use any values from the previous cook)
+				NewOutputObject.CachedAttributes.Empty();
+				NewOutputObject.CachedTokens.Empty();
 
-			if(InstancedOutputPartData.OutputNames.IsValidIndex(FirstOriginalInstanceIndex) && !InstancedOutputPartData.OutputNames[FirstOriginalInstanceIndex].IsEmpty())
-				NewOutputObject.CachedAttributes.Add(FString(HAPI_UNREAL_ATTRIB_CUSTOM_OUTPUT_NAME_V2), InstancedOutputPartData.OutputNames[FirstOriginalInstanceIndex]);
+				// Cache the level path, output name and tile attributes on the output object So they can be reused for baking
+				int32 FirstOriginalInstanceIndex = 0;
+				if(InstancedOutputPartData.OriginalInstancedIndices.IsValidIndex(VariationOriginalIndex) && InstancedOutputPartData.OriginalInstancedIndices[VariationOriginalIndex].Num() > 0)
+					FirstOriginalInstanceIndex = InstancedOutputPartData.OriginalInstancedIndices[VariationOriginalIndex][0];
 
-			// TODO: Check! maybe accessed with just VariationOriginalIndex
-			if(InstancedOutputPartData.TileValues.IsValidIndex(FirstOriginalInstanceIndex) && InstancedOutputPartData.TileValues[FirstOriginalInstanceIndex] >= 0)
-			{
-				// cache the tile attribute as a token on the output object
-				NewOutputObject.CachedTokens.Add(TEXT("tile"), FString::FromInt(InstancedOutputPartData.TileValues[FirstOriginalInstanceIndex]));
-			}
+				if(InstancedOutputPartData.AllLevelPaths.IsValidIndex(FirstOriginalInstanceIndex) && !InstancedOutputPartData.AllLevelPaths[FirstOriginalInstanceIndex].IsEmpty())
+					NewOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_LEVEL_PATH, InstancedOutputPartData.AllLevelPaths[FirstOriginalInstanceIndex]);
 
-			if(InstancedOutputPartData.AllBakeActorNames.IsValidIndex(FirstOriginalInstanceIndex) && !InstancedOutputPartData.AllBakeActorNames[FirstOriginalInstanceIndex].IsEmpty())
-				NewOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_BAKE_ACTOR, InstancedOutputPartData.AllBakeActorNames[FirstOriginalInstanceIndex]);
+				if(InstancedOutputPartData.OutputNames.IsValidIndex(FirstOriginalInstanceIndex) && !InstancedOutputPartData.OutputNames[FirstOriginalInstanceIndex].IsEmpty())
+					NewOutputObject.CachedAttributes.Add(FString(HAPI_UNREAL_ATTRIB_CUSTOM_OUTPUT_NAME_V2), InstancedOutputPartData.OutputNames[FirstOriginalInstanceIndex]);
 
-			if(InstancedOutputPartData.AllBakeFolders.IsValidIndex(FirstOriginalInstanceIndex) && !InstancedOutputPartData.AllBakeFolders[FirstOriginalInstanceIndex].IsEmpty())
-				NewOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_BAKE_FOLDER, InstancedOutputPartData.AllBakeFolders[FirstOriginalInstanceIndex]);
+				// TODO: Check! maybe accessed with just VariationOriginalIndex
+				if(InstancedOutputPartData.TileValues.IsValidIndex(FirstOriginalInstanceIndex) && InstancedOutputPartData.TileValues[FirstOriginalInstanceIndex] >= 0)
+				{
+					// cache the tile attribute as a token on the output object
+					NewOutputObject.CachedTokens.Add(TEXT("tile"), FString::FromInt(InstancedOutputPartData.TileValues[FirstOriginalInstanceIndex]));
+				}
 
-			if(InstancedOutputPartData.AllBakeOutlinerFolders.IsValidIndex(FirstOriginalInstanceIndex) && !InstancedOutputPartData.AllBakeOutlinerFolders[FirstOriginalInstanceIndex].IsEmpty())
-				NewOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_BAKE_OUTLINER_FOLDER, InstancedOutputPartData.AllBakeOutlinerFolders[FirstOriginalInstanceIndex]);
+				if(InstancedOutputPartData.AllBakeActorNames.IsValidIndex(FirstOriginalInstanceIndex) && !InstancedOutputPartData.AllBakeActorNames[FirstOriginalInstanceIndex].IsEmpty())
+					NewOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_BAKE_ACTOR, InstancedOutputPartData.AllBakeActorNames[FirstOriginalInstanceIndex]);
 
-			if(InstancedOutputPartData.SplitAttributeValues.IsValidIndex(VariationOriginalIndex)
-				&& !InstancedOutputPartData.SplitAttributeName.IsEmpty())
-			{
-				FString SplitValue = InstancedOutputPartData.SplitAttributeValues[VariationOriginalIndex];
+				if(InstancedOutputPartData.AllBakeFolders.IsValidIndex(FirstOriginalInstanceIndex) && !InstancedOutputPartData.AllBakeFolders[FirstOriginalInstanceIndex].IsEmpty())
+					NewOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_BAKE_FOLDER, InstancedOutputPartData.AllBakeFolders[FirstOriginalInstanceIndex]);
 
-				// Cache the split attribute both as attribute and token
-				NewOutputObject.CachedAttributes.Add(InstancedOutputPartData.SplitAttributeName, SplitValue);
-				NewOutputObject.CachedTokens.Add(InstancedOutputPartData.SplitAttributeName, SplitValue);
+				if(InstancedOutputPartData.AllBakeOutlinerFolders.IsValidIndex(FirstOriginalInstanceIndex) && !InstancedOutputPartData.AllBakeOutlinerFolders[FirstOriginalInstanceIndex].IsEmpty())
+					NewOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_BAKE_OUTLINER_FOLDER, InstancedOutputPartData.AllBakeOutlinerFolders[FirstOriginalInstanceIndex]);
 
-				// If we have a split name that is non-empty, override attributes that can differ by split based
-				// on the split name
-				if (!SplitValue.IsEmpty())
+				if(InstancedOutputPartData.SplitAttributeValues.IsValidIndex(VariationOriginalIndex)
+					&& !InstancedOutputPartData.SplitAttributeName.IsEmpty())
 				{
-					const FHoudiniInstancedOutputPerSplitAttributes* PerSplitAttributes = InstancedOutputPartData.PerSplitAttributes.Find(SplitValue);
-					if (PerSplitAttributes)
+					FString SplitValue = InstancedOutputPartData.SplitAttributeValues[VariationOriginalIndex];
+
+					// Cache the split attribute both as attribute and token
+					NewOutputObject.CachedAttributes.Add(InstancedOutputPartData.SplitAttributeName, SplitValue);
+					NewOutputObject.CachedTokens.Add(InstancedOutputPartData.SplitAttributeName, SplitValue);
+
+					// If we have a split name that is non-empty, override attributes that can differ by split based
+					// on the split name
+					if (!SplitValue.IsEmpty())
 					{
-						if (!PerSplitAttributes->LevelPath.IsEmpty())
-							NewOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_LEVEL_PATH, PerSplitAttributes->LevelPath);
-						if (!PerSplitAttributes->BakeActorName.IsEmpty())
-							NewOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_BAKE_ACTOR, PerSplitAttributes->BakeActorName);
-						if (!PerSplitAttributes->BakeOutlinerFolder.IsEmpty())
-							NewOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_BAKE_OUTLINER_FOLDER, PerSplitAttributes->BakeOutlinerFolder);
-						if (!PerSplitAttributes->BakeFolder.IsEmpty())
-							NewOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_BAKE_FOLDER, PerSplitAttributes->BakeFolder);
+						const FHoudiniInstancedOutputPerSplitAttributes* PerSplitAttributes = InstancedOutputPartData.PerSplitAttributes.Find(SplitValue);
+						if (PerSplitAttributes)
+						{
+							if (!PerSplitAttributes->LevelPath.IsEmpty())
+								NewOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_LEVEL_PATH, PerSplitAttributes->LevelPath);
+							if (!PerSplitAttributes->BakeActorName.IsEmpty())
+								NewOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_BAKE_ACTOR, PerSplitAttributes->BakeActorName);
+							if (!PerSplitAttributes->BakeOutlinerFolder.IsEmpty())
+								NewOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_BAKE_OUTLINER_FOLDER, PerSplitAttributes->BakeOutlinerFolder);
+							if (!PerSplitAttributes->BakeFolder.IsEmpty())
+								NewOutputObject.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_BAKE_FOLDER, PerSplitAttributes->BakeFolder);
+						}
 					}
 				}
 			}
@@ -469,6 +795,15 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 		}
 	}
 
+	// Foliage HISMCs that are still used by the new output objects
+	TSet<UObject*> NewFoliageComponents;
+	for (auto& CurNewPair : NewOutputObjects)
+	{
+		UHierarchicalInstancedStaticMeshComponent* HISMC = Cast<UHierarchicalInstancedStaticMeshComponent>(CurNewPair.Value.OutputComponent);
+		if (IsValid(HISMC) && HISMC->GetOwner() && HISMC->GetOwner()->IsA<AInstancedFoliageActor>())
+			NewFoliageComponents.Add(HISMC);
+	}
+
 	// The Old map now only contains unused/stale components, delete them
 	for (auto& OldPair : OldOutputObjects)
 	{
@@ -483,9 +818,20 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 				// When destroying a component, we have to be sure it's not an HISMC owned by an InstanceFoliageActor
 				UHierarchicalInstancedStaticMeshComponent* HISMC = Cast<UHierarchicalInstancedStaticMeshComponent>(OldComponent);
 				if (HISMC->GetOwner() && HISMC->GetOwner()->IsA<AInstancedFoliageActor>())
+				{
 					bDestroy = false;
+
+					// Remove the instances owned by the stale output object, the HISMC can still be used by other instancers.
+					// Unrecorded instances have already been removed, unless their foliage type isn't used anymore
+					if (!HISMC->IsPendingKill() && (OldPair.Value.FoliageInstanceHashes.Num() > 0 || !NewFoliageComponents.Contains(HISMC)))
+						CleanupFoliageInstances(HISMC, OldPair.Value.OutputObject, ParentComponent, &OldPair.Value.FoliageInstanceHashes);
+				}
 			}
 
+			// Keep the actors of stale instanced actor components so they can be reused by the pending spawns
+			if (bDestroy && GetDefault<UHoudiniRuntimeSettings>()->bRecycleInstancedActors)
+				RecycleAllInstanceActors(Cast<UHoudiniInstancedActorComponent>(OldComponent));
+
 			if(bDestroy)
 				RemoveAndDestroyComponent(OldComponent, OldPair.Value.OutputObject);
 
@@ -503,6 +849,12 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 	}
 	OldOutputObjects.Empty();
 
+	// Rebuild the trees of the foliage we've updated
+	BuildFoliageTrees(NewOutputObjects);
+
+	// Destroy the instanced actors that have not been reused
+	FlushRecycledInstanceActors();
+
 	// Update the output's object map
 	// Instancer do not create objects, clean the map
 	InOutput->SetOutputObjects(NewOutputObjects);
@@ -591,6 +943,15 @@ FHoudiniInstanceTranslator::UpdateChangedInstancedOutput(
 	if (!GetInstancerMaterials(OutputIdentifier.GeoId, OutputIdentifier.PartId, InstancerMaterials))
 		InstancerMaterials.Empty();
 
+	// Get the per instance custom data of the original object, instanced outputs use its index as split identifier
+	FHoudiniInstancedOutputPartData CustomDataPartData;
+	GetPerInstanceCustomData(OutputIdentifier.GeoId, OutputIdentifier.PartId, CustomDataPartData);
+	const int32 OriginalObjectIndex = FCString::Atoi(*InOutputIdentifier.SplitIdentifier);
+	const TArray<float>* PerInstanceCustomData = CustomDataPartData.PerInstanceCustomData.IsValidIndex(OriginalObjectIndex)
+		? &CustomDataPartData.PerInstanceCustomData[OriginalObjectIndex] : nullptr;
+	const int32 NumCustomFloats = CustomDataPartData.NumCustomFloatsPerObject.IsValidIndex(OriginalObjectIndex)
+		? CustomDataPartData.NumCustomFloatsPerObject[OriginalObjectIndex] : 0;
+
 	// Preload objects so we can benefit from async compilation as much as possible
 	for (int32 InstanceObjectIdx = 0; InstanceObjectIdx < InstancedObjects.Num(); InstanceObjectIdx++)
 	{
@@ -598,8 +959,27 @@ FHoudiniInstanceTranslator::UpdateChangedInstancedOutput(
 	}
 
 	// Keep track of the new instancer component in order to be able to clean up the unused/stale ones after.
+	// Only the output objects of this instanced output's variations can become stale.
 	TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& OutputObjects = InParentOutput->GetOutputObjects();
-	TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject> ToDeleteOutputObjects = InParentOutput->GetOutputObjects();
+	TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject> ToDeleteOutputObjects;
+	const FString VariationSplitPrefix = InOutputIdentifier.SplitIdentifier + TEXT("_");
+	for (const auto& CurrentPair : OutputObjects)
+	{
+		const FHoudiniOutputObjectIdentifier& CurrentIdentifier = CurrentPair.Key;
+		if (CurrentIdentifier.ObjectId != OutputIdentifier.ObjectId
+			|| CurrentIdentifier.GeoId != OutputIdentifier.GeoId
+			|| CurrentIdentifier.PartId != OutputIdentifier.PartId
+			|| !CurrentIdentifier.SplitIdentifier.StartsWith(VariationSplitPrefix))
+			continue;
+
+		ToDeleteOutputObjects.Add(CurrentIdentifier, CurrentPair.Value);
+
+		// Foliage instances that weren't recorded on their output object can't be told apart
+		// from the other instancers' ones, clean them all up before recreating them
+		UHierarchicalInstancedStaticMeshComponent* FoliageHISMC = GetFoliageHISMC(CurrentPair.Value.OutputComponent);
+		if (FoliageHISMC && CurrentPair.Value.FoliageInstanceHashes.Num() <= 0)
+			CleanupFoliageInstances(FoliageHISMC, CurrentPair.Value.OutputObject, InParentComponent);
+	}
 
 	// Create the instancer components now
 	for (int32 InstanceObjectIdx = 0; InstanceObjectIdx < InstancedObjects.Num(); InstanceObjectIdx++)
@@ -631,12 +1011,61 @@ FHoudiniInstanceTranslator::UpdateChangedInstancedOutput(
 			OldInstancerComponent = Cast<USceneComponent>(FoundOutputObject->OutputComponent);
 		}
 
+		// Large variations can be partitioned in cells, with one component per cell
+		if (ShouldPartitionInstancesInCells(
+			InstancedObject, InstancedObjectTransforms, InInstancedOutput.CellSize, bSplitMeshInstancer, bIsFoliageInstancer))
+		{
+			TArray<TPair<FHoudiniOutputObjectIdentifier, USceneComponent*>> CellComponents;
+			if (!CreateOrUpdateInstanceCellComponents(
+				InstancedObject,
+				InstancedObjectTransforms,
+				AllPropertyAttributes,
+				HGPO,
+				InParentComponent,
+				OutputIdentifier,
+				VariationIndices[InstanceObjectIdx],
+				OutputObjects,
+				InInstancedOutput,
+				InstancerMaterials,
+				OriginalInstanceIndices[0],
+				PerInstanceCustomData,
+				NumCustomFloats,
+				CellComponents))
+			{
+				continue;
+			}
+
+			for (const auto& CellPair : CellComponents)
+			{
+				FHoudiniOutputObject& CellOutputObject = OutputObjects.FindOrAdd(CellPair.Key);
+				CellOutputObject.OutputComponent = CellPair.Value;
+				CellOutputObject.OutputObject = InstancedObject;
+
+				// Remove this output object from the todelete map
+				ToDeleteOutputObjects.Remove(CellPair.Key);
+			}
+
+			continue;
+		}
+
+		// This variation isn't partitioned (anymore), forget its cells
+		const int32 VariationIndex = VariationIndices[InstanceObjectIdx];
+		InInstancedOutput.Cells.RemoveAll([VariationIndex](const FHoudiniInstancedOutputCell& Cell)
+		{
+			return Cell.VariationIndex == VariationIndex;
+		});
+
 		// Extract the material for this variation
 //		FHoudiniInstancedOutput* FoundInstancedOutput = InstancedOutputs.Find(OutputIdentifier);
 		TArray<UMaterialInterface*> VariationMaterials;
 		if (!GetVariationMaterials(&InInstancedOutput, InstanceObjectIdx, OriginalInstanceIndices[0], InstancerMaterials, VariationMaterials))
 			VariationMaterials.Empty();
 
+		// The foliage instances owned by this variation's output object
+		TArray<uint32> FoliageInstanceHashes;
+		if (FoundOutputObject)
+			FoliageInstanceHashes = FoundOutputObject->FoliageInstanceHashes;
+
 		USceneComponent* NewInstancerComponent = nullptr;
 		if (!CreateOrUpdateInstanceComponent(
 			InstancedObject,
@@ -651,7 +1080,8 @@ FHoudiniInstanceTranslator::UpdateChangedInstancedOutput(
 			InstancerMaterials,
 			OriginalInstanceIndices[0],
 			InstanceObjectIdx,
-			bForceHISM))
+			bForceHISM,
+			&FoliageInstanceHashes))
 		{
 			// TODO??
 			continue;
@@ -660,10 +1090,19 @@ FHoudiniInstanceTranslator::UpdateChangedInstancedOutput(
 		if (!NewInstancerComponent)
 			continue;
 
+		// Copy the per-instance custom data if we have any
+		if (PerInstanceCustomData && PerInstanceCustomData->Num() > 0)
+			UpdateChangedPerInstanceCustomData(*PerInstanceCustomData, NewInstancerComponent);
+
 		if (OldInstancerComponent != NewInstancerComponent)
 		{
 			// Previous component wasn't reused, detach and delete it
-			RemoveAndDestroyComponent(OldInstancerComponent, nullptr);
+			// Foliage HISMCs are shared, only remove the instances we owned on them
+			UHierarchicalInstancedStaticMeshComponent* OldFoliageHISMC = GetFoliageHISMC(OldInstancerComponent);
+			if (OldFoliageHISMC && FoundOutputObject)
+				CleanupFoliageInstances(OldFoliageHISMC, FoundOutputObject->OutputObject, InParentComponent, &FoundOutputObject->FoliageInstanceHashes);
+			else if (!OldFoliageHISMC)
+				RemoveAndDestroyComponent(OldInstancerComponent, nullptr);
 
 			// Replace it with the new component
 			if (FoundOutputObject)
@@ -677,6 +1116,8 @@ FHoudiniInstanceTranslator::UpdateChangedInstancedOutput(
 			}
 		}
 
+		OutputObjects.FindChecked(OutputIdentifier).FoliageInstanceHashes = FoliageInstanceHashes;
+
 		// Remove this output object from the todelete map
 		ToDeleteOutputObjects.Remove(OutputIdentifier);
 	}
@@ -690,7 +1131,22 @@ FHoudiniInstanceTranslator::UpdateChangedInstancedOutput(
 		UObject* OldComponent = ToDeletePair.Value.OutputComponent;
 		if (OldComponent)
 		{
-			RemoveAndDestroyComponent(OldComponent, ToDeletePair.Value.OutputObject);
+			UHierarchicalInstancedStaticMeshComponent* FoliageHISMC = GetFoliageHISMC(OldComponent);
+			if (FoliageHISMC)
+			{
+				// Foliage HISMCs can still be used by other instancers, only remove the instances we owned
+				// Unrecorded instances have already been removed
+				if (ToDeletePair.Value.FoliageInstanceHashes.Num() > 0)
+					CleanupFoliageInstances(FoliageHISMC, ToDeletePair.Value.OutputObject, InParentComponent, &ToDeletePair.Value.FoliageInstanceHashes);
+			}
+			else
+			{
+				// Keep the actors of stale instanced actor components so they can be reused by the pending spawns
+				if (GetDefault<UHoudiniRuntimeSettings>()->bRecycleInstancedActors)
+					RecycleAllInstanceActors(Cast<UHoudiniInstancedActorComponent>(OldComponent));
+
+				RemoveAndDestroyComponent(OldComponent, ToDeletePair.Value.OutputObject);
+			}
 			ToDeletePair.Value.OutputComponent = nullptr;
 		}
 
@@ -706,6 +1162,12 @@ FHoudiniInstanceTranslator::UpdateChangedInstancedOutput(
 	}
 	ToDeleteOutputObjects.Empty();
 
+	// Rebuild the trees of the foliage we've updated
+	BuildFoliageTrees(OutputObjects);
+
+	// Destroy the instanced actors that have not been reused
+	FlushRecycledInstanceActors();
+
 	return true;
 }
 
@@ -962,6 +1424,10 @@ FHoudiniInstanceTranslator::UpdateInstanceVariationObjects(
 			if (CurInstancedOutput.TransformVariationIndices.Num() != CurInstancedOutput.OriginalTransforms.Num())
 				UpdateVariationAssignements(CurInstancedOutput);
 
+			// Sort the transforms in their variations and apply the transform offsets
+			TArray<TArray<FTransform>> AllProcessedTransforms;
+			ProcessAllInstanceTransforms(CurInstancedOutput, AllProcessedTransforms);
+
 			// Assign variations and their transforms
 			for (int32 VarIdx = 0; VarIdx < CurInstancedOutput.VariationObjects.Num(); VarIdx++)
 			{
@@ -969,13 +1435,15 @@ FHoudiniInstanceTranslator::UpdateInstanceVariationObjects(
 				if (!CurrentVariationObject || CurrentVariationObject->IsPendingKill())
 					continue;
 
+				if (!AllProcessedTransforms.IsValidIndex(VarIdx))
+					continue;
+
 				// Get the transforms assigned to that variation
-				TArray<FTransform> ProcessedTransforms;
-				ProcessInstanceTransforms(CurInstancedOutput, VarIdx, ProcessedTransforms);
+				TArray<FTransform>& ProcessedTransforms = AllProcessedTransforms[VarIdx];
 				if (ProcessedTransforms.Num() > 0)
 				{
 					OutVariationsInstancedObjects.Add(CurrentVariationObject);
-					OutVariationsInstancedTransforms.Add(ProcessedTransforms);
+					OutVariationsInstancedTransforms.Add(MoveTemp(ProcessedTransforms));
 					OutVariationOriginalObjectIdx.Add(InstObjIdx);
 					OutVariationIndices.Add(VarIdx);
 				}
@@ -998,88 +1466,103 @@ FHoudiniInstanceTranslator::UpdateVariationAssignements(FHoudiniInstancedOutput&
 	if (VariationCount <= 1)
 		return;
 
-	int nSeed = 1234;	
-	for (int32 Idx = 0; Idx < TransformCount; Idx++)
+	// The assignments follow the same random sequence as a serial loop seeded with 1234:
+	// each batch jumps ahead to the seed of its first instance so the batches can run in parallel
+	const int nSeedStart = 1234;
+	TArray<int32>& TransformVariationIndices = InstancedOutput.TransformVariationIndices;
+	const int32 NumBatches = FMath::DivideAndRoundUp(TransformCount, HoudiniInstanceBatchSize);
+	ParallelFor(NumBatches, [&TransformVariationIndices, TransformCount, VariationCount, nSeedStart](int32 BatchIdx)
 	{
-		InstancedOutput.TransformVariationIndices[Idx] = fastrand(nSeed) % VariationCount;
-	}	
+		const int32 Start = BatchIdx * HoudiniInstanceBatchSize;
+		const int32 End = FMath::Min(Start + HoudiniInstanceBatchSize, TransformCount);
+
+		int nSeed = fastrand_skip(nSeedStart, Start);
+		for (int32 Idx = Start; Idx < End; Idx++)
+		{
+			TransformVariationIndices[Idx] = fastrand(nSeed) % VariationCount;
+		}
+	});
 }
 
 void
-FHoudiniInstanceTranslator::ProcessInstanceTransforms(
-	FHoudiniInstancedOutput& InstancedOutput, const int32& VariationIdx, TArray<FTransform>& OutProcessedTransforms)
+FHoudiniInstanceTranslator::ProcessAllInstanceTransforms(
+	FHoudiniInstancedOutput& InstancedOutput, TArray<TArray<FTransform>>& OutProcessedTransforms)
 {
-	if (!InstancedOutput.VariationObjects.IsValidIndex(VariationIdx))
-		return;
-
-	if (!InstancedOutput.VariationTransformOffsets.IsValidIndex(VariationIdx))
+	const int32 VariationCount = InstancedOutput.VariationObjects.Num();
+	OutProcessedTransforms.Empty(VariationCount);
+	OutProcessedTransforms.SetNum(VariationCount);
+	if (VariationCount <= 0)
 		return;
 
-	bool bHasVariations = InstancedOutput.VariationObjects.Num() > 1;
-	bool bHasTransformOffset = InstancedOutput.VariationTransformOffsets.IsValidIndex(VariationIdx)
-		? !InstancedOutput.VariationTransformOffsets[VariationIdx].Equals(FTransform::Identity)
-		: false;
-
-	if (!bHasVariations && !bHasTransformOffset)
-	{
-		// We dont have variations or transform offset, so we can reuse the original transforms as is
-		OutProcessedTransforms = InstancedOutput.OriginalTransforms;
-		return;
-	}
+	const TArray<FTransform>& OriginalTransforms = InstancedOutput.OriginalTransforms;
+	const TArray<int32>& TransformVariationIndices = InstancedOutput.TransformVariationIndices;
+	const int32 TransformCount = OriginalTransforms.Num();
 
-	if (bHasVariations)
-	{
-		// We simply need to extract the transforms for this variation		
-		for (int32 TransformIndex = 0; TransformIndex < InstancedOutput.TransformVariationIndices.Num(); TransformIndex++)
-		{
-			if (InstancedOutput.TransformVariationIndices[TransformIndex] != VariationIdx)
-				continue;
-
-			OutProcessedTransforms.Add(InstancedOutput.OriginalTransforms[TransformIndex]);
-		}
-	}
-	else
+	if (VariationCount == 1)
 	{
 		// No variations, we can reuse the original transforms
-		OutProcessedTransforms = InstancedOutput.OriginalTransforms;
+		OutProcessedTransforms[0] = OriginalTransforms;
 	}
-
-	if (bHasTransformOffset)
+	else if (TransformVariationIndices.Num() == TransformCount)
 	{
-		// Get the transform offset for this variation
-		FVector PositionOffset = InstancedOutput.VariationTransformOffsets[VariationIdx].GetLocation();
-		FQuat RotationOffset = InstancedOutput.VariationTransformOffsets[VariationIdx].GetRotation();
-		FVector ScaleOffset = InstancedOutput.VariationTransformOffsets[VariationIdx].GetScale3D();
-
-		FTransform CurrentTransform = FTransform::Identity;
-		for (int32 TransformIndex = 0; TransformIndex < OutProcessedTransforms.Num(); TransformIndex++)
+		// Parallel counting sort of the transforms in one bucket per variation:
+		// count the instances of each variation per batch, compute each batch's offset
+		// in the buckets, then scatter the transforms. The original order is preserved in each bucket.
+		const int32 NumBatches = FMath::DivideAndRoundUp(TransformCount, HoudiniInstanceBatchSize);
+		TArray<int32> BatchCounts;
+		BatchCounts.SetNumZeroed(NumBatches * VariationCount);
+		ParallelFor(NumBatches, [&](int32 BatchIdx)
 		{
-			CurrentTransform = OutProcessedTransforms[TransformIndex];
+			const int32 Start = BatchIdx * HoudiniInstanceBatchSize;
+			const int32 End = FMath::Min(Start + HoudiniInstanceBatchSize, TransformCount);
+			int32* Counts = BatchCounts.GetData() + BatchIdx * VariationCount;
+			for (int32 Idx = Start; Idx < End; Idx++)
+			{
+				const int32 VarIdx = TransformVariationIndices[Idx];
+				if (VarIdx >= 0 && VarIdx < VariationCount)
+					Counts[VarIdx]++;
+			}
+		});
 
-			// Compute new rotation and scale.
-			FVector Position = CurrentTransform.GetLocation() + PositionOffset;
-			FQuat TransformRotation = CurrentTransform.GetRotation() * RotationOffset;
-			FVector TransformScale3D = CurrentTransform.GetScale3D() * ScaleOffset;
+		TArray<int32> BatchOffsets;
+		BatchOffsets.SetNumUninitialized(NumBatches * VariationCount);
+		for (int32 VarIdx = 0; VarIdx < VariationCount; VarIdx++)
+		{
+			int32 VariationTotal = 0;
+			for (int32 BatchIdx = 0; BatchIdx < NumBatches; BatchIdx++)
+			{
+				BatchOffsets[BatchIdx * VariationCount + VarIdx] = VariationTotal;
+				VariationTotal += BatchCounts[BatchIdx * VariationCount + VarIdx];
+			}
 
-			// Make sure inverse matrix exists - seems to be a bug in Unreal when submitting instances.
-			// Happens in blueprint as well.
-			// We want to make sure the scale is not too small, but keep negative values! (Bug 90876)
-			if (FMath::Abs(TransformScale3D.X) < HAPI_UNREAL_SCALE_SMALL_VALUE)
-				TransformScale3D.X = (TransformScale3D.X > 0) ? HAPI_UNREAL_SCALE_SMALL_VALUE : -HAPI_UNREAL_SCALE_SMALL_VALUE;
+			OutProcessedTransforms[VarIdx].SetNumUninitialized(VariationTotal);
+		}
 
-			if (FMath::Abs(TransformScale3D.Y) < HAPI_UNREAL_SCALE_SMALL_VALUE)
-				TransformScale3D.Y = (TransformScale3D.Y > 0) ? HAPI_UNREAL_SCALE_SMALL_VALUE : -HAPI_UNREAL_SCALE_SMALL_VALUE;
+		ParallelFor(NumBatches, [&](int32 BatchIdx)
+		{
+			const int32 Start = BatchIdx * HoudiniInstanceBatchSize;
+			const int32 End = FMath::Min(Start + HoudiniInstanceBatchSize, TransformCount);
+			int32* Offsets = BatchOffsets.GetData() + BatchIdx * VariationCount;
+			for (int32 Idx = Start; Idx < End; Idx++)
+			{
+				const int32 VarIdx = TransformVariationIndices[Idx];
+				if (VarIdx >= 0 && VarIdx < VariationCount)
+					OutProcessedTransforms[VarIdx][Offsets[VarIdx]++] = OriginalTransforms[Idx];
+			}
+		});
+	}
 
-			if (FMath::Abs(TransformScale3D.Z) < HAPI_UNREAL_SCALE_SMALL_VALUE)
-				TransformScale3D.Z = (TransformScale3D.Z > 0) ? HAPI_UNREAL_SCALE_SMALL_VALUE : -HAPI_UNREAL_SCALE_SMALL_VALUE;
+	// Apply the transform offsets
+	for (int32 VarIdx = 0; VarIdx < VariationCount; VarIdx++)
+	{
+		if (!InstancedOutput.VariationTransformOffsets.IsValidIndex(VarIdx))
+			continue;
 
-			CurrentTransform.SetLocation(Position);
-			CurrentTransform.SetRotation(TransformRotation);
-			CurrentTransform.SetScale3D(TransformScale3D);
+		const FTransform& TransformOffset = InstancedOutput.VariationTransformOffsets[VarIdx];
+		if (TransformOffset.Equals(FTransform::Identity))
+			continue;
 
-			if (CurrentTransform.IsValid())
-				OutProcessedTransforms[TransformIndex] = CurrentTransform;
-		}
+		ApplyVariationTransformOffset(TransformOffset, OutProcessedTransforms[VarIdx]);
 	}
 }
 
@@ -1105,12 +1588,7 @@ FHoudiniInstanceTranslator::GetPackedPrimitiveInstancerHGPOsAndTransforms(
 
 	// Convert the transform to Unreal's coordinate system
 	TArray<FTransform> InstancerUnrealTransforms;
-	InstancerUnrealTransforms.SetNumUninitialized(InstancerPartTransforms.Num());
-	for (int32 InstanceIdx = 0; InstanceIdx < InstancerPartTransforms.Num(); InstanceIdx++)
-	{
-		const auto& InstanceTransform = InstancerPartTransforms[InstanceIdx];
-		FHoudiniEngineUtils::TranslateHapiTransform(InstanceTransform, InstancerUnrealTransforms[InstanceIdx]);
-	}
+	ConvertHapiInstanceTransforms(InstancerPartTransforms, InstancerUnrealTransforms);
 
 	// Get the part ids for parts being instanced
 	TArray<HAPI_PartId> InstancedPartIds;
@@ -1797,7 +2275,8 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstanceComponent(
 	const TArray<UMaterialInterface *>& InstancerMaterials,
 	const TArray<int32>& OriginalInstancerObjectIndices,
 	const int32& InstancerObjectIdx,
-	const bool& bForceHISM)
+	const bool& bForceHISM,
+	TArray<uint32>* InOutFoliageInstanceHashes)
 {
 	enum InstancerComponentType
 	{
@@ -1933,7 +2412,7 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstanceComponent(
 		case Foliage:
 		{
 			bSuccess = CreateOrUpdateFoliageInstances(
-				StaticMesh, FoliageType, InstancedObjectTransforms, FirstOriginalIndex, AllPropertyAttributes, InstancerGeoPartObject, ParentComponent, NewComponent, InstancerMaterial);
+				StaticMesh, FoliageType, InstancedObjectTransforms, FirstOriginalIndex, AllPropertyAttributes, InstancerGeoPartObject, ParentComponent, NewComponent, InstancerMaterial, InOutFoliageInstanceHashes);
 		}
 	}
 
@@ -1961,6 +2440,284 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstanceComponent(
 	return bSuccess;
 }
 
+bool
+FHoudiniInstanceTranslator::ShouldPartitionInstancesInCells(
+	UObject* InstancedObject,
+	const TArray<FTransform>& InstancedObjectTransforms,
+	const float& InCellSize,
+	const bool& InIsSplitMeshInstancer,
+	const bool& InIsFoliageInstancer)
+{
+	if (InCellSize <= 0.0f)
+		return false;
+
+	// Only ISMC/HISMC instancers are partitioned, 
+	// foliage and split instancers manage their components differently
+	if (InIsSplitMeshInstancer || InIsFoliageInstancer)
+		return false;
+
+	if (!IsValid(InstancedObject) || !InstancedObject->IsA<UStaticMesh>())
+		return false;
+
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	const int32 MinInstances = HoudiniRuntimeSettings ? FMath::Max(HoudiniRuntimeSettings->InstancerCellMinInstances, 2) : 2;
+
+	return InstancedObjectTransforms.Num() >= MinInstances;
+}
+
+void
+FHoudiniInstanceTranslator::PartitionInstanceTransformsInCells(
+	const TArray<FTransform>& InTransforms,
+	const float& InCellSize,
+	TArray<FIntVector>& OutCellCoords,
+	TArray<TArray<int32>>& OutCellTransformIndices)
+{
+	OutCellCoords.Empty();
+	OutCellTransformIndices.Empty();
+
+	const int32 NumTransforms = InTransforms.Num();
+	if (NumTransforms <= 0 || InCellSize <= 0.0f)
+		return;
+
+	// Compute the cell of each instance
+	const float InvCellSize = 1.0f / InCellSize;
+	TArray<FIntVector> TransformCells;
+	TransformCells.SetNumUninitialized(NumTransforms);
+	ParallelFor(NumTransforms, [&InTransforms, &TransformCells, InvCellSize](int32 TransformIdx)
+	{
+		const FVector Location = InTransforms[TransformIdx].GetLocation() * InvCellSize;
+		TransformCells[TransformIdx] = FIntVector(
+			FMath::FloorToInt(Location.X), FMath::FloorToInt(Location.Y), FMath::FloorToInt(Location.Z));
+	});
+
+	// Assign an index to each non-empty cell and count their instances
+	TMap<FIntVector, int32> CellIndices;
+	TArray<int32> TransformCellIndices;
+	TArray<int32> CellCounts;
+	TransformCellIndices.SetNumUninitialized(NumTransforms);
+	for (int32 TransformIdx = 0; TransformIdx < NumTransforms; TransformIdx++)
+	{
+		const FIntVector& Cell = TransformCells[TransformIdx];
+		int32* FoundCellIndex = CellIndices.Find(Cell);
+		if (!FoundCellIndex)
+		{
+			FoundCellIndex = &CellIndices.Add(Cell, OutCellCoords.Add(Cell));
+			CellCounts.Add(0);
+		}
+
+		TransformCellIndices[TransformIdx] = *FoundCellIndex;
+		CellCounts[*FoundCellIndex]++;
+	}
+
+	// Counting sort the transforms in their cells, preserving their order
+	OutCellTransformIndices.SetNum(OutCellCoords.Num());
+	for (int32 CellIdx = 0; CellIdx < OutCellCoords.Num(); CellIdx++)
+		OutCellTransformIndices[CellIdx].Reserve(CellCounts[CellIdx]);
+
+	for (int32 TransformIdx = 0; TransformIdx < NumTransforms; TransformIdx++)
+		OutCellTransformIndices[TransformCellIndices[TransformIdx]].Add(TransformIdx);
+}
+
+// Hash of the generic property attributes applied to the instancer components
+static uint32
+GetPropertyAttributesHash(const TArray<FHoudiniGenericAttribute>& InPropertyAttributes, uint32 InHash)
+{
+	uint32 Hash = HashCombine(InHash, GetTypeHash(InPropertyAttributes.Num()));
+	for (const FHoudiniGenericAttribute& Attribute : InPropertyAttributes)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Attribute.AttributeName));
+		Hash = HashCombine(Hash, GetTypeHash((int32)Attribute.AttributeType));
+		Hash = HashCombine(Hash, GetTypeHash((int32)Attribute.AttributeOwner));
+		Hash = HashCombine(Hash, GetTypeHash(Attribute.AttributeTupleSize));
+		Hash = FCrc::MemCrc32(Attribute.DoubleValues.GetData(), Attribute.DoubleValues.Num() * sizeof(double), Hash);
+		Hash = FCrc::MemCrc32(Attribute.IntValues.GetData(), Attribute.IntValues.Num() * sizeof(int64), Hash);
+		for (const FString& StringValue : Attribute.StringValues)
+			Hash = HashCombine(Hash, GetTypeHash(StringValue));
+	}
+
+	return Hash;
+}
+
+FString
+FHoudiniInstanceTranslator::GetInstanceCellSplitIdentifier(
+	const FString& InVariationSplitIdentifier, const FIntVector& InCellCoord)
+{
+	return FString::Printf(TEXT("%s_c%d_%d_%d"), *InVariationSplitIdentifier, InCellCoord.X, InCellCoord.Y, InCellCoord.Z);
+}
+
+bool
+FHoudiniInstanceTranslator::CreateOrUpdateInstanceCellComponents(
+	UObject* InstancedObject,
+	const TArray<FTransform>& InstancedObjectTransforms,
+	const TArray<FHoudiniGenericAttribute>& AllPropertyAttributes,
+	const FHoudiniGeoPartObject& InstancerGeoPartObject,
+	USceneComponent* ParentComponent,
+	const FHoudiniOutputObjectIdentifier& InVariationIdentifier,
+	const int32& InVariationIndex,
+	const TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& InOldOutputObjects,
+	FHoudiniInstancedOutput& InOutInstancedOutput,
+	const TArray<UMaterialInterface *>& InstancerMaterials,
+	const TArray<int32>& OriginalInstancerObjectIndices,
+	const TArray<float>* InPerInstanceCustomData,
+	const int32& InNumCustomFloats,
+	TArray<TPair<FHoudiniOutputObjectIdentifier, USceneComponent*>>& OutCellComponents)
+{
+	UStaticMesh* InstancedStaticMesh = Cast<UStaticMesh>(InstancedObject);
+	if (!IsValid(InstancedStaticMesh))
+		return false;
+
+	if (!IsValid(ParentComponent))
+		return false;
+
+	// Sort the instances in their cells
+	TArray<FIntVector> CellCoords;
+	TArray<TArray<int32>> CellTransformIndices;
+	PartitionInstanceTransformsInCells(InstancedObjectTransforms, InOutInstancedOutput.CellSize, CellCoords, CellTransformIndices);
+
+	const int32 NumCells = CellCoords.Num();
+	if (NumCells <= 0)
+		return false;
+
+	// The per instance custom data can only be split if it matches the transforms
+	int32 NumCustomFloats = 0;
+	if (InPerInstanceCustomData && InNumCustomFloats > 0
+		&& InPerInstanceCustomData->Num() == InstancedObjectTransforms.Num() * InNumCustomFloats)
+	{
+		NumCustomFloats = InNumCustomFloats;
+	}
+
+	// Only one material can be used per component, it is hashed along with the instances, the cell size,
+	// the properties applied to the components and the number of custom floats
+	UMaterialInterface* InstancerMaterial = InstancerMaterials.Num() > 0 ? InstancerMaterials[0] : nullptr;
+	uint32 ObjectHash = HashCombine(PointerHash(InstancedStaticMesh), PointerHash(InstancerMaterial));
+	ObjectHash = HashCombine(ObjectHash, GetTypeHash(InOutInstancedOutput.CellSize));
+	ObjectHash = HashCombine(ObjectHash, GetTypeHash(NumCustomFloats));
+	ObjectHash = GetPropertyAttributesHash(AllPropertyAttributes, ObjectHash);
+
+	// Gather the transforms, custom data and hash of each cell in parallel
+	TArray<TArray<FTransform>> CellTransforms;
+	TArray<TArray<float>> CellCustomData;
+	TArray<TArray<int32>> CellOriginalIndices;
+	TArray<uint32> CellHashes;
+	CellTransforms.SetNum(NumCells);
+	CellCustomData.SetNum(NumCells);
+	CellOriginalIndices.SetNum(NumCells);
+	CellHashes.SetNumZeroed(NumCells);
+	ParallelFor(NumCells, [&](int32 CellIdx)
+	{
+		const TArray<int32>& TransformIndices = CellTransformIndices[CellIdx];
+		TArray<FTransform>& Transforms = CellTransforms[CellIdx];
+		TArray<float>& CustomData = CellCustomData[CellIdx];
+		TArray<int32>& OriginalIndices = CellOriginalIndices[CellIdx];
+		Transforms.Reserve(TransformIndices.Num());
+		CustomData.Reserve(TransformIndices.Num() * NumCustomFloats);
+		OriginalIndices.Reserve(TransformIndices.Num());
+
+		uint32 Hash = ObjectHash;
+		for (const int32& TransformIdx : TransformIndices)
+		{
+			const FTransform& CurTransform = InstancedObjectTransforms[TransformIdx];
+			Transforms.Add(CurTransform);
+
+			// Hash the transform components and not the raw FTransform as it might contain padding
+			const FVector Location = CurTransform.GetLocation();
+			const FQuat Rotation = CurTransform.GetRotation();
+			const FVector Scale = CurTransform.GetScale3D();
+			Hash = FCrc::MemCrc32(&Location, sizeof(FVector), Hash);
+			Hash = FCrc::MemCrc32(&Rotation, sizeof(FQuat), Hash);
+			Hash = FCrc::MemCrc32(&Scale, sizeof(FVector), Hash);
+
+			if (NumCustomFloats > 0)
+			{
+				const float* InstanceCustomData = InPerInstanceCustomData->GetData() + TransformIdx * NumCustomFloats;
+				CustomData.Append(InstanceCustomData, NumCustomFloats);
+				Hash = FCrc::MemCrc32(InstanceCustomData, NumCustomFloats * sizeof(float), Hash);
+			}
+
+			OriginalIndices.Add(OriginalInstancerObjectIndices.IsValidIndex(TransformIdx) ? OriginalInstancerObjectIndices[TransformIdx] : 0);
+		}
+
+		CellHashes[CellIdx] = Hash;
+	});
+
+	// Previous cells for this variation
+	TMap<FIntVector, uint32> PreviousCellHashes;
+	for (const FHoudiniInstancedOutputCell& Cell : InOutInstancedOutput.Cells)
+	{
+		if (Cell.VariationIndex == InVariationIndex)
+			PreviousCellHashes.Add(Cell.Coord, Cell.Hash);
+	}
+
+	InOutInstancedOutput.Cells.RemoveAll([InVariationIndex](const FHoudiniInstancedOutputCell& Cell)
+	{
+		return Cell.VariationIndex == InVariationIndex;
+	});
+
+	int32 NumUpdatedCells = 0;
+	for (int32 CellIdx = 0; CellIdx < NumCells; CellIdx++)
+	{
+		const FIntVector& CellCoord = CellCoords[CellIdx];
+
+		FHoudiniOutputObjectIdentifier CellIdentifier = InVariationIdentifier;
+		CellIdentifier.SplitIdentifier = GetInstanceCellSplitIdentifier(InVariationIdentifier.SplitIdentifier, CellCoord);
+
+		USceneComponent* OldCellComponent = nullptr;
+		const FHoudiniOutputObject* FoundOutputObject = InOldOutputObjects.Find(CellIdentifier);
+		if (FoundOutputObject)
+			OldCellComponent = Cast<USceneComponent>(FoundOutputObject->OutputComponent);
+
+		// If the cell hasn't changed since the previous cook, we can reuse its component as is
+		const uint32* PreviousHash = PreviousCellHashes.Find(CellCoord);
+		USceneComponent* NewCellComponent = nullptr;
+		if (PreviousHash && *PreviousHash == CellHashes[CellIdx] && IsValid(OldCellComponent))
+		{
+			NewCellComponent = OldCellComponent;
+		}
+		else
+		{
+			if (!CreateOrUpdateInstanceComponent(
+				InstancedObject,
+				CellTransforms[CellIdx],
+				AllPropertyAttributes,
+				InstancerGeoPartObject,
+				ParentComponent,
+				OldCellComponent,
+				NewCellComponent,
+				false,
+				false,
+				InstancerMaterials,
+				CellOriginalIndices[CellIdx],
+				0,
+				true))
+			{
+				continue;
+			}
+
+			if (!NewCellComponent)
+				continue;
+
+			if (NumCustomFloats > 0)
+				UpdateChangedPerInstanceCustomData(CellCustomData[CellIdx], NewCellComponent);
+
+			NumUpdatedCells++;
+		}
+
+		FHoudiniInstancedOutputCell& NewCell = InOutInstancedOutput.Cells.AddDefaulted_GetRef();
+		NewCell.Coord = CellCoord;
+		NewCell.VariationIndex = InVariationIndex;
+		NewCell.NumInstances = CellTransforms[CellIdx].Num();
+		NewCell.Hash = CellHashes[CellIdx];
+
+		OutCellComponents.Add(TPair<FHoudiniOutputObjectIdentifier, USceneComponent*>(CellIdentifier, NewCellComponent));
+	}
+
+	HOUDINI_LOG_HELPER(Verbose,
+		TEXT("Instancer %s: %d instances partitioned in %d cells, %d cells updated."),
+		*InVariationIdentifier.SplitIdentifier, InstancedObjectTransforms.Num(), NumCells, NumUpdatedCells);
+
+	return OutCellComponents.Num() > 0;
+}
+
 bool
 FHoudiniInstanceTranslator::CreateOrUpdateInstancedStaticMeshComponent(
 	UStaticMesh* InstancedStaticMesh,
@@ -2077,12 +2834,24 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 	if (!InstancedActorComponent)
 		return false;
 
+	const bool bRecycleActors = GetDefault<UHoudiniRuntimeSettings>()->bRecycleInstancedActors;
+
+	// Any spawn still pending for this component is outdated
+	TArray<FHoudiniPendingInstanceActorSpawn>& PendingInstanceActorSpawns = FHoudiniEngine::Get().GetPendingInstanceActorSpawns();
+	PendingInstanceActorSpawns.RemoveAll([InstancedActorComponent](const FHoudiniPendingInstanceActorSpawn& InPending)
+	{
+		return InPending.IAC.Get() == InstancedActorComponent;
+	});
+
 	// See if the instanced object has changed
 	bool bInstancedObjectHasChanged = (InstancedObject != InstancedActorComponent->GetInstancedObject());
 	if (bInstancedObjectHasChanged)
 	{
 		// All actors will need to be respawned, invalidate all of them
-		InstancedActorComponent->ClearAllInstances();
+		if (bRecycleActors)
+			RecycleAllInstanceActors(InstancedActorComponent);
+		else
+			InstancedActorComponent->ClearAllInstances();
 
 		// Update the HIAC's instanced asset
 		InstancedActorComponent->SetInstancedObject(InstancedObject);
@@ -2094,8 +2863,18 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 		return false;
 
 	// Set the number of needed instances
+	if (bRecycleActors)
+	{
+		// Keep the extra actors for reuse
+		TArray<AActor*> ReleasedActors;
+		InstancedActorComponent->ReleaseInstances(InstancedObjectTransforms.Num(), ReleasedActors);
+		for (AActor* CurrentActor : ReleasedActors)
+			RecycleInstanceActor(InstancedActorComponent, InstancedObject, CurrentActor);
+	}
 	InstancedActorComponent->SetNumberOfInstances(InstancedObjectTransforms.Num());
 
+	TSharedPtr<TArray<FHoudiniGenericAttribute>> PendingPropertyAttributes;
+	int32 NumRecycled = 0;
 	for (int32 Idx = 0; Idx < InstancedObjectTransforms.Num(); Idx++)
 	{
 		// if we already have an actor, we can reuse it
@@ -2106,7 +2885,33 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 		AActor* CurInstance = InstancedActorComponent->GetInstancedActorAt(Idx);
 		if (!CurInstance || CurInstance->IsPendingKill())
 		{
-			CurInstance = SpawnInstanceActor(CurTransform, SpawnLevel, InstancedActorComponent);
+			// Try to reuse an actor that has been released first
+			CurInstance = bRecycleActors ? AcquireRecycledInstanceActor(InstancedActorComponent, InstancedObject) : nullptr;
+			if (CurInstance)
+			{
+				NumRecycled++;
+			}
+			else if (IsInstanceActorSpawnBudgetExceeded())
+			{
+				// Postpone the spawn to the next ticks
+				if (!PendingPropertyAttributes.IsValid())
+					PendingPropertyAttributes = MakeShared<TArray<FHoudiniGenericAttribute>>(AllPropertyAttributes);
+
+				FHoudiniPendingInstanceActorSpawn PendingSpawn;
+				PendingSpawn.IAC = InstancedActorComponent;
+				PendingSpawn.SpawnLevel = SpawnLevel;
+				PendingSpawn.InstanceIndex = Idx;
+				PendingSpawn.OriginalIndex = OriginalInstancerObjectIndices[Idx];
+				PendingSpawn.Transform = CurTransform;
+				PendingSpawn.PropertyAttributes = PendingPropertyAttributes;
+				PendingInstanceActorSpawns.Add(PendingSpawn);
+				continue;
+			}
+			else
+			{
+				CurInstance = SpawnInstanceActorWithinBudget(CurTransform, SpawnLevel, InstancedActorComponent);
+			}
+
 			InstancedActorComponent->SetInstanceAt(Idx, CurTransform, CurInstance);
 		}
 		else
@@ -2119,6 +2924,9 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 		UpdateGenericPropertiesAttributes(CurInstance, AllPropertyAttributes, OriginalInstancerObjectIndices[Idx]);
 	}
 
+	if (NumRecycled > 0)
+		HOUDINI_LOG_MESSAGE(TEXT("Reused %d instanced actor(s) of %s."), NumRecycled, *InstancedObject->GetName());
+
 	// Assign the new ISMC / HISMC to the output component if we created a new one
 	if (bCreatedNewComponent)
 	{
@@ -2460,7 +3268,8 @@ FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
 	const FHoudiniGeoPartObject& InstancerGeoPartObject,
 	USceneComponent* ParentComponent,
 	USceneComponent*& NewInstancedComponent,
-	UMaterialInterface * InstancerMaterial /*=nullptr*/)
+	UMaterialInterface * InstancerMaterial /*=nullptr*/,
+	TArray<uint32>* InOutFoliageInstanceHashes /*=nullptr*/)
 {
 	// We need either a valid SM or a valid Foliage Type
 	if ((!InstancedStaticMesh || InstancedStaticMesh->IsPendingKill())
@@ -2515,25 +3324,26 @@ FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
 		bCreatedNew = true;
 	}
 
-	if (!bCreatedNew && NewInstancedComponent)
-	{
-		// TODO: Shouldnt be needed anymore
-		// Clean up the instances previously generated for that component
-		InstancedFoliageActor->DeleteInstancesForComponent(ParentComponent, FoliageType);
-	}
-
- 	// Get the FoliageMeshInfo for this Foliage type so we can add the instance to it
+	// Get the FoliageMeshInfo for this Foliage type so we can add the instance to it
 	FFoliageInfo* FoliageInfo = InstancedFoliageActor->FindOrAddMesh(FoliageType);
 	if (!FoliageInfo)
 		return false;
 
-	FTransform HoudiniAssetTransform = ParentComponent->GetComponentTransform();
-	FFoliageInstance FoliageInstance;
-	int32 CurrentInstanceCount = 0;
+	// The owned instances are only valid if they were created for the same foliage type
+	const bool bOwnsPreviousInstances = InOutFoliageInstanceHashes
+		&& InOutFoliageInstanceHashes->Num() > 0
+		&& NewInstancedComponent
+		&& NewInstancedComponent == FoliageInfo->GetComponent();
 
-	FoliageInfo->ReserveAdditionalInstances(InstancedFoliageActor, FoliageType, InstancedObjectTransforms.Num());
-	for (auto CurrentTransform : InstancedObjectTransforms)
+	// Build the foliage instances in parallel
+	FTransform HoudiniAssetTransform = ParentComponent->GetComponentTransform();
+	TArray<FFoliageInstance> FoliageInstances;
+	FoliageInstances.SetNum(InstancedObjectTransforms.Num());
+	ParallelFor(InstancedObjectTransforms.Num(), [&](int32 Idx)
 	{
+		const FTransform& CurrentTransform = InstancedObjectTransforms[Idx];
+		FFoliageInstance& FoliageInstance = FoliageInstances[Idx];
+
 		// Use our parent component for the base component of the instances,
 		// this will allow us to clean the instances by component
 		FoliageInstance.BaseComponent = ParentComponent;
@@ -2553,17 +3363,42 @@ FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
 			FoliageInstance.Rotation = HoudiniAssetTransform.TransformRotation(CurrentTransform.GetRotation()).Rotator();
 			FoliageInstance.DrawScale3D = CurrentTransform.GetScale3D() * HoudiniAssetTransform.GetScale3D();
 		}
+	});
 
-		FoliageInfo->AddInstance(InstancedFoliageActor, FoliageType, FoliageInstance);
-		CurrentInstanceCount++;
+	// Remove the instances we previously generated whose transforms have changed,
+	// and only add the instances that don't exist yet
+	TBitArray<> ExistingInstances(false, FoliageInstances.Num());
+	if (!bCreatedNew && bOwnsPreviousInstances)
+		RemoveChangedFoliageInstances(InstancedFoliageActor, FoliageType, ParentComponent, FoliageInstances, *InOutFoliageInstanceHashes, ExistingInstances);
+
+	TArray<const FFoliageInstance*> InstancesToAdd;
+	InstancesToAdd.Reserve(FoliageInstances.Num());
+	for (int32 Idx = 0; Idx < FoliageInstances.Num(); Idx++)
+	{
+		if (!ExistingInstances[Idx])
+			InstancesToAdd.Add(&FoliageInstances[Idx]);
+	}
+
+	// Add all the new instances at once, the tree will be rebuilt once all the instancers have been updated
+	if (InstancesToAdd.Num() > 0)
+	{
+		FoliageInfo->ReserveAdditionalInstances(InstancedFoliageActor, FoliageType, InstancesToAdd.Num());
+		FoliageInfo->AddInstances(InstancedFoliageActor, FoliageType, InstancesToAdd);
+	}
+
+	// Record the instances we now own, so the next update doesn't touch the other instancers' ones
+	if (InOutFoliageInstanceHashes)
+	{
+		InOutFoliageInstanceHashes->SetNumUninitialized(FoliageInstances.Num());
+		ParallelFor(FoliageInstances.Num(), [&](int32 Idx)
+		{
+			(*InOutFoliageInstanceHashes)[Idx] = GetFoliageInstanceHash(FoliageInstances[Idx]);
+		});
 	}
 
 	UHierarchicalInstancedStaticMeshComponent* FoliageHISMC = FoliageInfo->GetComponent();	
 	if (IsValid(FoliageHISMC))
 	{
-		// TODO: This was due to a bug in UE4.22-20, check if still needed! 
-		FoliageHISMC->BuildTreeIfOutdated(true, true);
-
 		if (InstancerMaterial)
 		{
 			FoliageHISMC->OverrideMaterials.Empty();
@@ -2599,11 +3434,9 @@ FHoudiniInstanceTranslator::HapiGetInstanceTransforms(
 	if (PointCount <= 0)
 		return false;
 
+	// The transforms are entirely filled by HAPI, no need to initialize them
 	TArray<HAPI_Transform> InstanceTransforms;
-	InstanceTransforms.SetNum(PointCount);
-	for (int32 Idx = 0; Idx < InstanceTransforms.Num(); Idx++)
-		FHoudiniApi::Transform_Init(&(InstanceTransforms[Idx]));
-
+	InstanceTransforms.SetNumUninitialized(PointCount);
 	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetInstanceTransformsOnPart(
 		FHoudiniEngine::Get().GetSession(),
 		InHGPO.GeoId, InHGPO.PartId, HAPI_SRT,
@@ -2616,12 +3449,7 @@ FHoudiniInstanceTranslator::HapiGetInstanceTransforms(
 	}
 
 	// Convert the transform to Unreal's coordinate system
-	OutInstancerUnrealTransforms.SetNumZeroed(InstanceTransforms.Num());
-	for (int32 InstanceIdx = 0; InstanceIdx < InstanceTransforms.Num(); InstanceIdx++)
-	{
-		const auto& InstanceTransform = InstanceTransforms[InstanceIdx];
-		FHoudiniEngineUtils::TranslateHapiTransform(InstanceTransform, OutInstancerUnrealTransforms[InstanceIdx]);
-	}
+	ConvertHapiInstanceTransforms(InstanceTransforms, OutInstancerUnrealTransforms);
 
 	return true;
 }
@@ -2999,12 +3827,70 @@ FHoudiniInstanceTranslator::SpawnInstanceActor(
 	return NewActor;
 }
 
+void
+FHoudiniInstanceTranslator::TickPendingInstanceActorSpawns()
+{
+	TArray<FHoudiniPendingInstanceActorSpawn>& PendingInstanceActorSpawns = FHoudiniEngine::Get().GetPendingInstanceActorSpawns();
+	if (PendingInstanceActorSpawns.Num() <= 0)
+		return;
+
+	int32 NumProcessed = 0;
+	for (; NumProcessed < PendingInstanceActorSpawns.Num(); NumProcessed++)
+	{
+		if (IsInstanceActorSpawnBudgetExceeded())
+			break;
+
+		const FHoudiniPendingInstanceActorSpawn& PendingSpawn = PendingInstanceActorSpawns[NumProcessed];
+		UHoudiniInstancedActorComponent* IAC = PendingSpawn.IAC.Get();
+		if (!IAC || IAC->IsPendingKill())
+			continue;
+
+		// Make sure the slot still needs an actor
+		if (!IAC->GetInstancedActorsForWrite().IsValidIndex(PendingSpawn.InstanceIndex))
+			continue;
+
+		AActor* CurInstance = IAC->GetInstancedActorAt(PendingSpawn.InstanceIndex);
+		if (CurInstance && !CurInstance->IsPendingKill())
+			continue;
+
+		CurInstance = AcquireRecycledInstanceActor(IAC, IAC->GetInstancedObject());
+		if (!CurInstance)
+		{
+			ULevel* SpawnLevel = PendingSpawn.SpawnLevel.Get();
+			if (!SpawnLevel)
+				continue;
+
+			CurInstance = SpawnInstanceActorWithinBudget(PendingSpawn.Transform, SpawnLevel, IAC);
+		}
+
+		if (!IAC->SetInstanceAt(PendingSpawn.InstanceIndex, PendingSpawn.Transform, CurInstance))
+			continue;
+
+		if (PendingSpawn.PropertyAttributes.IsValid())
+			UpdateGenericPropertiesAttributes(CurInstance, *PendingSpawn.PropertyAttributes, PendingSpawn.OriginalIndex);
+	}
+
+	PendingInstanceActorSpawns.RemoveAt(0, NumProcessed);
+
+	// Destroy the released actors that weren't needed once everything has been spawned
+	FlushRecycledInstanceActors();
+}
+
+void
+FHoudiniInstanceTranslator::ResetPendingInstanceActorSpawns()
+{
+	// Drop the pending spawns, then destroy the released actors that are still valid
+	FHoudiniEngine::Get().GetPendingInstanceActorSpawns().Empty();
+	FlushRecycledInstanceActors();
+}
+
 
 void 
 FHoudiniInstanceTranslator::CleanupFoliageInstances(
 	UHierarchicalInstancedStaticMeshComponent* InFoliageHISMC,
 	UObject* InInstancedObject,
-	USceneComponent* InParentComponent)
+	USceneComponent* InParentComponent,
+	const TArray<uint32>* InOwnedInstanceHashes /*=nullptr*/)
 {
 	if (!InFoliageHISMC || InFoliageHISMC->IsPendingKill())
 		return;
@@ -3031,7 +3917,20 @@ FHoudiniInstanceTranslator::CleanupFoliageInstances(
 	}
 
 	// Clean up the instances previously generated for that component
-	InstancedFoliageActor->DeleteInstancesForComponent(InParentComponent, FoliageType);
+	if (InOwnedInstanceHashes && InOwnedInstanceHashes->Num() > 0)
+	{
+		// Only remove the instances we own, the foliage type can be shared with other instancers
+		TBitArray<> ExistingInstances;
+		RemoveChangedFoliageInstances(
+			InstancedFoliageActor, FoliageType, InParentComponent, TArray<FFoliageInstance>(), *InOwnedInstanceHashes, ExistingInstances);
+
+		if (InFoliageHISMC->GetInstanceCount() > 0)
+			InFoliageHISMC->BuildTreeIfOutdated(true, true);
+	}
+	else
+	{
+		InstancedFoliageActor->DeleteInstancesForComponent(InParentComponent, FoliageType);
+	}
 
 	// Remove the foliage type if it doesn't have any more instances
 	if(InFoliageHISMC->GetInstanceCount() == 0)
@@ -3040,6 +3939,114 @@ FHoudiniInstanceTranslator::CleanupFoliageInstances(
 	return;
 }
 
+void
+FHoudiniInstanceTranslator::RemoveChangedFoliageInstances(
+	AInstancedFoliageActor* InInstancedFoliageActor,
+	UFoliageType* InFoliageType,
+	USceneComponent* InParentComponent,
+	const TArray<FFoliageInstance>& InNewInstances,
+	const TArray<uint32>& InOwnedInstanceHashes,
+	TBitArray<>& OutExistingInstances)
+{
+	OutExistingInstances.Init(false, InNewInstances.Num());
+
+	if (InOwnedInstanceHashes.Num() <= 0)
+		return;
+
+	if (!InInstancedFoliageActor || InInstancedFoliageActor->IsPendingKill())
+		return;
+
+	FFoliageInfo* FoliageInfo = InInstancedFoliageActor->FindInfo(InFoliageType);
+	if (!FoliageInfo)
+		return;
+
+	// Gather the instances previously generated for that component
+	TArray<int32> ParentInstanceIndices;
+	for (int32 Idx = 0; Idx < FoliageInfo->Instances.Num(); Idx++)
+	{
+		if (FoliageInfo->Instances[Idx].BaseComponent == InParentComponent)
+			ParentInstanceIndices.Add(Idx);
+	}
+
+	if (ParentInstanceIndices.Num() <= 0)
+		return;
+
+	TArray<uint32> ParentHashes;
+	ParentHashes.SetNumUninitialized(ParentInstanceIndices.Num());
+	ParallelFor(ParentInstanceIndices.Num(), [&](int32 Idx)
+	{
+		ParentHashes[Idx] = GetFoliageInstanceHash(FoliageInfo->Instances[ParentInstanceIndices[Idx]]);
+	});
+
+	// Only keep the instances we own, the other instancers using that foliage type own the rest
+	TMap<uint32, int32> OwnedHashCounts;
+	OwnedHashCounts.Reserve(InOwnedInstanceHashes.Num());
+	for (const uint32& OwnedHash : InOwnedInstanceHashes)
+		OwnedHashCounts.FindOrAdd(OwnedHash)++;
+
+	TArray<int32> ComponentInstanceIndices;
+	TArray<uint32> ExistingHashes;
+	for (int32 Idx = 0; Idx < ParentInstanceIndices.Num(); Idx++)
+	{
+		int32* OwnedCount = OwnedHashCounts.Find(ParentHashes[Idx]);
+		if (!OwnedCount || *OwnedCount <= 0)
+			continue;
+
+		(*OwnedCount)--;
+		ComponentInstanceIndices.Add(ParentInstanceIndices[Idx]);
+		ExistingHashes.Add(ParentHashes[Idx]);
+	}
+
+	if (ComponentInstanceIndices.Num() <= 0)
+		return;
+
+	// Hash the new instances transforms
+	TArray<uint32> NewHashes;
+	NewHashes.SetNumUninitialized(InNewInstances.Num());
+	ParallelFor(InNewInstances.Num(), [&](int32 Idx)
+	{
+		NewHashes[Idx] = GetFoliageInstanceHash(InNewInstances[Idx]);
+	});
+
+	TMultiMap<uint32, int32> NewInstancesByHash;
+	NewInstancesByHash.Reserve(InNewInstances.Num());
+	for (int32 Idx = 0; Idx < InNewInstances.Num(); Idx++)
+		NewInstancesByHash.Add(NewHashes[Idx], Idx);
+
+	// Match each existing instance with an unclaimed new instance that has the same transform
+	TArray<int32> InstancesToRemove;
+	for (int32 Idx = 0; Idx < ComponentInstanceIndices.Num(); Idx++)
+	{
+		const FFoliageInstance& ExistingInstance = FoliageInfo->Instances[ComponentInstanceIndices[Idx]];
+
+		bool bFound = false;
+		for (auto It = NewInstancesByHash.CreateKeyIterator(ExistingHashes[Idx]); It; ++It)
+		{
+			const FFoliageInstance& NewInstance = InNewInstances[It.Value()];
+			if (NewInstance.Location != ExistingInstance.Location
+				|| NewInstance.Rotation != ExistingInstance.Rotation
+				|| NewInstance.DrawScale3D != ExistingInstance.DrawScale3D)
+				continue;
+
+			OutExistingInstances[It.Value()] = true;
+			It.RemoveCurrent();
+			bFound = true;
+			break;
+		}
+
+		if (!bFound)
+			InstancesToRemove.Add(ComponentInstanceIndices[Idx]);
+	}
+
+	// Remove the changed instances without rebuilding the tree
+	if (InstancesToRemove.Num() > 0)
+		FoliageInfo->RemoveInstances(InInstancedFoliageActor, InstancesToRemove, false);
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Foliage update: kept %d instance(s), removed %d changed instance(s)."),
+		ComponentInstanceIndices.Num() - InstancesToRemove.Num(), InstancesToRemove.Num());
+}
+
 
 FString
 FHoudiniInstanceTranslator::GetInstancerTypeFromComponent(UObject* InObject)
@@ -3161,6 +4168,27 @@ FHoudiniInstanceTranslator::HasHISMAttribute(const HAPI_NodeId& GeoId, const HAP
 	return bHISM;
 }
 
+float
+FHoudiniInstanceTranslator::GetInstancerCellSize(const HAPI_NodeId& GeoId, const HAPI_NodeId& PartId)
+{
+	// Default to the plugin settings
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	float CellSize = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->InstancerCellSize : 0.0f;
+
+	// The attribute overrides the settings
+	HAPI_AttributeInfo AttriInfo;
+	FHoudiniApi::AttributeInfo_Init(&AttriInfo);
+	TArray<float> FloatData;
+	if (FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(GeoId, PartId,
+		HAPI_UNREAL_ATTRIB_INSTANCE_CELL_SIZE, AttriInfo, FloatData, 1))
+	{
+		if (FloatData.Num() > 0)
+			CellSize = FloatData[0];
+	}
+
+	return FMath::Max(CellSize, 0.0f);
+}
+
 void
 FHoudiniInstancedOutputPartData::BuildFlatInstancedTransformsAndObjectPaths()
 {
@@ -3300,6 +4328,7 @@ FHoudiniInstanceTranslator::GetPerInstanceCustomData(
 {
 	// Initialize sizes to zero
 	OutInstancedOutputPartData.PerInstanceCustomData.SetNum(0);
+	OutInstancedOutputPartData.NumCustomFloatsPerObject.SetNum(0);
 
 	// First look for the number of custom floats
 	// If we dont have the attribute, or it is set to zero, we dont have PerInstanceCustomData
@@ -3378,6 +4407,7 @@ FHoudiniInstanceTranslator::GetPerInstanceCustomData(
 	}
 
 	OutInstancedOutputPartData.PerInstanceCustomData.SetNum(OutInstancedOutputPartData.OriginalInstancedObjects.Num());
+	OutInstancedOutputPartData.NumCustomFloatsPerObject.SetNumZeroed(OutInstancedOutputPartData.OriginalInstancedObjects.Num());
 
 	for (int32 ObjIdx = 0; ObjIdx < OutInstancedOutputPartData.OriginalInstancedObjects.Num(); ++ObjIdx)
 	{
@@ -3418,6 +4448,8 @@ FHoudiniInstanceTranslator::GetPerInstanceCustomData(
 		{
 			continue;
 		}
+
+		OutInstancedOutputPartData.NumCustomFloatsPerObject[ObjIdx] = NumCustomFloatsForInstance;
 		
 		for (int32 InstIdx : InstanceIndices)
 		{
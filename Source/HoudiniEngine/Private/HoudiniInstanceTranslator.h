@@ -38,6 +38,8 @@
 
 class UStaticMesh;
 class UFoliageType;
+class AInstancedFoliageActor;
+struct FFoliageInstance;
 class UHoudiniStaticMesh;
 class UHoudiniInstancedActorComponent;
 
@@ -126,6 +128,10 @@ public:
 	UPROPERTY()
 	bool bIsFoliageInstancer = false;
 
+	// Size of the cells used to partition the instances, 0 if the instancer isn't partitioned
+	UPROPERTY()
+	float CellSize = 0.0f;
+
 	UPROPERTY()
 	TArray<FHoudiniGenericAttribute> AllPropertyAttributes;
 
@@ -163,6 +169,11 @@ public:
 	// Size is NumCustomFloat * NumberOfInstances
 	TArray<TArray<float>> PerInstanceCustomData;
 
+	// Number of custom floats of each instance per original instanced object,
+	// read from the unreal_num_custom_floats attribute (0 if the object has no valid custom data)
+	UPROPERTY()
+	TArray<int32> NumCustomFloatsPerObject;
+
 	// Number of entries in PerInstanceCustomData. Populated when building
 	// PerInstanceCustomDataFlat in BuildFlatInstancedTransformsAndObjectPaths() and used when rebuilding
 	// PerInstanceCustomData from PerInstanceCustomDataFlat in BuildOriginalInstancedTransformsAndObjectArrays().
@@ -261,11 +272,10 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 		static void UpdateVariationAssignements(
 			FHoudiniInstancedOutput& InstancedOutput);
 
-		// Extracts the final transforms (with the transform offset applied) for a given variation
-		static void ProcessInstanceTransforms(
+		// Extracts the final transforms (with the transform offset applied) for all the variations at once
+		static void ProcessAllInstanceTransforms(
 			FHoudiniInstancedOutput& InstancedOutput,
-			const int32& VariationIdx,
-			TArray<FTransform>& OutProcessedTransforms);
+			TArray<TArray<FTransform>>& OutProcessedTransforms);
 
 		// Creates a new component or updates the previous one if possible
 		static bool CreateOrUpdateInstanceComponent(
@@ -281,7 +291,8 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			const TArray<UMaterialInterface *>& InstancerMaterials,
 			const TArray<int32>& OriginalInstancerObjectIndices, 
 			const int32& InstancerObjectIdx = 0,			
-			const bool& bForceHISM = false);
+			const bool& bForceHISM = false,
+			TArray<uint32>* InOutFoliageInstanceHashes = nullptr);
 
 		// Create or update an ISMC / HISMC
 		static bool CreateOrUpdateInstancedStaticMeshComponent(
@@ -346,7 +357,47 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			const FHoudiniGeoPartObject& InstancerGeoPartObject,
 			USceneComponent* ParentComponent,
 			USceneComponent*& NewInstancedComponent,
-			UMaterialInterface * InstancerMaterial /*=nullptr*/);
+			UMaterialInterface * InstancerMaterial /*=nullptr*/,
+			TArray<uint32>* InOutFoliageInstanceHashes = nullptr);
+
+		// Partitions the instances of a variation in a grid of cells,
+		// and creates or updates one HISM per cell. Only the cells that have changed are updated.
+		static bool CreateOrUpdateInstanceCellComponents(
+			UObject* InstancedObject,
+			const TArray<FTransform>& InstancedObjectTransforms,
+			const TArray<FHoudiniGenericAttribute>& AllPropertyAttributes,
+			const FHoudiniGeoPartObject& InstancerGeoPartObject,
+			USceneComponent* ParentComponent,
+			const FHoudiniOutputObjectIdentifier& InVariationIdentifier,
+			const int32& InVariationIndex,
+			const TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& InOldOutputObjects,
+			FHoudiniInstancedOutput& InOutInstancedOutput,
+			const TArray<UMaterialInterface *>& InstancerMaterials,
+			const TArray<int32>& OriginalInstancerObjectIndices,
+			const TArray<float>* InPerInstanceCustomData,
+			const int32& InNumCustomFloats,
+			TArray<TPair<FHoudiniOutputObjectIdentifier, USceneComponent*>>& OutCellComponents);
+
+		// Returns true if the instances of a variation should be partitioned in cells
+		static bool ShouldPartitionInstancesInCells(
+			UObject* InstancedObject,
+			const TArray<FTransform>& InstancedObjectTransforms,
+			const float& InCellSize,
+			const bool& InIsSplitMeshInstancer,
+			const bool& InIsFoliageInstancer);
+
+		// Sorts the given transforms in a grid of cells of the given size
+		// Returns the coordinates of all the non-empty cells, and the transform indices in each of them
+		static void PartitionInstanceTransformsInCells(
+			const TArray<FTransform>& InTransforms,
+			const float& InCellSize,
+			TArray<FIntVector>& OutCellCoords,
+			TArray<TArray<int32>>& OutCellTransformIndices);
+
+		// Returns the split identifier used for the component of a given cell: ORIG_VAR_cX_Y_Z
+		static FString GetInstanceCellSplitIdentifier(
+			const FString& InVariationSplitIdentifier,
+			const FIntVector& InCellCoord);
 
 		// Helper fumction to properly remove/destroy a component
 		static bool RemoveAndDestroyComponent(
@@ -366,6 +417,12 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			ULevel* InSpawnLevel, 
 			UHoudiniInstancedActorComponent* InIAC);
 
+		// Spawns the instanced actors that were postponed by the spawn time budget
+		static void TickPendingInstanceActorSpawns();
+
+		// Cancels the pending instanced actor spawns and destroys the released actors kept for reuse
+		static void ResetPendingInstanceActorSpawns();
+
 		// Helper functions for generic property attributes
 		static bool GetGenericPropertiesAttributes(
 			const int32& InGeoNodeId,
@@ -406,10 +463,23 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			const int32& InGeoId,
 			const int32& InPartId);
 
+		// Removes the foliage instances generated for the parent component.
+		// If InOwnedInstanceHashes is valid, only the instances it contains are removed.
 		static void CleanupFoliageInstances(
 			UHierarchicalInstancedStaticMeshComponent* InFoliageHISMC,
 			UObject* InInstancedObject,
-			USceneComponent* InParentComponent);
+			USceneComponent* InParentComponent,
+			const TArray<uint32>* InOwnedInstanceHashes = nullptr);
+
+		// Removes the owned foliage instances of the parent component that don't match any of the new instances,
+		// without rebuilding the foliage tree. OutExistingInstances flags the new instances that already exist.
+		static void RemoveChangedFoliageInstances(
+			AInstancedFoliageActor* InInstancedFoliageActor,
+			UFoliageType* InFoliageType,
+			USceneComponent* InParentComponent,
+			const TArray<FFoliageInstance>& InNewInstances,
+			const TArray<uint32>& InOwnedInstanceHashes,
+			TBitArray<>& OutExistingInstances);
 
 		static FString GetInstancerTypeFromComponent(
 			UObject* InComponent);
@@ -426,6 +496,9 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 		// Get if force using HISM from attribute
 		static bool HasHISMAttribute(const HAPI_NodeId& GeoId, const HAPI_NodeId& PartId);
 
+		// Get the cell size used to partition the instancer, from the attribute or the plugin settings
+		static float GetInstancerCellSize(const HAPI_NodeId& GeoId, const HAPI_NodeId& PartId);
+
 		// Checks for PerInstanceCustomData on the instancer part
 		static bool GetPerInstanceCustomData(
 			const int32& InGeoNodeId,
@@ -0,0 +1,193 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniLandscapeResampler.h"
+
+#include "Async/ParallelFor.h"
+#include "Math/VectorRegister.h"
+
+// Number of output rows resampled by each parallel task
+static const int32 HoudiniResampleRowsPerTask = 16;
+
+// Source samples and weights contributing to each output sample along one axis.
+// The taps are stored tap-major, so the weights of consecutive output samples can be loaded as vectors.
+struct FHoudiniResampleAxis
+{
+	int32 NumTaps = 0;
+	int32 OutSize = 0;
+	TArray<int32> Indices;
+	TArray<float> Weights;
+
+	int32 GetIndex(const int32& Tap, const int32& Out) const { return Indices[Tap * OutSize + Out]; }
+	float GetWeight(const int32& Tap, const int32& Out) const { return Weights[Tap * OutSize + Out]; }
+};
+
+static void
+BuildResampleAxis(
+	const int32& InSize, const int32& OutSize,
+	const EHoudiniLandscapeResampleMethod& InMethod,
+	FHoudiniResampleAxis& OutAxis)
+{
+	OutAxis.NumTaps = InMethod == EHoudiniLandscapeResampleMethod::Bicubic ? 4 : 2;
+	OutAxis.OutSize = OutSize;
+	OutAxis.Indices.SetNumUninitialized(OutAxis.NumTaps * OutSize);
+	OutAxis.Weights.SetNumUninitialized(OutAxis.NumTaps * OutSize);
+
+	const float Scale = OutSize > 1 ? (float)(InSize - 1) / (float)(OutSize - 1) : 0.0f;
+	for (int32 Out = 0; Out < OutSize; Out++)
+	{
+		const float Src = Out * Scale;
+		const int32 Src0 = FMath::Min(FMath::FloorToInt(Src), InSize - 1);
+		const float F = Src - Src0;
+
+		if (OutAxis.NumTaps == 2)
+		{
+			OutAxis.Indices[Out] = Src0;
+			OutAxis.Indices[OutSize + Out] = FMath::Min(Src0 + 1, InSize - 1);
+			OutAxis.Weights[Out] = 1.0f - F;
+			OutAxis.Weights[OutSize + Out] = F;
+		}
+		else
+		{
+			// Catmull-Rom weights
+			const float Weights[4] = {
+				((-0.5f * F + 1.0f) * F - 0.5f) * F,
+				(1.5f * F - 2.5f) * F * F + 1.0f,
+				((-1.5f * F + 2.0f) * F + 0.5f) * F,
+				(0.5f * F - 0.5f) * F * F };
+
+			for (int32 Tap = 0; Tap < 4; Tap++)
+			{
+				OutAxis.Indices[Tap * OutSize + Out] = FMath::Clamp(Src0 + Tap - 1, 0, InSize - 1);
+				OutAxis.Weights[Tap * OutSize + Out] = Weights[Tap];
+			}
+		}
+	}
+}
+
+template<typename T>
+static bool
+ResampleSeparable(
+	const TArray<T>& InData, const int32& InSizeX, const int32& InSizeY,
+	TArray<T>& OutData, const int32& OutSizeX, const int32& OutSizeY,
+	const EHoudiniLandscapeResampleMethod& InMethod)
+{
+	if (InSizeX < 1 || InSizeY < 1 || OutSizeX < 1 || OutSizeY < 1)
+		return false;
+
+	if (InData.Num() != InSizeX * InSizeY)
+		return false;
+
+	FHoudiniResampleAxis AxisX;
+	FHoudiniResampleAxis AxisY;
+	BuildResampleAxis(InSizeX, OutSizeX, InMethod, AxisX);
+	BuildResampleAxis(InSizeY, OutSizeY, InMethod, AxisY);
+
+	OutData.SetNumUninitialized(OutSizeX * OutSizeY);
+
+	const float MaxValue = (float)TNumericLimits<T>::Max();
+	const int32 NumTasks = FMath::DivideAndRoundUp(OutSizeY, HoudiniResampleRowsPerTask);
+	ParallelFor(NumTasks, [&](int32 TaskIdx)
+	{
+		TArray<float> Column;
+		TArray<float> Row;
+		Column.SetNumUninitialized(InSizeX);
+		Row.SetNumUninitialized(OutSizeX);
+		float* RESTRICT ColumnData = Column.GetData();
+		float* RESTRICT RowData = Row.GetData();
+
+		const int32 StartY = TaskIdx * HoudiniResampleRowsPerTask;
+		const int32 EndY = FMath::Min(StartY + HoudiniResampleRowsPerTask, OutSizeY);
+		for (int32 OutY = StartY; OutY < EndY; OutY++)
+		{
+			// Vertical pass, blends the source rows into one row of floats.
+			// These loops are contiguous so the compiler can vectorize them.
+			{
+				const T* RESTRICT SrcRow = &InData[AxisY.GetIndex(0, OutY) * InSizeX];
+				const float Weight = AxisY.GetWeight(0, OutY);
+				for (int32 X = 0; X < InSizeX; X++)
+					ColumnData[X] = Weight * (float)SrcRow[X];
+			}
+
+			for (int32 Tap = 1; Tap < AxisY.NumTaps; Tap++)
+			{
+				const T* RESTRICT SrcRow = &InData[AxisY.GetIndex(Tap, OutY) * InSizeX];
+				const float Weight = AxisY.GetWeight(Tap, OutY);
+				for (int32 X = 0; X < InSizeX; X++)
+					ColumnData[X] += Weight * (float)SrcRow[X];
+			}
+
+			// Horizontal pass, four output samples at a time
+			int32 OutX = 0;
+			for (; OutX + 4 <= OutSizeX; OutX += 4)
+			{
+				VectorRegister Acc = VectorZero();
+				for (int32 Tap = 0; Tap < AxisX.NumTaps; Tap++)
+				{
+					const int32* Indices = &AxisX.Indices[Tap * OutSizeX + OutX];
+					const VectorRegister Samples = MakeVectorRegister(
+						ColumnData[Indices[0]], ColumnData[Indices[1]], ColumnData[Indices[2]], ColumnData[Indices[3]]);
+					const VectorRegister Weights = VectorLoad(&AxisX.Weights[Tap * OutSizeX + OutX]);
+					Acc = VectorMultiplyAdd(Samples, Weights, Acc);
+				}
+				VectorStore(Acc, &RowData[OutX]);
+			}
+
+			for (; OutX < OutSizeX; OutX++)
+			{
+				float Acc = 0.0f;
+				for (int32 Tap = 0; Tap < AxisX.NumTaps; Tap++)
+					Acc += AxisX.GetWeight(Tap, OutX) * ColumnData[AxisX.GetIndex(Tap, OutX)];
+				RowData[OutX] = Acc;
+			}
+
+			// Clamp (bicubic can overshoot) and round to the output type
+			T* RESTRICT DstRow = &OutData[OutY * OutSizeX];
+			for (int32 X = 0; X < OutSizeX; X++)
+				DstRow[X] = (T)(int32)(FMath::Clamp(RowData[X], 0.0f, MaxValue) + 0.5f);
+		}
+	});
+
+	return true;
+}
+
+bool
+FHoudiniLandscapeResampler::Resample(
+	const TArray<uint16>& InData, const int32& InSizeX, const int32& InSizeY,
+	TArray<uint16>& OutData, const int32& OutSizeX, const int32& OutSizeY,
+	const EHoudiniLandscapeResampleMethod& InMethod)
+{
+	return ResampleSeparable(InData, InSizeX, InSizeY, OutData, OutSizeX, OutSizeY, InMethod);
+}
+
+bool
+FHoudiniLandscapeResampler::Resample(
+	const TArray<uint8>& InData, const int32& InSizeX, const int32& InSizeY,
+	TArray<uint8>& OutData, const int32& OutSizeX, const int32& OutSizeY,
+	const EHoudiniLandscapeResampleMethod& InMethod)
+{
+	return ResampleSeparable(InData, InSizeX, InSizeY, OutData, OutSizeX, OutSizeY, InMethod);
+}
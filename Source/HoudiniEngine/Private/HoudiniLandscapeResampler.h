@@ -0,0 +1,54 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EHoudiniLandscapeResampleMethod : uint8
+{
+	Bilinear,
+	Bicubic
+};
+
+// Resampling kernels used to resize heightfield data to a valid landscape size.
+// The corners of the source and destination grids are aligned, and the output rows are processed in parallel.
+struct HOUDINIENGINE_API FHoudiniLandscapeResampler
+{
+	public:
+
+		// Resamples 16 bits height data
+		static bool Resample(
+			const TArray<uint16>& InData, const int32& InSizeX, const int32& InSizeY,
+			TArray<uint16>& OutData, const int32& OutSizeX, const int32& OutSizeY,
+			const EHoudiniLandscapeResampleMethod& InMethod = EHoudiniLandscapeResampleMethod::Bilinear);
+
+		// Resamples 8 bits layer weight data
+		static bool Resample(
+			const TArray<uint8>& InData, const int32& InSizeX, const int32& InSizeY,
+			TArray<uint8>& OutData, const int32& OutSizeX, const int32& OutSizeY,
+			const EHoudiniLandscapeResampleMethod& InMethod = EHoudiniLandscapeResampleMethod::Bilinear);
+};
@@ -0,0 +1,394 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "HoudiniLandscapeSnapshot.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "Landscape.h"
+#include "LandscapeEdit.h"
+#include "LandscapeInfo.h"
+#include "LandscapeLayerInfoObject.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "Misc/Compression.h"
+
+// "HLSN"
+static const uint32 HoudiniLandscapeSnapshotMagic = 0x4E534C48;
+static const int32 HoudiniLandscapeSnapshotVersion = 1;
+
+FArchive&
+operator<<(FArchive& Ar, FHoudiniLandscapeSnapshotChunk& InChunk)
+{
+	Ar << InChunk.Min;
+	Ar << InChunk.Max;
+	Ar << InChunk.Hash;
+	Ar << InChunk.UncompressedSize;
+	Ar << InChunk.bCompressed;
+	Ar << InChunk.Data;
+
+	return Ar;
+}
+
+FArchive&
+operator<<(FArchive& Ar, FHoudiniLandscapeSnapshot& InSnapshot)
+{
+	uint32 Magic = HoudiniLandscapeSnapshotMagic;
+	int32 Version = HoudiniLandscapeSnapshotVersion;
+	Ar << Magic;
+	Ar << Version;
+	if (Ar.IsLoading() && (Magic != HoudiniLandscapeSnapshotMagic || Version != HoudiniLandscapeSnapshotVersion))
+	{
+		Ar.SetError();
+		return Ar;
+	}
+
+	Ar << InSnapshot.LayerNames;
+	Ar << InSnapshot.Chunks;
+
+	return Ar;
+}
+
+// Reads a component's height values followed by its weights for each layer.
+// Missing layers are left at zero.
+static void
+ReadLandscapeComponentData(
+	FLandscapeEditDataInterface& LandscapeEdit,
+	const TArray<ULandscapeLayerInfoObject*>& InLayerInfos,
+	const FIntPoint& InMin,
+	const FIntPoint& InMax,
+	TArray<uint8>& OutData)
+{
+	const int32 NumVertices = (InMax.X - InMin.X + 1) * (InMax.Y - InMin.Y + 1);
+	OutData.SetNumZeroed(NumVertices * sizeof(uint16) + NumVertices * InLayerInfos.Num());
+
+	LandscapeEdit.GetHeightDataFast(InMin.X, InMin.Y, InMax.X, InMax.Y, (uint16*)OutData.GetData(), 0);
+
+	uint8* LayerData = OutData.GetData() + NumVertices * sizeof(uint16);
+	for (ULandscapeLayerInfoObject* LayerInfo : InLayerInfos)
+	{
+		if (LayerInfo)
+			LandscapeEdit.GetWeightDataFast(LayerInfo, InMin.X, InMin.Y, InMax.X, InMax.Y, LayerData, 0);
+
+		LayerData += NumVertices;
+	}
+}
+
+void
+FHoudiniLandscapeSnapshot::Reset()
+{
+	LayerNames.Empty();
+	Chunks.Empty();
+}
+
+bool
+FHoudiniLandscapeSnapshot::Capture(ALandscapeProxy* InLandscapeProxy, const bool& bInCompress)
+{
+	if (!InLandscapeProxy || InLandscapeProxy->IsPendingKill())
+		return false;
+
+	ULandscapeInfo* LandscapeInfo = InLandscapeProxy->GetLandscapeInfo();
+	if (!LandscapeInfo)
+		return false;
+
+	TArray<FString> CurrentLayerNames;
+	TArray<ULandscapeLayerInfoObject*> LayerInfos;
+	for (const FLandscapeInfoLayerSettings& LayerSettings : LandscapeInfo->Layers)
+	{
+		ULandscapeLayerInfoObject* LayerInfo = LayerSettings.LayerInfoObj;
+		if (!LayerInfo || LayerInfo->IsPendingKill())
+			continue;
+
+		CurrentLayerNames.Add(LayerSettings.GetLayerName().ToString());
+		LayerInfos.Add(LayerInfo);
+	}
+
+	// The previous chunks can only be reused if they contain the same layers
+	if (CurrentLayerNames != LayerNames)
+	{
+		Chunks.Empty();
+		LayerNames = CurrentLayerNames;
+	}
+
+	// Read the components' data on the game thread
+	struct FCapturedComponent
+	{
+		FIntPoint SectionBase = FIntPoint::ZeroValue;
+		FIntPoint Min = FIntPoint::ZeroValue;
+		FIntPoint Max = FIntPoint::ZeroValue;
+		TArray<uint8> RawData;
+		bool bUnchanged = false;
+	};
+
+	TArray<FCapturedComponent> Captured;
+	Captured.Reserve(InLandscapeProxy->LandscapeComponents.Num());
+	{
+		FLandscapeEditDataInterface LandscapeEdit(LandscapeInfo);
+		for (ULandscapeComponent* Component : InLandscapeProxy->LandscapeComponents)
+		{
+			if (!Component || Component->IsPendingKill())
+				continue;
+
+			FCapturedComponent& CurrentCapture = Captured.AddDefaulted_GetRef();
+			CurrentCapture.SectionBase = Component->GetSectionBase();
+			Component->GetComponentExtent(CurrentCapture.Min.X, CurrentCapture.Min.Y, CurrentCapture.Max.X, CurrentCapture.Max.Y);
+			ReadLandscapeComponentData(LandscapeEdit, LayerInfos, CurrentCapture.Min, CurrentCapture.Max, CurrentCapture.RawData);
+		}
+	}
+
+	// Hash and encode the components in parallel, skipping the ones that haven't changed since the previous capture
+	TArray<FHoudiniLandscapeSnapshotChunk> NewChunks;
+	NewChunks.SetNum(Captured.Num());
+	ParallelFor(Captured.Num(), [&](int32 Idx)
+	{
+		FCapturedComponent& CurrentCapture = Captured[Idx];
+		const uint32 Hash = FCrc::MemCrc32(CurrentCapture.RawData.GetData(), CurrentCapture.RawData.Num());
+
+		const FHoudiniLandscapeSnapshotChunk* PreviousChunk = Chunks.Find(CurrentCapture.SectionBase);
+		if (PreviousChunk
+			&& PreviousChunk->Hash == Hash
+			&& PreviousChunk->UncompressedSize == CurrentCapture.RawData.Num()
+			&& PreviousChunk->Min == CurrentCapture.Min
+			&& PreviousChunk->Max == CurrentCapture.Max)
+		{
+			CurrentCapture.bUnchanged = true;
+			return;
+		}
+
+		FHoudiniLandscapeSnapshotChunk& NewChunk = NewChunks[Idx];
+		NewChunk.Min = CurrentCapture.Min;
+		NewChunk.Max = CurrentCapture.Max;
+		NewChunk.Hash = Hash;
+		NewChunk.UncompressedSize = CurrentCapture.RawData.Num();
+		NewChunk.bCompressed = false;
+
+		if (bInCompress)
+		{
+			int32 CompressedSize = FCompression::CompressMemoryBound(NAME_LZ4, NewChunk.UncompressedSize);
+			NewChunk.Data.SetNumUninitialized(CompressedSize);
+			if (FCompression::CompressMemory(NAME_LZ4, NewChunk.Data.GetData(), CompressedSize, CurrentCapture.RawData.GetData(), NewChunk.UncompressedSize)
+				&& CompressedSize < NewChunk.UncompressedSize)
+			{
+				NewChunk.Data.SetNum(CompressedSize);
+				NewChunk.bCompressed = true;
+			}
+		}
+
+		// Keep the raw data if it couldn't be compressed
+		if (!NewChunk.bCompressed)
+			NewChunk.Data = MoveTemp(CurrentCapture.RawData);
+	});
+
+	// Components that have been removed from the landscape are discarded
+	int32 NumUpdated = 0;
+	TMap<FIntPoint, FHoudiniLandscapeSnapshotChunk> UpdatedChunks;
+	UpdatedChunks.Reserve(Captured.Num());
+	for (int32 Idx = 0; Idx < Captured.Num(); Idx++)
+	{
+		const FCapturedComponent& CurrentCapture = Captured[Idx];
+		if (CurrentCapture.bUnchanged)
+		{
+			UpdatedChunks.Add(CurrentCapture.SectionBase, MoveTemp(Chunks[CurrentCapture.SectionBase]));
+		}
+		else
+		{
+			UpdatedChunks.Add(CurrentCapture.SectionBase, MoveTemp(NewChunks[Idx]));
+			NumUpdated++;
+		}
+	}
+	Chunks = MoveTemp(UpdatedChunks);
+
+	HOUDINI_LOG_MESSAGE(TEXT("Landscape snapshot of %s: %d/%d components captured."), *InLandscapeProxy->GetName(), NumUpdated, Chunks.Num());
+
+	return true;
+}
+
+bool
+FHoudiniLandscapeSnapshot::Restore(ALandscapeProxy* InLandscapeProxy, TArray<ULandscapeLayerInfoObject*>& OutRestoredLayers) const
+{
+	OutRestoredLayers.Empty();
+
+	if (!InLandscapeProxy || InLandscapeProxy->IsPendingKill())
+		return false;
+
+	ULandscapeInfo* LandscapeInfo = InLandscapeProxy->GetLandscapeInfo();
+	if (!LandscapeInfo)
+		return false;
+
+	// Find the layers stored in the snapshot
+	TArray<ULandscapeLayerInfoObject*> LayerInfos;
+	for (const FString& LayerName : LayerNames)
+	{
+		ULandscapeLayerInfoObject* LayerInfo = LandscapeInfo->GetLayerInfoByName(FName(*LayerName));
+		if (!LayerInfo || LayerInfo->IsPendingKill())
+		{
+			HOUDINI_LOG_WARNING(TEXT("Could not restore the landscape layer %s of %s, the layer doesn't exist anymore."), *LayerName, *InLandscapeProxy->GetName());
+			LayerInfo = nullptr;
+		}
+		else
+		{
+			OutRestoredLayers.Add(LayerInfo);
+		}
+
+		LayerInfos.Add(LayerInfo);
+	}
+
+	// Read the components' current data on the game thread
+	struct FRestoredComponent
+	{
+		const FHoudiniLandscapeSnapshotChunk* Chunk = nullptr;
+		TArray<uint8> Data;
+		bool bChanged = false;
+		bool bValid = true;
+	};
+
+	TArray<FRestoredComponent> Restored;
+	Restored.Reserve(InLandscapeProxy->LandscapeComponents.Num());
+	{
+		FLandscapeEditDataInterface LandscapeEdit(LandscapeInfo);
+		for (ULandscapeComponent* Component : InLandscapeProxy->LandscapeComponents)
+		{
+			if (!Component || Component->IsPendingKill())
+				continue;
+
+			const FHoudiniLandscapeSnapshotChunk* Chunk = Chunks.Find(Component->GetSectionBase());
+			if (!Chunk)
+			{
+				HOUDINI_LOG_WARNING(TEXT("Could not restore the landscape component %s, it is not in the snapshot."), *Component->GetName());
+				continue;
+			}
+
+			FIntPoint Min;
+			FIntPoint Max;
+			Component->GetComponentExtent(Min.X, Min.Y, Max.X, Max.Y);
+			if (Min != Chunk->Min || Max != Chunk->Max)
+			{
+				HOUDINI_LOG_WARNING(TEXT("Could not restore the landscape component %s, its size has changed."), *Component->GetName());
+				continue;
+			}
+
+			FRestoredComponent& CurrentRestore = Restored.AddDefaulted_GetRef();
+			CurrentRestore.Chunk = Chunk;
+			ReadLandscapeComponentData(LandscapeEdit, LayerInfos, Min, Max, CurrentRestore.Data);
+		}
+	}
+
+	// Compare and decode the components in parallel
+	ParallelFor(Restored.Num(), [&](int32 Idx)
+	{
+		FRestoredComponent& CurrentRestore = Restored[Idx];
+		const FHoudiniLandscapeSnapshotChunk& Chunk = *CurrentRestore.Chunk;
+		if (CurrentRestore.Data.Num() == Chunk.UncompressedSize
+			&& FCrc::MemCrc32(CurrentRestore.Data.GetData(), CurrentRestore.Data.Num()) == Chunk.Hash)
+			return;
+
+		CurrentRestore.bChanged = true;
+		if (Chunk.bCompressed)
+		{
+			CurrentRestore.Data.SetNumUninitialized(Chunk.UncompressedSize);
+			CurrentRestore.bValid = FCompression::UncompressMemory(
+				NAME_LZ4, CurrentRestore.Data.GetData(), Chunk.UncompressedSize, Chunk.Data.GetData(), Chunk.Data.Num());
+		}
+		else
+		{
+			CurrentRestore.Data = Chunk.Data;
+			CurrentRestore.bValid = CurrentRestore.Data.Num() == Chunk.UncompressedSize;
+		}
+	});
+
+	// Write the changed components back
+	bool bSuccess = true;
+	int32 NumRestored = 0;
+	{
+		FHeightmapAccessor<false> HeightmapAccessor(LandscapeInfo);
+
+		TArray<TUniquePtr<FAlphamapAccessor<false, false>>> AlphamapAccessors;
+		for (ULandscapeLayerInfoObject* LayerInfo : LayerInfos)
+			AlphamapAccessors.Add(LayerInfo ? MakeUnique<FAlphamapAccessor<false, false>>(LandscapeInfo, LayerInfo) : nullptr);
+
+		for (const FRestoredComponent& CurrentRestore : Restored)
+		{
+			if (!CurrentRestore.bChanged)
+				continue;
+
+			const FHoudiniLandscapeSnapshotChunk& Chunk = *CurrentRestore.Chunk;
+			const int32 NumVertices = (Chunk.Max.X - Chunk.Min.X + 1) * (Chunk.Max.Y - Chunk.Min.Y + 1);
+			if (!CurrentRestore.bValid || CurrentRestore.Data.Num() != NumVertices * (sizeof(uint16) + LayerInfos.Num()))
+			{
+				HOUDINI_LOG_ERROR(TEXT("Could not decode the landscape snapshot data of %s."), *InLandscapeProxy->GetName());
+				bSuccess = false;
+				continue;
+			}
+
+			HeightmapAccessor.SetData(Chunk.Min.X, Chunk.Min.Y, Chunk.Max.X, Chunk.Max.Y, (const uint16*)CurrentRestore.Data.GetData());
+
+			const uint8* LayerData = CurrentRestore.Data.GetData() + NumVertices * sizeof(uint16);
+			for (int32 LayerIdx = 0; LayerIdx < AlphamapAccessors.Num(); LayerIdx++, LayerData += NumVertices)
+			{
+				if (AlphamapAccessors[LayerIdx].IsValid())
+					AlphamapAccessors[LayerIdx]->SetData(Chunk.Min.X, Chunk.Min.Y, Chunk.Max.X, Chunk.Max.Y, LayerData, ELandscapeLayerPaintingRestriction::None);
+			}
+
+			NumRestored++;
+		}
+	}
+
+	HOUDINI_LOG_MESSAGE(TEXT("Landscape snapshot of %s: %d/%d components restored."), *InLandscapeProxy->GetName(), NumRestored, Restored.Num());
+
+	return bSuccess;
+}
+
+bool
+FHoudiniLandscapeSnapshot::SaveToFile(const FString& InFilename)
+{
+	TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*InFilename));
+	if (!FileWriter)
+		return false;
+
+	*FileWriter << *this;
+
+	return FileWriter->Close();
+}
+
+bool
+FHoudiniLandscapeSnapshot::LoadFromFile(const FString& InFilename)
+{
+	Reset();
+
+	TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*InFilename));
+	if (!FileReader)
+		return false;
+
+	*FileReader << *this;
+	if (FileReader->IsError())
+	{
+		Reset();
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,87 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class ALandscapeProxy;
+class ULandscapeLayerInfoObject;
+
+// Data of a single landscape component in a snapshot:
+// its height values, followed by its weights for each of the snapshot's layers.
+struct HOUDINIENGINE_API FHoudiniLandscapeSnapshotChunk
+{
+	public:
+
+		friend FArchive& operator<<(FArchive& Ar, FHoudiniLandscapeSnapshotChunk& InChunk);
+
+		// Extent of the component, in landscape vertices
+		FIntPoint Min = FIntPoint::ZeroValue;
+		FIntPoint Max = FIntPoint::ZeroValue;
+
+		// Hash of the uncompressed data
+		uint32 Hash = 0;
+
+		// Size of the uncompressed data
+		int32 UncompressedSize = 0;
+
+		// Indicates if Data is LZ4 compressed
+		bool bCompressed = false;
+
+		TArray<uint8> Data;
+};
+
+// Binary snapshot of a landscape's height and paint layer data, chunked per component.
+// Captures are incremental: only the components whose data changed since the previous capture are re-encoded.
+// Restores only write the components whose current data differs from the snapshot.
+struct HOUDINIENGINE_API FHoudiniLandscapeSnapshot
+{
+	public:
+
+		friend FArchive& operator<<(FArchive& Ar, FHoudiniLandscapeSnapshot& InSnapshot);
+
+		// Captures the data of all the landscape proxy's components
+		bool Capture(ALandscapeProxy* InLandscapeProxy, const bool& bInCompress);
+
+		// Restores the data of the landscape proxy's components that have changed since the capture
+		bool Restore(ALandscapeProxy* InLandscapeProxy, TArray<ULandscapeLayerInfoObject*>& OutRestoredLayers) const;
+
+		bool SaveToFile(const FString& InFilename);
+
+		bool LoadFromFile(const FString& InFilename);
+
+		bool IsValid() const { return Chunks.Num() > 0; }
+
+		void Reset();
+
+		// Names of the layers stored in the chunks, in order
+		TArray<FString> LayerNames;
+
+		// Component chunks, by section base
+		TMap<FIntPoint, FHoudiniLandscapeSnapshotChunk> Chunks;
+};
@@ -38,6 +38,8 @@
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniPackageParams.h"
 #include "HoudiniStringResolver.h"
+#include "HoudiniLandscapeResampler.h"
+#include "HoudiniLandscapeSnapshot.h"
 #include "HoudiniInput.h"
 
 #include "ObjectTools.h"
@@ -64,6 +66,8 @@
 #include "HAL/IConsoleManager.h"
 #include "Engine/AssetManager.h"
 #include "Misc/ScopedSlowTask.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
 
 #if WITH_EDITOR
 	#include "EditorLevelUtils.h"
@@ -79,12 +83,196 @@ static TAutoConsoleVariable<int32> CVarHoudiniEngineExportLandscapeTextures(
 	TEXT("1: Enabled\n")
 );
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineLandscapeResampleMethod(
+	TEXT("HoudiniEngine.LandscapeResampleMethod"),
+	0,
+	TEXT("Filter used when heightfield data needs to be resampled to a valid landscape size.\n")
+	TEXT("0: Bilinear\n")
+	TEXT("1: Bicubic\n")
+);
+
+static EHoudiniLandscapeResampleMethod
+GetLandscapeResampleMethod()
+{
+	return CVarHoudiniEngineLandscapeResampleMethod.GetValueOnAnyThread() == 1
+		? EHoudiniLandscapeResampleMethod::Bicubic
+		: EHoudiniLandscapeResampleMethod::Bilinear;
+}
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineLandscapeSnapshotCompression(
+	TEXT("HoudiniEngine.LandscapeSnapshotCompression"),
+	1,
+	TEXT("If enabled, the input landscape backups are LZ4 compressed.\n")
+	TEXT("0: Disabled\n")
+	TEXT("1: Enabled\n")
+);
+
+// An input landscape backup, and the HAC that made it
+struct FHoudiniLandscapeSnapshotEntry
+{
+	FHoudiniLandscapeSnapshot Snapshot;
+	TWeakObjectPtr<UHoudiniAssetComponent> OwnerHAC;
+};
+
+// Input landscape backups, by snapshot file name, so they can be updated and restored without reading the file.
+// Entries are removed once restored or when their HAC is destroyed, the files are kept.
+static TMap<FString, FHoudiniLandscapeSnapshotEntry> HoudiniLandscapeSnapshots;
+
 typedef FHoudiniEngineUtils FHUtils;
 
+// Number of points read per call when downloading heightfield data from HAPI
+static const int32 HoudiniHeightfieldReadWindowSize = 1 << 20;
+
+// Size (in points) of the square tiles used when converting heightfield data to landscape data
+static const int32 HoudiniHeightfieldConversionTileSize = 64;
+
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
 HOUDINI_LANDSCAPE_DEFINE_LOG_CATEGORY();
 
+// Removes the hashes of the layers that are not written anymore, so a layer that is added back is entirely redrawn
+static void
+PruneLandscapeLayerHashes(TMap<FName, FHoudiniLandscapeLayerHashes>& InOutHashes, const TArray<FLandscapeImportLayerInfo>& InLayerInfos)
+{
+	for (auto It = InOutHashes.CreateIterator(); It; ++It)
+	{
+		if (It.Key() == TEXT("height"))
+			continue;
+
+		if (!InLayerInfos.ContainsByPredicate([&It](const FLandscapeImportLayerInfo& LayerInfo) { return LayerInfo.LayerName == It.Key(); }))
+			It.RemoveCurrent();
+	}
+}
+
+// Computes the per-block hashes of a landscape region's data and compares them with the ones last written.
+// OutChangedRect is the rectangle (relative to the region, max exclusive) covering all the changed blocks.
+// InOutHashes is updated with the new hashes. Returns false if no data has changed.
+template<typename TData>
+static bool
+GetLandscapeChangedRegion(
+	const TArray<TData>& InData,
+	const FIntRect& InRegion,
+	const int32& InBlockSize,
+	FHoudiniLandscapeLayerHashes& InOutHashes,
+	FIntRect& OutChangedRect)
+{
+	const int32 SizeX = InRegion.Width();
+	const int32 SizeY = InRegion.Height();
+	OutChangedRect = FIntRect(0, 0, SizeX, SizeY);
+	if (SizeX <= 0 || SizeY <= 0 || InData.Num() != SizeX * SizeY)
+		return true;
+
+	const int32 BlockSize = FMath::Max(InBlockSize, 1);
+	const int32 NumBlocksX = FMath::DivideAndRoundUp(SizeX, BlockSize);
+	const int32 NumBlocksY = FMath::DivideAndRoundUp(SizeY, BlockSize);
+
+	TArray<uint32> NewHashes;
+	NewHashes.SetNumUninitialized(NumBlocksX * NumBlocksY);
+	ParallelFor(NewHashes.Num(), [&](int32 BlockIdx)
+	{
+		const int32 StartX = (BlockIdx % NumBlocksX) * BlockSize;
+		const int32 StartY = (BlockIdx / NumBlocksX) * BlockSize;
+		const int32 RowLength = FMath::Min(BlockSize, SizeX - StartX);
+		const int32 EndY = FMath::Min(StartY + BlockSize, SizeY);
+
+		uint32 Hash = 0;
+		for (int32 nY = StartY; nY < EndY; nY++)
+			Hash = FCrc::MemCrc32(&InData[StartX + nY * SizeX], RowLength * sizeof(TData), Hash);
+
+		NewHashes[BlockIdx] = Hash;
+	});
+
+	const bool bCanCompare = InOutHashes.RegionMin == InRegion.Min
+		&& InOutHashes.RegionMax == InRegion.Max
+		&& InOutHashes.BlockSize == BlockSize
+		&& InOutHashes.BlockHashes.Num() == NewHashes.Num();
+
+	if (bCanCompare)
+	{
+		// Find the bounds of the blocks that changed
+		FIntRect ChangedBlocks(NumBlocksX, NumBlocksY, -1, -1);
+		for (int32 BlockIdx = 0; BlockIdx < NewHashes.Num(); BlockIdx++)
+		{
+			if (NewHashes[BlockIdx] == InOutHashes.BlockHashes[BlockIdx])
+				continue;
+
+			const int32 BlockX = BlockIdx % NumBlocksX;
+			const int32 BlockY = BlockIdx / NumBlocksX;
+			ChangedBlocks.Min.X = FMath::Min(ChangedBlocks.Min.X, BlockX);
+			ChangedBlocks.Min.Y = FMath::Min(ChangedBlocks.Min.Y, BlockY);
+			ChangedBlocks.Max.X = FMath::Max(ChangedBlocks.Max.X, BlockX);
+			ChangedBlocks.Max.Y = FMath::Max(ChangedBlocks.Max.Y, BlockY);
+		}
+
+		if (ChangedBlocks.Max.X < 0)
+			return false;
+
+		OutChangedRect.Min.X = ChangedBlocks.Min.X * BlockSize;
+		OutChangedRect.Min.Y = ChangedBlocks.Min.Y * BlockSize;
+		OutChangedRect.Max.X = FMath::Min((ChangedBlocks.Max.X + 1) * BlockSize, SizeX);
+		OutChangedRect.Max.Y = FMath::Min((ChangedBlocks.Max.Y + 1) * BlockSize, SizeY);
+	}
+
+	InOutHashes.RegionMin = InRegion.Min;
+	InOutHashes.RegionMax = InRegion.Max;
+	InOutHashes.BlockSize = BlockSize;
+	InOutHashes.BlockHashes = MoveTemp(NewHashes);
+
+	return true;
+}
+
+// Writes the region of the data that changed since the last update with the given accessor function.
+// If InOutHashes is null, the whole region is written. Returns true if any data was written.
+template<typename TData, typename TSetDataFunc>
+static bool
+WriteChangedLandscapeRegion(
+	const TArray<TData>& InData,
+	const int32& MinX, const int32& MinY, const int32& MaxX, const int32& MaxY,
+	const int32& InBlockSize,
+	FHoudiniLandscapeLayerHashes* InOutHashes,
+	TSetDataFunc SetDataFunc)
+{
+	if (!InOutHashes)
+	{
+		SetDataFunc(MinX, MinY, MaxX, MaxY, InData.GetData());
+		return true;
+	}
+
+	const FIntRect Region(MinX, MinY, MaxX + 1, MaxY + 1);
+	FIntRect ChangedRect;
+	if (!GetLandscapeChangedRegion(InData, Region, InBlockSize, *InOutHashes, ChangedRect))
+		return false;
+
+	if (ChangedRect == FIntRect(0, 0, Region.Width(), Region.Height()))
+	{
+		SetDataFunc(MinX, MinY, MaxX, MaxY, InData.GetData());
+		return true;
+	}
+
+	// Extract the changed rectangle
+	const int32 SizeX = Region.Width();
+	const int32 ChangedSizeX = ChangedRect.Width();
+	TArray<TData> ChangedData;
+	ChangedData.SetNumUninitialized(ChangedSizeX * ChangedRect.Height());
+	for (int32 nY = ChangedRect.Min.Y; nY < ChangedRect.Max.Y; nY++)
+	{
+		FMemory::Memcpy(
+			&ChangedData[(nY - ChangedRect.Min.Y) * ChangedSizeX],
+			&InData[ChangedRect.Min.X + nY * SizeX],
+			ChangedSizeX * sizeof(TData));
+	}
+
+	HOUDINI_LANDSCAPE_MESSAGE(TEXT("[WriteChangedLandscapeRegion] Updating region: %d, %d -> %d, %d"),
+		MinX + ChangedRect.Min.X, MinY + ChangedRect.Min.Y, MinX + ChangedRect.Max.X - 1, MinY + ChangedRect.Max.Y - 1);
+
+	SetDataFunc(
+		MinX + ChangedRect.Min.X, MinY + ChangedRect.Min.Y,
+		MinX + ChangedRect.Max.X - 1, MinY + ChangedRect.Max.Y - 1,
+		ChangedData.GetData());
+
+	return true;
+}
+
 bool
 FHoudiniLandscapeTranslator::CreateLandscape(
 	UHoudiniOutput* InOutput,
@@ -184,6 +372,42 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 	}
 }
 
+bool
+FHoudiniLandscapeTranslator::FlushLandscapeTileMemory(
+	TArray<UPackage*>& InOutCreatedPackages,
+	uint64& InOutMemoryBaseline)
+{
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	const int32 MemoryBudgetMB = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->MarshallingLandscapesTileMemoryBudgetMB : 0;
+	if (MemoryBudgetMB <= 0)
+		return false;
+
+	// Only count the memory used since the last release, so we don't flush after every tile
+	// once the editor's memory usage is above the budget
+	const uint64 UsedMemory = FPlatformMemory::GetStats().UsedPhysical;
+	if (UsedMemory < InOutMemoryBaseline + (uint64)MemoryBudgetMB * 1024 * 1024)
+		return false;
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Landscape tile streaming: %llu MB used since the last release exceeds the budget (%d MB), releasing memory before processing the next tile."),
+		(UsedMemory - InOutMemoryBaseline) / (1024 * 1024), MemoryBudgetMB);
+
+	// Save the layer infos and textures created by the previous tiles, so they don't stay dirty until the end of the cook
+	if (InOutCreatedPackages.Num() > 0)
+	{
+		FEditorFileUtils::PromptForCheckoutAndSave(InOutCreatedPackages, true, false);
+		InOutCreatedPackages.Empty();
+	}
+
+	// Release the data of the replaced tiles and the import buffers of the previous tiles
+	FlushRenderingCommands();
+	TryCollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	InOutMemoryBaseline = FPlatformMemory::GetStats().UsedPhysical;
+
+	return true;
+}
+
 bool
 FHoudiniLandscapeTranslator::OutputLandscape_Temp(
 	UHoudiniOutput* InOutput,
@@ -424,17 +648,12 @@ FHoudiniLandscapeTranslator::OutputLandscape_Temp(
 	UPhysicalMaterial* LandscapePhysicalMaterial = nullptr;
 	FHoudiniLandscapeTranslator::GetLandscapeMaterials(*Heightfield, LandscapeMaterial, LandscapeHoleMaterial, LandscapePhysicalMaterial);
 
-	// Extract the float data from the Heightfield.
-	const FHoudiniVolumeInfo &VolumeInfo = Heightfield->VolumeInfo;
-	TArray<float> FloatValues;
-	float FloatMin, FloatMax;
-	if (!GetHoudiniHeightfieldFloatData(Heightfield, FloatValues, FloatMin, FloatMax))
-		return false;
-
 	// Heightfield conversions should always use the global float min/max
 	// since they need to be calculated externally, potentially across multiple tiles.
-	FloatMin = fGlobalMin;
-	FloatMax = fGlobalMax;
+	// The heightfield's data is then only downloaded when converted to landscape data.
+	const FHoudiniVolumeInfo &VolumeInfo = Heightfield->VolumeInfo;
+	const float FloatMin = fGlobalMin;
+	const float FloatMax = fGlobalMax;
 
 	// Get the Unreal landscape size 
 	const int32 HoudiniHeightfieldXSize = VolumeInfo.YLength;
@@ -473,15 +692,20 @@ FHoudiniLandscapeTranslator::OutputLandscape_Temp(
 	if (bExportTexture)
 	{
 		// Export raw height data to texture
-		FString TextureName = TilePackageParams.ObjectName + TEXT("_height_raw");
-		FHoudiniLandscapeTranslator::CreateUnrealTexture(
-			TilePackageParams,
-			TextureName,
-			HoudiniHeightfieldXSize,
-			HoudiniHeightfieldYSize,
-			FloatValues,
-			FloatMin,
-			FloatMax);
+		TArray<float> FloatValues;
+		float DataMin, DataMax;
+		if (GetHoudiniHeightfieldFloatData(Heightfield, FloatValues, DataMin, DataMax))
+		{
+			FString TextureName = TilePackageParams.ObjectName + TEXT("_height_raw");
+			FHoudiniLandscapeTranslator::CreateUnrealTexture(
+				TilePackageParams,
+				TextureName,
+				HoudiniHeightfieldXSize,
+				HoudiniHeightfieldYSize,
+				FloatValues,
+				FloatMin,
+				FloatMax);
+		}
 	}
 
 	// Look for all the layers/masks corresponding to the current heightfield.
@@ -502,7 +726,7 @@ FHoudiniLandscapeTranslator::OutputLandscape_Temp(
 	TArray<uint16> IntHeightData;
 	FTransform TileTransform;
 	if (!FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
-		FloatValues, VolumeInfo,
+		Heightfield,
 		UnrealTileSizeX, UnrealTileSizeY,
 		FloatMin, FloatMax,
 		IntHeightData, TileTransform))
@@ -916,6 +1140,12 @@ FHoudiniLandscapeTranslator::OutputLandscape_Temp(
 	ALandscape* CachedLandscapeActor = nullptr;
 	ULandscapeInfo *LandscapeInfo;
 
+	// Hashes of the data written to the tile, per layer
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	const bool bUpdateChangedRegionsOnly = HoudiniRuntimeSettings && HoudiniRuntimeSettings->bMarshallingLandscapesUpdateChangedRegionsOnly;
+	const int32 ComponentSizeQuads = NumSectionPerLandscapeComponent * NumQuadsPerLandscapeSection;
+	TMap<FName, FHoudiniLandscapeLayerHashes> LayerDataHashes;
+
 #if defined(HOUDINI_ENGINE_DEBUG_LANDSCAPE)
 	HOUDINI_LANDSCAPE_MESSAGE(TEXT("[HoudiniLandscapeTranslator::CreateLandscape] Tile Loc: %d, %d"), TileLoc.X, TileLoc.Y);
 	HOUDINI_LANDSCAPE_MESSAGE(TEXT("[HoudiniLandscapeTranslator::CreateLandscape] Tile Size: %d, %d"), UnrealTileSizeX, UnrealTileSizeY);
@@ -944,6 +1174,16 @@ FHoudiniLandscapeTranslator::OutputLandscape_Temp(
 
 		LandscapeInfo = TileActor->GetLandscapeInfo();
 
+		if (bUpdateChangedRegionsOnly)
+		{
+			// Store the hashes of the data the tile was created with
+			const FIntRect Region(TileLoc.X, TileLoc.Y, TileLoc.X + UnrealTileSizeX, TileLoc.Y + UnrealTileSizeY);
+			FIntRect ChangedRect;
+			GetLandscapeChangedRegion(IntHeightData, Region, ComponentSizeQuads, LayerDataHashes.FindOrAdd(TEXT("height")), ChangedRect);
+			for (FLandscapeImportLayerInfo& CurLayerInfo : LayerInfos)
+				GetLandscapeChangedRegion(CurLayerInfo.LayerData, Region, ComponentSizeQuads, LayerDataHashes.FindOrAdd(CurLayerInfo.LayerName), ChangedRect);
+		}
+
 		bCreatedTileActor = true;
 		bTileLandscapeMaterialChanged = true;
 		bTileLandscapeHoleMaterialChanged = true;
@@ -1021,6 +1261,22 @@ FHoudiniLandscapeTranslator::OutputLandscape_Temp(
 		const int32 MinY = TileLoc.Y;
 		const int32 MaxY = TileLoc.Y + UnrealTileSizeY - 1;
 
+		// Get the hashes of the data we've previously written to this tile,
+		// so that only the regions that have changed are updated
+		FHoudiniLandscapeLayerHashes* HeightHashes = nullptr;
+		if (bUpdateChangedRegionsOnly)
+		{
+			FHoudiniOutputObject* PreviousOutputObject = InOutput->GetOutputObjects().Find(HeightfieldIdentifier);
+			UHoudiniLandscapePtr* PreviousLandscapePtr = PreviousOutputObject ? Cast<UHoudiniLandscapePtr>(PreviousOutputObject->OutputObject) : nullptr;
+			if (IsValid(PreviousLandscapePtr) && PreviousLandscapePtr->GetRawPtr() == TileActor)
+			{
+				LayerDataHashes = PreviousLandscapePtr->LayerDataHashes;
+				PruneLandscapeLayerHashes(LayerDataHashes, LayerInfos);
+			}
+
+			HeightHashes = &LayerDataHashes.FindOrAdd(TEXT("height"));
+		}
+
 		// NOTE: Use HeightmapAccessor / AlphamapAccessor instead of FLandscapeEditDataInterface.
 		// FLandscapeEditDataInterface is a more low level data interface, used internally by the *Accessor tools
 		// though the *Accessors do additional things like update normals and foliage.
@@ -1031,26 +1287,39 @@ FHoudiniLandscapeTranslator::OutputLandscape_Temp(
 			// It is important to update the heightmap through HeightmapAccessor this since it will properly
 			// update normals and foliage.
 			FHeightmapAccessor<false> HeightmapAccessor(LandscapeInfo);
-			HeightmapAccessor.SetData(MinX, MinY, MaxX, MaxY, IntHeightData.GetData());
-			bHeightLayerDataChanged = true;
+			bHeightLayerDataChanged = WriteChangedLandscapeRegion(
+				IntHeightData, MinX, MinY, MaxX, MaxY, ComponentSizeQuads, HeightHashes,
+				[&HeightmapAccessor](int32 X1, int32 Y1, int32 X2, int32 Y2, const uint16* Data)
+				{
+					HeightmapAccessor.SetData(X1, Y1, X2, Y2, Data);
+				});
 		}
 
 		// Update the layers on the landscape.
 		for (FLandscapeImportLayerInfo &NextUpdatedLayerInfo : LayerInfos)
 		{
+			FHoudiniLandscapeLayerHashes* LayerHashes = bUpdateChangedRegionsOnly ? &LayerDataHashes.FindOrAdd(NextUpdatedLayerInfo.LayerName) : nullptr;
 			if (NextUpdatedLayerInfo.LayerInfo && NextUpdatedLayerInfo.LayerName.ToString().Equals(TEXT("Visibility"), ESearchCase::IgnoreCase))
 			{
 				// NOTE: AProxyLandscape::VisibilityLayer is a STATIC property (Info objects is being shared by ALL landscapes). Don't try to update / replace it.
 				FAlphamapAccessor<false, false> AlphaAccessor(LandscapeInfo, ALandscapeProxy::VisibilityLayer);
-				AlphaAccessor.SetData(MinX, MinY, MaxX, MaxY, NextUpdatedLayerInfo.LayerData.GetData(), ELandscapeLayerPaintingRestriction::None);
+				bCustomLayerDataChanged |= WriteChangedLandscapeRegion(
+					NextUpdatedLayerInfo.LayerData, MinX, MinY, MaxX, MaxY, ComponentSizeQuads, LayerHashes,
+					[&AlphaAccessor](int32 X1, int32 Y1, int32 X2, int32 Y2, const uint8* Data)
+					{
+						AlphaAccessor.SetData(X1, Y1, X2, Y2, Data, ELandscapeLayerPaintingRestriction::None);
+					});
 			}
 			else
 			{
 				FAlphamapAccessor<false, true> AlphaAccessor(LandscapeInfo, NextUpdatedLayerInfo.LayerInfo);
-				AlphaAccessor.SetData(MinX, MinY, MaxX, MaxY, NextUpdatedLayerInfo.LayerData.GetData(), ELandscapeLayerPaintingRestriction::None);
+				bCustomLayerDataChanged |= WriteChangedLandscapeRegion(
+					NextUpdatedLayerInfo.LayerData, MinX, MinY, MaxX, MaxY, ComponentSizeQuads, LayerHashes,
+					[&AlphaAccessor](int32 X1, int32 Y1, int32 X2, int32 Y2, const uint8* Data)
+					{
+						AlphaAccessor.SetData(X1, Y1, X2, Y2, Data, ELandscapeLayerPaintingRestriction::None);
+					});
 			}
-
-			bCustomLayerDataChanged = true;
 		}
 
 		bModifiedLandscapeActor = true;
@@ -1134,6 +1403,9 @@ FHoudiniLandscapeTranslator::OutputLandscape_Temp(
 		TileActor->PostEditChange();
 	}
 
+	// Normals and collisions only need to be rebuilt if the data has changed
+	const bool bLandscapeDataChanged = bCreatedTileActor || bHeightLayerDataChanged || bCustomLayerDataChanged;
+	if (bLandscapeDataChanged)
 	{
 		FLandscapeEditDataInterface LandscapeEdit(TileActor->GetLandscapeInfo());
 		LandscapeEdit.RecalculateNormals();
@@ -1142,7 +1414,8 @@ FHoudiniLandscapeTranslator::OutputLandscape_Temp(
 	if (LandscapeInfo)
 	{
 		LandscapeInfo->RecreateLandscapeInfo(InWorld, true);
-		LandscapeInfo->RecreateCollisionComponents();
+		if (bLandscapeDataChanged)
+			LandscapeInfo->RecreateCollisionComponents();
 	}
 
 	{
@@ -1194,6 +1467,15 @@ FHoudiniLandscapeTranslator::OutputLandscape_Temp(
 		TileActor,
 		InPackageParams.PackageMode);
 
+	// Keep the hashes of the data we've written for the next update
+	if (bUpdateChangedRegionsOnly)
+	{
+		FHoudiniOutputObject* NewOutputObject = InOutput->GetOutputObjects().Find(HeightfieldIdentifier);
+		UHoudiniLandscapePtr* NewLandscapePtr = NewOutputObject ? Cast<UHoudiniLandscapePtr>(NewOutputObject->OutputObject) : nullptr;
+		if (IsValid(NewLandscapePtr))
+			NewLandscapePtr->LayerDataHashes = MoveTemp(LayerDataHashes);
+	}
+
 #if defined(HOUDINI_ENGINE_DEBUG_LANDSCAPE)
 	if (LandscapeInfo)
 	{
@@ -1271,11 +1553,10 @@ bool FHoudiniLandscapeTranslator::OutputLandscape_EditableLayer(UHoudiniOutput*
 	FHoudiniOutputObjectIdentifier HeightfieldIdentifier(Heightfield->ObjectId, GeoId, PartId, "Heightfield");
 	HeightfieldIdentifier.PartName = Heightfield->PartName;
 
-	// Extract the float data from the Heightfield.
+	// Get the range of the Heightfield's values, its data is downloaded again when converted to landscape data
 	const FHoudiniVolumeInfo &VolumeInfo = Heightfield->VolumeInfo;
-	TArray<float> FloatValues;
 	float FloatMin, FloatMax;
-	if (!GetHoudiniHeightfieldFloatData(Heightfield, FloatValues, FloatMin, FloatMax))
+	if (!GetHoudiniHeightfieldMinMax(Heightfield, FloatMin, FloatMax))
 		return false;
 
 	// Get the Unreal landscape size 
@@ -1399,7 +1680,7 @@ bool FHoudiniLandscapeTranslator::OutputLandscape_EditableLayer(UHoudiniOutput*
 	TArray<uint16> IntHeightData;
 	FTransform TileTransform;
 	if (!FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
-		FloatValues, VolumeInfo,
+		Heightfield,
 		LandscapeTileSizeInfo.UnrealSizeX, LandscapeTileSizeInfo.UnrealSizeY,
 		FloatMin, FloatMax,
 		IntHeightData, TileTransform,
@@ -1566,6 +1847,27 @@ bool FHoudiniLandscapeTranslator::OutputLandscape_EditableLayer(UHoudiniOutput*
 	}
 
 
+	// Get the hashes of the data we've previously written to this edit layer,
+	// so that only the regions that have changed are updated.
+	// A layer that has just been cleared needs to be entirely redrawn.
+	FHoudiniOutputObjectIdentifier OutputObjectIdentifier(Heightfield->ObjectId, GeoId, PartId, "EditableLayer");
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	const bool bUpdateChangedRegionsOnly = HoudiniRuntimeSettings && HoudiniRuntimeSettings->bMarshallingLandscapesUpdateChangedRegionsOnly;
+	TMap<FName, FHoudiniLandscapeLayerHashes> LayerDataHashes;
+	if (bUpdateChangedRegionsOnly && !ClearedLayers.Contains(EditableLayerName))
+	{
+		FHoudiniOutputObject* PreviousOutputObject = InOutput->GetOutputObjects().Find(OutputObjectIdentifier);
+		UHoudiniLandscapeEditLayer* PreviousEditLayer = PreviousOutputObject ? Cast<UHoudiniLandscapeEditLayer>(PreviousOutputObject->OutputObject) : nullptr;
+		if (IsValid(PreviousEditLayer)
+			&& PreviousEditLayer->GetRawPtr() == TargetLandscape
+			&& PreviousEditLayer->LayerName.Equals(EditableLayerName))
+		{
+			LayerDataHashes = PreviousEditLayer->LayerDataHashes;
+			PruneLandscapeLayerHashes(LayerDataHashes, LayerInfos);
+		}
+	}
+	const int32 ComponentSizeQuads = TargetLandscapeInfo->ComponentSizeQuads;
+
 	{
 		// Scope the Edit Layer before we start drawing on ANY of the layers
 		FScopedSetLandscapeEditingLayer Scope(TargetLandscape, TargetLayer->Guid, [=] { TargetLandscape->RequestLayersContentUpdate(ELandscapeLayerUpdateMode::Update_All); });
@@ -1574,7 +1876,13 @@ bool FHoudiniLandscapeTranslator::OutputLandscape_EditableLayer(UHoudiniOutput*
 		HOUDINI_LANDSCAPE_MESSAGE(TEXT("[OutputLandscape_EditableLayer] Drawing heightmap.."));
 		// Draw Heightmap
 		FHeightmapAccessor<false> HeightmapAccessor(TargetLandscapeInfo);
-        HeightmapAccessor.SetData(TileMin.X, TileMin.Y, TileMax.X, TileMax.Y, IntHeightData.GetData());
+		WriteChangedLandscapeRegion(
+			IntHeightData, TileMin.X, TileMin.Y, TileMax.X, TileMax.Y, ComponentSizeQuads,
+			bUpdateChangedRegionsOnly ? &LayerDataHashes.FindOrAdd(TEXT("height")) : nullptr,
+			[&HeightmapAccessor](int32 X1, int32 Y1, int32 X2, int32 Y2, const uint16* Data)
+			{
+				HeightmapAccessor.SetData(X1, Y1, X2, Y2, Data);
+			});
 
 		// Draw material layers on the landscape
 		// Update the layers on the landscape.
@@ -1589,7 +1897,13 @@ bool FHoudiniLandscapeTranslator::OutputLandscape_EditableLayer(UHoudiniOutput*
 			{
 				// NOTE: AProxyLandscape::VisibilityLayer is a STATIC property (Info objects is being shared by ALL landscapes). Don't try to update / replace it.
 				FAlphamapAccessor<false, false> AlphaAccessor(TargetLandscapeInfo, ALandscapeProxy::VisibilityLayer);
-				AlphaAccessor.SetData(TileMin.X, TileMin.Y, TileMax.X, TileMax.Y, InLayerInfo.LayerData.GetData(), ELandscapeLayerPaintingRestriction::None);
+				WriteChangedLandscapeRegion(
+					InLayerInfo.LayerData, TileMin.X, TileMin.Y, TileMax.X, TileMax.Y, ComponentSizeQuads,
+					bUpdateChangedRegionsOnly ? &LayerDataHashes.FindOrAdd(InLayerInfo.LayerName) : nullptr,
+					[&AlphaAccessor](int32 X1, int32 Y1, int32 X2, int32 Y2, const uint8* Data)
+					{
+						AlphaAccessor.SetData(X1, Y1, X2, Y2, Data, ELandscapeLayerPaintingRestriction::None);
+					});
 			}
 			else
 			{
@@ -1603,7 +1917,13 @@ bool FHoudiniLandscapeTranslator::OutputLandscape_EditableLayer(UHoudiniOutput*
 				{
 					HOUDINI_LANDSCAPE_MESSAGE(TEXT("[OutputLandscape_EditableLayer] Drawing using Alpha accessor. Dest Region: %f, %f, -> %f, %f"), TileMin.X, TileMin.Y, TileMax.X, TileMax.Y);
 					FAlphamapAccessor<false, true> AlphaAccessor(TargetLandscapeInfo, CurLayer.LayerInfoObj);
-					AlphaAccessor.SetData(TileMin.X, TileMin.Y, TileMax.X, TileMax.Y, InLayerInfo.LayerData.GetData(), ELandscapeLayerPaintingRestriction::None);
+					WriteChangedLandscapeRegion(
+						InLayerInfo.LayerData, TileMin.X, TileMin.Y, TileMax.X, TileMax.Y, ComponentSizeQuads,
+						bUpdateChangedRegionsOnly ? &LayerDataHashes.FindOrAdd(InLayerInfo.LayerName) : nullptr,
+						[&AlphaAccessor](int32 X1, int32 Y1, int32 X2, int32 Y2, const uint8* Data)
+						{
+							AlphaAccessor.SetData(X1, Y1, X2, Y2, Data, ELandscapeLayerPaintingRestriction::None);
+						});
 				}
 			}
 		}
@@ -1650,11 +1970,11 @@ bool FHoudiniLandscapeTranslator::OutputLandscape_EditableLayer(UHoudiniOutput*
 	}
 
 	// Update the output object
-	FHoudiniOutputObjectIdentifier OutputObjectIdentifier(Heightfield->ObjectId, GeoId, PartId, "EditableLayer");
 	FHoudiniOutputObject& OutputObj = InOutput->GetOutputObjects().FindOrAdd(OutputObjectIdentifier);
 	UHoudiniLandscapeEditLayer* LayerPtr = NewObject<UHoudiniLandscapeEditLayer>(InOutput);
 	LayerPtr->SetSoftPtr(TargetLandscape);
 	LayerPtr->LayerName = EditableLayerName;
+	LayerPtr->LayerDataHashes = MoveTemp(LayerDataHashes);
 	OutputObj.OutputObject = LayerPtr;
 	// Editable layers doesn't currently require any attributes / tokens to be cached.
 	// OutputObj.CachedAttributes = OutputAttributes;
@@ -2109,6 +2429,63 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
 	const bool NoResize,
 	const bool bOverrideZScale,
 	const float CustomZScale)
+{
+	if (HeightfieldFloatValues.Num() != HeightfieldVolumeInfo.XLength * HeightfieldVolumeInfo.YLength)
+		return false;
+
+	return ConvertHeightfieldWindowsToLandscapeData(
+		[&HeightfieldFloatValues](int32 InStart, int32 InLength) { return HeightfieldFloatValues.GetData() + InStart; },
+		HeightfieldVolumeInfo, FinalXSize, FinalYSize, FloatMin, FloatMax,
+		IntHeightData, LandscapeTransform, NoResize, bOverrideZScale, CustomZScale);
+}
+
+bool
+FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
+	const FHoudiniGeoPartObject* HGPO,
+	const int32& FinalXSize, const int32& FinalYSize,
+	float FloatMin, float FloatMax,
+	TArray< uint16 >& IntHeightData,
+	FTransform& LandscapeTransform,
+	const bool NoResize,
+	const bool bOverrideZScale,
+	const float CustomZScale)
+{
+	if (!HGPO)
+		return false;
+
+	// Only one window of float data is allocated at a time
+	TArray<float> WindowData;
+	auto ReadWindow = [HGPO, &WindowData](int32 InStart, int32 InLength) -> const float*
+	{
+		WindowData.SetNumUninitialized(InLength, false);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetHeightFieldData(
+			FHoudiniEngine::Get().GetSession(),
+			HGPO->GeoId, HGPO->PartId,
+			WindowData.GetData(), InStart, InLength))
+		{
+			HOUDINI_LOG_ERROR(TEXT("Failed to get the heightfield data: %s"), *FHoudiniEngineUtils::GetErrorDescription());
+			return nullptr;
+		}
+
+		return WindowData.GetData();
+	};
+
+	return ConvertHeightfieldWindowsToLandscapeData(
+		ReadWindow, HGPO->VolumeInfo, FinalXSize, FinalYSize, FloatMin, FloatMax,
+		IntHeightData, LandscapeTransform, NoResize, bOverrideZScale, CustomZScale);
+}
+
+bool
+FHoudiniLandscapeTranslator::ConvertHeightfieldWindowsToLandscapeData(
+	TFunctionRef<const float*(int32 InStart, int32 InLength)> ReadHeightfieldWindow,
+	const FHoudiniVolumeInfo& HeightfieldVolumeInfo,
+	const int32& FinalXSize, const int32& FinalYSize,
+	float FloatMin, float FloatMax,
+	TArray< uint16 >& IntHeightData,
+	FTransform& LandscapeTransform,
+	const bool NoResize,
+	const bool bOverrideZScale,
+	const float CustomZScale)
 {
 	IntHeightData.Empty();
 	LandscapeTransform.SetIdentity();
@@ -2193,23 +2570,48 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
 
 	// Converting the data from Houdini to Unreal
 	// For correct orientation in unreal, the point matrix has to be transposed.
+	// The data is read in windows of whole Houdini rows (X), each window is converted in parallel
+	// on square tiles, so both reads and writes stay cache friendly.
 	IntHeightData.SetNumUninitialized(SizeInPoints);
 
-	int32 nUnreal = 0;
-	for (int32 nY = 0; nY < HoudiniYSize; nY++)
+	const int32 TileSize = HoudiniHeightfieldConversionTileSize;
+	const int32 NumTilesY = FMath::DivideAndRoundUp(HoudiniYSize, TileSize);
+	const int32 NumRowsPerWindow = FMath::Max(1, HoudiniHeightfieldReadWindowSize / HoudiniYSize);
+	const double dFloatMin = (double)FloatMin;
+	for (int32 WindowStartX = 0; WindowStartX < HoudiniXSize; WindowStartX += NumRowsPerWindow)
 	{
-		for (int32 nX = 0; nX < HoudiniXSize; nX++)
+		const int32 WindowEndX = FMath::Min(WindowStartX + NumRowsPerWindow, HoudiniXSize);
+		const float* WindowData = ReadHeightfieldWindow(WindowStartX * HoudiniYSize, (WindowEndX - WindowStartX) * HoudiniYSize);
+		if (!WindowData)
 		{
-			// Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
-			int32 nHoudini = nY + nX * HoudiniYSize;
+			IntHeightData.Empty();
+			return false;
+		}
 
-			// Get the double values in [0 - ZRange]
-			double DoubleValue = (double)HeightfieldFloatValues[nHoudini] - (double)FloatMin;
+		const int32 NumTilesX = FMath::DivideAndRoundUp(WindowEndX - WindowStartX, TileSize);
+		ParallelFor(NumTilesX * NumTilesY, [&](int32 TileIdx)
+		{
+			const int32 StartX = WindowStartX + (TileIdx % NumTilesX) * TileSize;
+			const int32 StartY = (TileIdx / NumTilesX) * TileSize;
+			const int32 EndX = FMath::Min(StartX + TileSize, WindowEndX);
+			const int32 EndY = FMath::Min(StartY + TileSize, HoudiniYSize);
+			for (int32 nX = StartX; nX < EndX; nX++)
+			{
+				for (int32 nY = StartY; nY < EndY; nY++)
+				{
+					// Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
+					int32 nHoudini = nY + (nX - WindowStartX) * HoudiniYSize;
+					int32 nUnreal = nX + nY * HoudiniXSize;
 
-			// Then convert it to [0 - DesiredRange] and center it 
-			DoubleValue = DoubleValue * ZSpacing + DigitCenterOffset;
-			IntHeightData[nUnreal++] = FMath::RoundToInt(DoubleValue);
-		}
+					// Get the double values in [0 - ZRange]
+					double DoubleValue = (double)WindowData[nHoudini] - dFloatMin;
+
+					// Then convert it to [0 - DesiredRange] and center it 
+					DoubleValue = DoubleValue * ZSpacing + DigitCenterOffset;
+					IntHeightData[nUnreal] = FMath::RoundToInt(DoubleValue);
+				}
+			}
+		});
 	}
 
 	//--------------------------------------------------------------------------------------------------
@@ -2332,36 +2734,6 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
 	return true;
 }
 
-template<typename T>
-TArray<T> ResampleData(const TArray<T>& Data, int32 OldWidth, int32 OldHeight, int32 NewWidth, int32 NewHeight)
-{
-	TArray<T> Result;
-	Result.Empty(NewWidth * NewHeight);
-	Result.AddUninitialized(NewWidth * NewHeight);
-
-	const float XScale = (float)(OldWidth - 1) / (NewWidth - 1);
-	const float YScale = (float)(OldHeight - 1) / (NewHeight - 1);
-	for (int32 Y = 0; Y < NewHeight; ++Y)
-	{
-		for (int32 X = 0; X < NewWidth; ++X)
-		{
-			const float OldY = Y * YScale;
-			const float OldX = X * XScale;
-			const int32 X0 = FMath::FloorToInt(OldX);
-			const int32 X1 = FMath::Min(FMath::FloorToInt(OldX) + 1, OldWidth - 1);
-			const int32 Y0 = FMath::FloorToInt(OldY);
-			const int32 Y1 = FMath::Min(FMath::FloorToInt(OldY) + 1, OldHeight - 1);
-			const T& Original00 = Data[Y0 * OldWidth + X0];
-			const T& Original10 = Data[Y0 * OldWidth + X1];
-			const T& Original01 = Data[Y1 * OldWidth + X0];
-			const T& Original11 = Data[Y1 * OldWidth + X1];
-			Result[Y * NewWidth + X] = FMath::BiLerp(Original00, Original10, Original01, Original11, FMath::Fractional(OldX), FMath::Fractional(OldY));
-		}
-	}
-
-	return Result;
-}
-
 template<typename T>
 void ExpandData(T* OutData, const T* InData,
 	int32 OldMinX, int32 OldMinY, int32 OldMaxX, int32 OldMaxY,
@@ -2484,8 +2856,8 @@ FHoudiniLandscapeTranslator::ResizeHeightDataForLandscape(
 	else
 	{
 		// Resampling the data
-		NewData.SetNumUninitialized(NewSizeX * NewSizeY);
-		NewData = ResampleData(HeightData, SizeX, SizeY, NewSizeX, NewSizeY);
+		if (!FHoudiniLandscapeResampler::Resample(HeightData, SizeX, SizeY, NewData, NewSizeX, NewSizeY, GetLandscapeResampleMethod()))
+			return false;
 
 		// The landscape has been resized, we'll need to take that into account when sizing it
 		LandscapeResizeFactor.X = (float)SizeX / (float)NewSizeX;
@@ -2499,7 +2871,7 @@ FHoudiniLandscapeTranslator::ResizeHeightDataForLandscape(
 	}
 
 	// Replaces Old data with the new one
-	HeightData = NewData;
+	HeightData = MoveTemp(NewData);
 
 	return true;
 }
@@ -2799,25 +3171,96 @@ FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(const FHoudiniGeoPar
 		return false;
 	
 	const int32 SizeInPoints = VolumeInfo.xLength *  VolumeInfo.yLength;
+	if (SizeInPoints <= 0)
+		return false;
+
+	// The data is downloaded in windows. The min/max of each window is computed
+	// on the task graph while the next window is being downloaded.
+	OutFloatArr.SetNumUninitialized(SizeInPoints);
+	TArray<TFuture<TPair<float, float>>> WindowMinMaxFutures;
+	for (int32 WindowStart = 0; WindowStart < SizeInPoints; WindowStart += HoudiniHeightfieldReadWindowSize)
+	{
+		const int32 WindowLength = FMath::Min(HoudiniHeightfieldReadWindowSize, SizeInPoints - WindowStart);
+		float* WindowData = OutFloatArr.GetData() + WindowStart;
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetHeightFieldData(
+			FHoudiniEngine::Get().GetSession(),
+			HGPO->GeoId, HGPO->PartId,
+			WindowData, WindowStart, WindowLength))
+		{
+			// Wait for the pending tasks as they reference our buffer
+			for (auto& CurrentFuture : WindowMinMaxFutures)
+				CurrentFuture.Wait();
+
+			OutFloatArr.Empty();
+			HOUDINI_LOG_ERROR(TEXT("Failed to get the heightfield data: %s"), *FHoudiniEngineUtils::GetErrorDescription());
+			return false;
+		}
+
+		WindowMinMaxFutures.Add(Async(EAsyncExecution::TaskGraph, [WindowData, WindowLength]()
+		{
+			float WindowMin = WindowData[0];
+			float WindowMax = WindowData[0];
+			for (int32 Idx = 1; Idx < WindowLength; Idx++)
+			{
+				WindowMin = FMath::Min(WindowMin, WindowData[Idx]);
+				WindowMax = FMath::Max(WindowMax, WindowData[Idx]);
+			}
+			return TPair<float, float>(WindowMin, WindowMax);
+		}));
+	}
 
-	OutFloatArr.SetNum(SizeInPoints);
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetHeightFieldData(
-		FHoudiniEngine::Get().GetSession(),
-		HGPO->GeoId, HGPO->PartId,
-		OutFloatArr.GetData(),
-		0, SizeInPoints), false);
-	
 	OutFloatMin = OutFloatArr[0];
 	OutFloatMax = OutFloatMin;
+	for (auto& CurrentFuture : WindowMinMaxFutures)
+	{
+		const TPair<float, float> WindowMinMax = CurrentFuture.Get();
+		OutFloatMin = FMath::Min(OutFloatMin, WindowMinMax.Key);
+		OutFloatMax = FMath::Max(OutFloatMax, WindowMinMax.Value);
+	}
+
+	return true;
+}
+
+bool
+FHoudiniLandscapeTranslator::GetHoudiniHeightfieldMinMax(const FHoudiniGeoPartObject* HGPO, float &OutFloatMin, float &OutFloatMax)
+{
+	OutFloatMin = 0.f;
+	OutFloatMax = 0.f;
+
+	HAPI_VolumeInfo VolumeInfo;
+	if (!GetHoudiniHeightfieldVolumeInfo(HGPO, VolumeInfo))
+		return false;
+
+	const int32 SizeInPoints = VolumeInfo.xLength * VolumeInfo.yLength;
+	if (SizeInPoints <= 0)
+		return false;
 
-	for (float NextFloatVal : OutFloatArr) 
+	// Only one window of data is allocated at a time
+	TArray<float> WindowData;
+	for (int32 WindowStart = 0; WindowStart < SizeInPoints; WindowStart += HoudiniHeightfieldReadWindowSize)
 	{
-		if (NextFloatVal > OutFloatMax)
+		const int32 WindowLength = FMath::Min(HoudiniHeightfieldReadWindowSize, SizeInPoints - WindowStart);
+		WindowData.SetNumUninitialized(WindowLength, false);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetHeightFieldData(
+			FHoudiniEngine::Get().GetSession(),
+			HGPO->GeoId, HGPO->PartId,
+			WindowData.GetData(), WindowStart, WindowLength))
+		{
+			HOUDINI_LOG_ERROR(TEXT("Failed to get the heightfield data: %s"), *FHoudiniEngineUtils::GetErrorDescription());
+			return false;
+		}
+
+		if (WindowStart == 0)
 		{
-			OutFloatMax = NextFloatVal;
+			OutFloatMin = WindowData[0];
+			OutFloatMax = WindowData[0];
+		}
+
+		for (const float& Value : WindowData)
+		{
+			OutFloatMin = FMath::Min(OutFloatMin, Value);
+			OutFloatMax = FMath::Max(OutFloatMax, Value);
 		}
-		else if (NextFloatVal < OutFloatMin)
-			OutFloatMin = NextFloatVal;
 	}
 
 	return true;
@@ -2911,6 +3354,19 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 	// For Debugging, do we want to export layers as textures?
 	bool bExportTexture = CVarHoudiniEngineExportLandscapeTextures.GetValueOnAnyThread() == 1 ? true : false;
 
+	// Layers whose data is being converted.
+	// The conversions run on the task graph, while the data of the next layers is being fetched.
+	struct FPendingLandscapeLayer
+	{
+		FLandscapeImportLayerInfo ImportLayerInfo;
+		FHoudiniPackageParams TilePackageParams;
+		TFuture<bool> ConversionResult;
+	};
+
+	// The conversion tasks write directly in the pending layers, so the array must not be reallocated
+	TArray<FPendingLandscapeLayer> PendingLayers;
+	PendingLayers.Reserve(FoundLayers.Num());
+
 	// Try to create all the layers
 	ELandscapeImportAlphamapType ImportLayerType = ELandscapeImportAlphamapType::Additive;
 	for (TArray<const FHoudiniGeoPartObject *>::TConstIterator IterLayers(FoundLayers); IterLayers; ++IterLayers)
@@ -3003,15 +3459,6 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 			continue;
 		}
 
-		// Convert the float data to uint8
-		// HF masks need their X/Y sizes swapped
-		if (!FHoudiniLandscapeTranslator::ConvertHeightfieldLayerToLandscapeLayer(
-			FloatLayerData, LayerVolumeInfo.YLength, LayerVolumeInfo.XLength,
-			LayerMin, LayerMax,
-			LandscapeXSize, LandscapeYSize,
-			ImportLayerInfo.LayerData))
-			continue;
-		
 		// We will store the data used to convert from Houdini values to int in the DebugColor
 		// This is the only way we'll be able to reconvert those values back to their houdini equivalent afterwards...
 		// R = Min, G = Max, B = Spacing, A = ?
@@ -3034,23 +3481,6 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 			Package->MarkPackageDirty();
 			OutCreatedPackages.Add(Package);
 		}
-		
-		if (bExportTexture)
-		{
-			// Create an export of the converted data to texture
-			// FString TextureName = LayerString;
-			// if (LayerGeoPartObject->VolumeTileIndex >= 0)
-			// 	TextureName = TEXT("Tile") + FString::FromInt(LayerGeoPartObject->VolumeTileIndex) + TEXT("_") + LayerString;
-			// TextureName += TEXT("_conv");
-			
-			const FString TextureName = TilePackageParams.ObjectName + TEXT("_conv");
-
-			FHoudiniLandscapeTranslator::CreateUnrealTexture(
-				TilePackageParams,
-				TextureName,
-				LandscapeXSize, LandscapeYSize,
-				ImportLayerInfo.LayerData);
-		}
 
 		// See if there is a physical material assigned via attribute for that landscape layer
 		UPhysicalMaterial* PhysMaterial = FHoudiniLandscapeTranslator::GetLandscapePhysicalMaterial(*LayerGeoPartObject);
@@ -3061,7 +3491,46 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 
 		// Assign the layer info object to the import layer infos
 		ImportLayerInfo.LayerInfo = LayerInfo;
-		OutLayerInfos.Add(ImportLayerInfo);
+
+		FPendingLandscapeLayer& PendingLayer = PendingLayers.Add_GetRef(FPendingLandscapeLayer());
+		PendingLayer.ImportLayerInfo = ImportLayerInfo;
+		PendingLayer.TilePackageParams = TilePackageParams;
+
+		// Convert the float data to uint8 on the task graph, the float data is released once converted
+		// HF masks need their X/Y sizes swapped
+		TArray<uint8>* OutLayerData = &PendingLayer.ImportLayerInfo.LayerData;
+		const int32 HoudiniXSize = LayerVolumeInfo.YLength;
+		const int32 HoudiniYSize = LayerVolumeInfo.XLength;
+		PendingLayer.ConversionResult = Async(EAsyncExecution::TaskGraph,
+			[FloatLayerData = MoveTemp(FloatLayerData), HoudiniXSize, HoudiniYSize, LayerMin, LayerMax, LandscapeXSize, LandscapeYSize, OutLayerData]()
+		{
+			return FHoudiniLandscapeTranslator::ConvertHeightfieldLayerToLandscapeLayer(
+				FloatLayerData, HoudiniXSize, HoudiniYSize,
+				LayerMin, LayerMax,
+				LandscapeXSize, LandscapeYSize,
+				*OutLayerData);
+		});
+	}
+
+	// Wait for the conversions, and output the converted layers in their original order
+	for (FPendingLandscapeLayer& PendingLayer : PendingLayers)
+	{
+		if (!PendingLayer.ConversionResult.Get())
+			continue;
+
+		if (bExportTexture)
+		{
+			// Create an export of the converted data to texture
+			const FString TextureName = PendingLayer.TilePackageParams.ObjectName + TEXT("_conv");
+
+			FHoudiniLandscapeTranslator::CreateUnrealTexture(
+				PendingLayer.TilePackageParams,
+				TextureName,
+				LandscapeXSize, LandscapeYSize,
+				PendingLayer.ImportLayerInfo.LayerData);
+		}
+
+		OutLayerInfos.Add(MoveTemp(PendingLayer.ImportLayerInfo));
 	}
 
 	// Autosaving the layers prevents them for being deleted with the Asset
@@ -3306,9 +3775,10 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldLayerToLandscapeLayer(
 	double LayerZRange = (LayerMax - LayerMin);
 	double LayerZSpacing = (LayerZRange != 0.0) ? (255.0 / (double)(LayerZRange)) : 0.0;
 
-	int32 nUnrealIndex = 0;
-	for (int32 nY = 0; nY < HoudiniYSize; nY++)
+	// Rows are converted in parallel
+	ParallelFor(HoudiniYSize, [&](int32 nY)
 	{
+		int32 nUnrealIndex = nY * HoudiniXSize;
 		for (int32 nX = 0; nX < HoudiniXSize; nX++)
 		{
 			// Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
@@ -3322,7 +3792,7 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldLayerToLandscapeLayer(
 
 			LayerData[nUnrealIndex++] = FMath::RoundToInt(DoubleValue);
 		}
-	}
+	});
 
 	// Finally, resize the data to fit with the new landscape size if needed
 	if (NoResize)
@@ -3362,11 +3832,11 @@ FHoudiniLandscapeTranslator::ResizeLayerDataForLandscape(
 	else
 	{
 		// Resampling the data
-		NewData.SetNumUninitialized(NewSizeX * NewSizeY);
-		NewData = ResampleData(LayerData, SizeX, SizeY, NewSizeX, NewSizeY);
+		if (!FHoudiniLandscapeResampler::Resample(LayerData, SizeX, SizeY, NewData, NewSizeX, NewSizeY, GetLandscapeResampleMethod()))
+			return false;
 	}
 
-	LayerData = NewData;
+	LayerData = MoveTemp(NewData);
 
 	return true;
 }
@@ -4031,42 +4501,104 @@ FHoudiniLandscapeTranslator::UpdateGenericPropertiesAttributes(
 
 
 bool
-FHoudiniLandscapeTranslator::BackupLandscapeToImageFiles(const FString& BaseName, ALandscapeProxy* Landscape)
+FHoudiniLandscapeTranslator::BackupLandscapeToSnapshot(
+	const FString& BaseName, ALandscapeProxy* Landscape, UHoudiniAssetComponent* InOwnerHAC)
 {
-	// We need to cache the input landscape to a file    
-	if (!Landscape)
+	if (!Landscape || Landscape->IsPendingKill())
 		return false;
 
-	ULandscapeInfo* LandscapeInfo = Landscape->GetLandscapeInfo();
+	const FString SnapshotFile = BaseName + TEXT(".hlsnap");
+
+	// Reuse the previous backup if we have one, so only the components that changed since then are captured again
+	FHoudiniLandscapeSnapshotEntry& SnapshotEntry = HoudiniLandscapeSnapshots.FindOrAdd(SnapshotFile);
+	SnapshotEntry.OwnerHAC = InOwnerHAC;
+
+	FHoudiniLandscapeSnapshot& Snapshot = SnapshotEntry.Snapshot;
+	if (!Snapshot.IsValid() && FPaths::FileExists(SnapshotFile))
+		Snapshot.LoadFromFile(SnapshotFile);
+
+	const bool bCompress = CVarHoudiniEngineLandscapeSnapshotCompression.GetValueOnAnyThread() != 0;
+	if (!Snapshot.Capture(Landscape, bCompress))
+	{
+		HoudiniLandscapeSnapshots.Remove(SnapshotFile);
+		return false;
+	}
+
+	if (!Snapshot.SaveToFile(SnapshotFile))
+		HOUDINI_LOG_WARNING(TEXT("Could not save the landscape backup of %s to %s."), *Landscape->GetName(), *SnapshotFile);
+
+	Landscape->ReimportHeightmapFilePath = SnapshotFile;
+
+	return true;
+}
+
+
+bool
+FHoudiniLandscapeTranslator::RestoreLandscapeFromSnapshot(ALandscapeProxy* LandscapeProxy)
+{
+	if (!LandscapeProxy || LandscapeProxy->IsPendingKill())
+		return false;
+
+	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
 	if (!LandscapeInfo)
 		return false;
 
-	// Save Height data to file
-	//FString HeightSave = TEXT("/Game/HoudiniEngine/Temp/HeightCache.png");    
-	FString HeightSave = BaseName + TEXT("_height.png");
-	LandscapeInfo->ExportHeightmap(HeightSave);
-	Landscape->ReimportHeightmapFilePath = HeightSave;
+	// Landscapes backed up by older versions of the plugin use image files
+	const FString SnapshotFile = LandscapeProxy->ReimportHeightmapFilePath;
+	if (!FPaths::GetExtension(SnapshotFile).Equals(TEXT("hlsnap"), ESearchCase::IgnoreCase))
+		return RestoreLandscapeFromImageFiles(LandscapeProxy);
 
-	// Save each layer to a file
-	for (int LayerIndex = 0; LayerIndex < LandscapeInfo->Layers.Num(); LayerIndex++)
+	FHoudiniLandscapeSnapshotEntry* SnapshotEntry = HoudiniLandscapeSnapshots.Find(SnapshotFile);
+	FHoudiniLandscapeSnapshot* Snapshot = SnapshotEntry ? &SnapshotEntry->Snapshot : nullptr;
+	if (!Snapshot || !Snapshot->IsValid())
+	{
+		Snapshot = &HoudiniLandscapeSnapshots.FindOrAdd(SnapshotFile).Snapshot;
+		if (!Snapshot->LoadFromFile(SnapshotFile))
+		{
+			HoudiniLandscapeSnapshots.Remove(SnapshotFile);
+			HOUDINI_LOG_ERROR(TEXT("Could not load the landscape backup of %s from %s."), *LandscapeProxy->GetName(), *SnapshotFile);
+			return false;
+		}
+	}
+
+	TArray<ULandscapeLayerInfoObject*> SourceLayers;
+	if (!Snapshot->Restore(LandscapeProxy, SourceLayers))
+	{
+		// Keep the layers as they are, SourceLayers can't tell which ones were added by Houdini
+		HOUDINI_LOG_ERROR(TEXT("Could not restore the landscape actor's source data."));
+		return false;
+	}
+
+	// The backup isn't needed in memory anymore, it can still be loaded from its file
+	HoudiniLandscapeSnapshots.Remove(SnapshotFile);
+
+	// Remove any layer that could have been added by Houdini
+	for (int32 LayerIndex = LandscapeInfo->Layers.Num() - 1; LayerIndex >= 0; LayerIndex--)
 	{
-		FName CurrentLayerName = LandscapeInfo->Layers[LayerIndex].GetLayerName();
-		//ULandscapeLayerInfoObject* CurrentLayerInfo = LandscapeInfo->GetLayerInfoByName(CurrentLayerName, Landscape);
 		ULandscapeLayerInfoObject* CurrentLayerInfo = LandscapeInfo->Layers[LayerIndex].LayerInfoObj;
-		if (!CurrentLayerInfo || CurrentLayerInfo->IsPendingKill())
+		if (!CurrentLayerInfo || SourceLayers.Contains(CurrentLayerInfo))
 			continue;
 
-		FString LayerSave = BaseName + CurrentLayerName.ToString() + TEXT(".png");
-		LandscapeInfo->ExportLayer(CurrentLayerInfo, LayerSave);
-
-		// Update the file reimport path on the input landscape for this layer
-		LandscapeInfo->GetLayerEditorSettings(CurrentLayerInfo).ReimportLayerFilePath = LayerSave;
+		FName LayerName = LandscapeInfo->Layers[LayerIndex].LayerName;
+		LandscapeInfo->DeleteLayer(CurrentLayerInfo, LayerName);
 	}
 
 	return true;
 }
 
 
+void
+FHoudiniLandscapeTranslator::PruneLandscapeSnapshots()
+{
+	for (auto It = HoudiniLandscapeSnapshots.CreateIterator(); It; ++It)
+	{
+		const TWeakObjectPtr<UHoudiniAssetComponent>& OwnerHAC = It.Value().OwnerHAC;
+		if (!OwnerHAC.IsExplicitlyNull() && (!OwnerHAC.IsValid() || OwnerHAC->IsPendingKill()))
+			It.RemoveCurrent();
+	}
+}
+
+
 bool
 FHoudiniLandscapeTranslator::RestoreLandscapeFromImageFiles(ALandscapeProxy* LandscapeProxy)
 {
@@ -67,6 +67,14 @@ struct HOUDINIENGINE_API FHoudiniLandscapeTranslator
 			TSet<FString>& ClearedLayers,
 			TArray<UPackage*>& OutCreatedPackages);
 
+		// Called after each landscape tile has been output. When the memory used since the last release
+		// (InOutMemoryBaseline) exceeds the tile streaming budget, saves the packages created so far and
+		// releases unused memory before the next tile is processed.
+		// The objects the caller still needs must be referenced by its outputs, component or world.
+		static bool FlushLandscapeTileMemory(
+			TArray<UPackage*>& InOutCreatedPackages,
+			uint64& InOutMemoryBaseline);
+
 		static bool OutputLandscape_Temp(
 			UHoudiniOutput* InOutput,
 			TArray<TWeakObjectPtr<AActor>>& CreatedUntrackedActors,
@@ -233,6 +241,20 @@ struct HOUDINIENGINE_API FHoudiniLandscapeTranslator
 		static void DoPreEditChangeProperty(UObject* Obj, FName PropertyName);
 		static void DoPostEditChangeProperty(UObject* Obj, FName PropertyName);
 
+		// Converts the heightfield's values, provided in windows of whole rows by ReadHeightfieldWindow, to landscape data
+		static bool ConvertHeightfieldWindowsToLandscapeData(
+			TFunctionRef<const float*(int32 InStart, int32 InLength)> ReadHeightfieldWindow,
+			const FHoudiniVolumeInfo& HeightfieldVolumeInfo,
+			const int32& FinalXSize,
+			const int32& FinalYSize,
+			float FloatMin,
+			float FloatMax,
+			TArray< uint16 >& IntHeightData,
+			FTransform& LandscapeTransform,
+			const bool NoResize,
+			const bool bOverrideZScale,
+			const float CustomZScale);
+
 	public:
 
 
@@ -252,6 +274,12 @@ struct HOUDINIENGINE_API FHoudiniLandscapeTranslator
 			float &OutFloatMin,
 			float &OutFloatMax);
 
+		// Computes the min/max of the heightfield's values, downloading them in windows
+		static bool GetHoudiniHeightfieldMinMax(
+			const FHoudiniGeoPartObject* HGPO,
+			float &OutFloatMin,
+			float &OutFloatMax);
+
 		static bool CalcLandscapeSizeFromHeightfieldSize(
 			const int32& HoudiniSizeX,
 			const int32& HoudiniSizeY,
@@ -273,6 +301,20 @@ struct HOUDINIENGINE_API FHoudiniLandscapeTranslator
 			const bool bOverrideZScale = false,
 			const float CustomZScale = 100.f);
 
+		// Downloads the heightfield's values in windows and converts each window straight to landscape data,
+		// so the heightfield's float data is never entirely allocated.
+		static bool ConvertHeightfieldDataToLandscapeData(
+			const FHoudiniGeoPartObject* HGPO,
+			const int32& FinalXSize,
+			const int32& FinalYSize,
+			float FloatMin,
+			float FloatMax,
+			TArray< uint16 >& IntHeightData,
+			FTransform& LandscapeTransform,
+			const bool NoResize = false,
+			const bool bOverrideZScale = false,
+			const float CustomZScale = 100.f);
+
 		static bool ResizeHeightDataForLandscape(
 			TArray<uint16>& HeightData,
 			const int32& SizeX,
@@ -424,8 +466,15 @@ public:
 			UObject* InObject,
 			const TArray<FHoudiniGenericAttribute>& InAllPropertyAttributes);
 
-		static bool BackupLandscapeToImageFiles(
-			const FString& BaseName, ALandscapeProxy* Landscape);
+		// Backs up the landscape's height and layer data to a binary snapshot file
+		static bool BackupLandscapeToSnapshot(
+			const FString& BaseName, ALandscapeProxy* Landscape, UHoudiniAssetComponent* InOwnerHAC = nullptr);
+
+		// Restores the components of the landscape that changed since it was backed up
+		static bool RestoreLandscapeFromSnapshot(ALandscapeProxy* LandscapeProxy);
+
+		// Releases the in-memory backups of the HACs that have been destroyed
+		static void PruneLandscapeSnapshots();
 
 		static bool RestoreLandscapeFromImageFiles(ALandscapeProxy* LandscapeProxy);
 
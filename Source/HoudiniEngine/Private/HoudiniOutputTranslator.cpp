@@ -265,6 +265,7 @@ FHoudiniOutputTranslator::UpdateOutputs(
 	TMap<FString, UMaterialInterface*> AllOutputMaterials;
 
 	TArray<UPackage*> CreatedPackages;
+	uint64 LandscapeTileMemoryBaseline = FPlatformMemory::GetStats().UsedPhysical;
 	for (int32 OutputIdx = 0; OutputIdx < NumOutputs; OutputIdx++)
 	{
 		UHoudiniOutput* CurOutput = HAC->GetOutputAt(OutputIdx);
@@ -432,6 +433,12 @@ FHoudiniOutputTranslator::UpdateOutputs(
 				FEditorDelegates::PostLandscapeLayerUpdated.Broadcast();
 			}
 
+			// Keep memory usage bounded when outputting many tiles.
+			// The outputs, their materials and the input landscapes are referenced by the HAC and its world,
+			// but the outputs pending clear are only referenced here, so don't collect while there are any.
+			if (DeferredClearOutputs.Num() <= 0)
+				FHoudiniLandscapeTranslator::FlushLandscapeTileMemory(CreatedPackages, LandscapeTileMemoryBaseline);
+
 			bCreatedNewMaps |= bNewMapCreated;
 			break;
 		}
@@ -2079,7 +2086,7 @@ FHoudiniOutputTranslator::ClearOutput(UHoudiniOutput* Output)
 					
 					if (IsValid(ParentComponent))
 					{
-						FHoudiniInstanceTranslator::CleanupFoliageInstances(FoliageHISMC, OutputObject.Value.OutputObject, ParentComponent);
+						FHoudiniInstanceTranslator::CleanupFoliageInstances(FoliageHISMC, OutputObject.Value.OutputObject, ParentComponent, &OutputObject.Value.FoliageInstanceHashes);
 						FHoudiniEngineUtils::RepopulateFoliageTypeListInUI();
 					}
 				}
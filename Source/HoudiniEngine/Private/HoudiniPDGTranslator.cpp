@@ -47,6 +47,7 @@
 #include "HoudiniSplineComponent.h"
 #include "HoudiniSplineTranslator.h"
 #include "HoudiniTranslatorTypes.h"
+#include "HoudiniActorBoundsIndex.h"
 
 #define LOCTEXT_NAMESPACE "HoudiniEngine"
 
@@ -298,6 +299,7 @@ FHoudiniPDGTranslator::CreateAllResultObjectsFromPDGOutputs(
 	TArray<UHoudiniOutput*> InstancerOutputs;
 	TArray<UHoudiniOutput*> LandscapeOutputs;
 	TArray<UPackage*> CreatedPackages;
+	uint64 LandscapeTileMemoryBaseline = FPlatformMemory::GetStats().UsedPhysical;
 
 	//bool bCreatedNewMaps = false;
 	UWorld* PersistentWorld = InOuterComponent->GetTypedOuter<UWorld>();
@@ -397,6 +399,10 @@ FHoudiniPDGTranslator::CreateAllResultObjectsFromPDGOutputs(
 					CreatedPackages);
 				// Attach any landscape actors to InOuterComponent
 				LandscapeOutputs.Add(CurOutput);
+
+				// Keep memory usage bounded when outputting many tiles.
+				// The outputs and their materials are referenced by the work result object, the input landscapes by their world.
+				FHoudiniLandscapeTranslator::FlushLandscapeTileMemory(CreatedPackages, LandscapeTileMemoryBaseline);
 			}
 			break;
 
@@ -509,6 +515,11 @@ FHoudiniPDGTranslator::CreateAllResultObjectsFromPDGOutputs(
 		FEditorFileUtils::PromptForCheckoutAndSave(CreatedPackages, true, false);
 	}
 
+	// The output components have been rebuilt without any editor notification, update their bounds
+	USceneComponent* OuterSceneComponent = Cast<USceneComponent>(InOuterComponent);
+	if (IsValid(OuterSceneComponent))
+		FHoudiniActorBoundsIndex::Get().MarkActorDirty(OuterSceneComponent->GetOwner(), true);
+
 	return true;
 }
 
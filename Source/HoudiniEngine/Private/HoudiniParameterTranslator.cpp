@@ -57,6 +57,8 @@
 #include "HoudiniParameter.h"
 #include "HoudiniAssetComponent.h"
 
+#include "HAL/IConsoleManager.h"
+
 
 // Default values for certain UI min and max parameter values
 #define HAPI_UNREAL_PARAM_INT_UI_MIN				0
@@ -71,6 +73,16 @@
 #define HAPI_UNREAL_PARAM_PIVOT						"p"
 #define HAPI_UNREAL_PARAM_UNIFORMSCALE				"scale"
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineIncrementalParameterUpdate(
+	TEXT("HoudiniEngine.IncrementalParameterUpdate"),
+	1,
+	TEXT("When the parm layout of an asset hasn't changed after a cook, only refresh the parameter values instead of rebuilding the parameters.\n")
+	TEXT("0: Always rebuild the parameters.\n")
+	TEXT("1: Only refresh the values when possible.\n"));
+
+// Hash of the parm layout the parameters of each object were last built from
+static TMap<TWeakObjectPtr<UObject>, uint32> ParameterLayoutHashes;
+
 // 
 bool 
 FHoudiniParameterTranslator::UpdateParameters(UHoudiniAssetComponent* HAC)
@@ -217,6 +229,216 @@ FHoudiniParameterTranslator::UpdateLoadedParameters(UHoudiniAssetComponent* HAC)
 	return true;
 }
 
+// Sets the tab state of folder lists, and creates / updates the Points arrays of the ramp parameters
+static void
+UpdateFolderListsAndRamps(
+	TArray<UHoudiniParameter*>& NewParameters,
+	const TMap<UHoudiniParameterRampFloat*, int32>& FloatRampsToIndex,
+	const TMap<UHoudiniParameterRampColor*, int32>& ColorRampsToIndex)
+{
+	// Assign folder type to all folderlists, 
+	// if the first child of the folderlist is Tab or Radio button, set the bIsTabMenu of the folderlistParam to be true, otherwise false
+	for (int32 Idx = 0; Idx < NewParameters.Num(); ++Idx) 
+	{
+		UHoudiniParameter * CurParam = NewParameters[Idx];
+		if (!CurParam || CurParam->IsPendingKill())
+			continue;
+
+		if (CurParam->GetParameterType() == EHoudiniParameterType::FolderList) 
+		{
+			UHoudiniParameterFolderList* CurFolderList = Cast<UHoudiniParameterFolderList>(CurParam);
+			if (!CurFolderList || CurFolderList->IsPendingKill())
+				continue;
+
+			int32 FirstChildIdx = Idx + 1;
+			if (!NewParameters.IsValidIndex(FirstChildIdx))
+				continue;
+
+			UHoudiniParameterFolder* FirstChildFolder = Cast<UHoudiniParameterFolder>(NewParameters[FirstChildIdx]);
+			if (!FirstChildFolder || FirstChildFolder->IsPendingKill())
+				continue;
+
+			if (FirstChildFolder->GetFolderType() == EHoudiniFolderParameterType::Radio ||
+				FirstChildFolder->GetFolderType() == EHoudiniFolderParameterType::Tabs) 
+			{
+				// If this is the first time build
+				if (!CurFolderList->IsTabMenu())
+				{
+					// Set the folderlist to be tabs
+					CurFolderList->SetIsTabMenu(true);
+					// Select the first child tab folder by default.
+					FirstChildFolder->SetChosen(true); 
+				}
+			}
+			else
+				CurFolderList->SetIsTabMenu(false);
+		}
+	}
+
+	// Create / update the Points arrays for the ramp parameters
+	if (FloatRampsToIndex.Num() > 0)
+	{
+		for (TPair<UHoudiniParameterRampFloat*, int32> const& Entry : FloatRampsToIndex)
+		{
+			UHoudiniParameterRampFloat* const RampFloatParam = Entry.Key;
+			const int32 ParamIndex = Entry.Value;
+			if (!IsValid(RampFloatParam))
+				continue;
+
+			RampFloatParam->UpdatePointsArray(NewParameters, ParamIndex + 1);
+		}
+	}
+	if (ColorRampsToIndex.Num() > 0)
+	{
+		for (TPair<UHoudiniParameterRampColor*, int32> const& Entry : ColorRampsToIndex)
+		{
+			UHoudiniParameterRampColor* const RampColorParam = Entry.Key;
+			const int32 ParamIndex = Entry.Value;
+			if (!IsValid(RampColorParam))
+				continue;
+
+			RampColorParam->UpdatePointsArray(NewParameters, ParamIndex + 1);
+		}
+	}
+}
+
+// Hash of what decides which parameter is built for each parm: ids, types, sizes, value indices and multiparm instances
+static uint32
+GetParameterLayoutHash(const HAPI_NodeId& InNodeId, const TArray<HAPI_ParmInfo>& InParmInfos)
+{
+	uint32 Hash = HashCombine(GetTypeHash(InNodeId), GetTypeHash(InParmInfos.Num()));
+	for (const HAPI_ParmInfo& ParmInfo : InParmInfos)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(ParmInfo.id));
+		Hash = HashCombine(Hash, GetTypeHash(ParmInfo.parentId));
+		Hash = HashCombine(Hash, GetTypeHash(ParmInfo.childIndex));
+		Hash = HashCombine(Hash, GetTypeHash((int32)ParmInfo.type));
+		Hash = HashCombine(Hash, GetTypeHash((int32)ParmInfo.scriptType));
+		Hash = HashCombine(Hash, GetTypeHash((int32)ParmInfo.rampType));
+		Hash = HashCombine(Hash, GetTypeHash((int32)ParmInfo.choiceListType));
+		Hash = HashCombine(Hash, GetTypeHash(ParmInfo.size));
+		Hash = HashCombine(Hash, GetTypeHash(ParmInfo.choiceCount));
+		Hash = HashCombine(Hash, GetTypeHash(ParmInfo.tagCount));
+		Hash = HashCombine(Hash, GetTypeHash(ParmInfo.intValuesIndex));
+		Hash = HashCombine(Hash, GetTypeHash(ParmInfo.floatValuesIndex));
+		Hash = HashCombine(Hash, GetTypeHash(ParmInfo.stringValuesIndex));
+		Hash = HashCombine(Hash, GetTypeHash(ParmInfo.choiceIndex));
+		Hash = HashCombine(Hash, GetTypeHash(ParmInfo.instanceCount));
+		Hash = HashCombine(Hash, GetTypeHash(ParmInfo.instanceLength));
+		Hash = HashCombine(Hash, GetTypeHash(ParmInfo.instanceStartOffset));
+		Hash = HashCombine(Hash, GetTypeHash((bool)ParmInfo.isChildOfMultiParm));
+	}
+
+	return Hash;
+}
+
+// Refreshes parameters that were built from the same parm layout, without matching them by name again.
+// All the node's values are read with a single call per value type.
+static bool
+RefreshParameterValues(
+	const HAPI_NodeId& InNodeId,
+	const TArray<HAPI_ParmInfo>& InParmInfos,
+	const int32& InIntValueCount,
+	const int32& InFloatValueCount,
+	const int32& InStringValueCount,
+	const TArray<UHoudiniParameter*>& CurrentParameters,
+	TArray<UHoudiniParameter*>& NewParameters,
+	TMap<UHoudiniParameterRampFloat*, int32>& FloatRampsToIndex,
+	TMap<UHoudiniParameterRampColor*, int32>& ColorRampsToIndex)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(RefreshParameterValues);
+
+	TArray<int32> IntValues;
+	IntValues.SetNumZeroed(InIntValueCount);
+	if (InIntValueCount > 0)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmIntValues(
+			FHoudiniEngine::Get().GetSession(), InNodeId, IntValues.GetData(), 0, InIntValueCount), false);
+	}
+
+	TArray<float> FloatValues;
+	FloatValues.SetNumZeroed(InFloatValueCount);
+	if (InFloatValueCount > 0)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmFloatValues(
+			FHoudiniEngine::Get().GetSession(), InNodeId, FloatValues.GetData(), 0, InFloatValueCount), false);
+	}
+
+	TArray<HAPI_StringHandle> StringValues;
+	StringValues.SetNumZeroed(InStringValueCount);
+	if (InStringValueCount > 0)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmStringValues(
+			FHoudiniEngine::Get().GetSession(), InNodeId, false, StringValues.GetData(), 0, InStringValueCount), false);
+	}
+
+	TMap<HAPI_ParmId, int32> ParmInfoIndices;
+	ParmInfoIndices.Reserve(InParmInfos.Num());
+	for (int32 Idx = 0; Idx < InParmInfos.Num(); Idx++)
+		ParmInfoIndices.Add(InParmInfos[Idx].id, Idx);
+
+	int32 CurrentIdx = 0;
+	for (const HAPI_ParmInfo& ParmInfo : InParmInfos)
+	{
+		if (!CurrentParameters.IsValidIndex(CurrentIdx))
+			break;
+
+		// Parms that were skipped by the last full build have no parameter
+		UHoudiniParameter* CurrentParm = CurrentParameters[CurrentIdx];
+		if (!IsValid(CurrentParm))
+			return false;
+
+		if (CurrentParm->GetParmId() != ParmInfo.id)
+			continue;
+
+		CurrentIdx++;
+
+		// Parent folders can be hidden without changing the layout
+		bool bParentFolderVisible = true;
+		HAPI_ParmId ParentId = ParmInfo.parentId;
+		while (ParentId > 0)
+		{
+			const int32* ParentIdx = ParmInfoIndices.Find(ParentId);
+			if (!ParentIdx)
+				break;
+
+			const HAPI_ParmInfo& ParentInfo = InParmInfos[*ParentIdx];
+			if (ParentInfo.invisible && ParentInfo.type == HAPI_PARMTYPE_FOLDER)
+				bParentFolderVisible = false;
+			ParentId = ParentInfo.parentId;
+		}
+
+		// Without a node id, the values are read from the arrays we just fetched
+		if (!FHoudiniParameterTranslator::UpdateParameterFromInfo(
+			CurrentParm, -1, ParmInfo, false, true, &IntValues, &FloatValues, &StringValues, nullptr))
+			return false;
+
+		CurrentParm->SetNodeId(InNodeId);
+		CurrentParm->SetVisibleParent(bParentFolderVisible);
+
+		// Record float and color ramps for further processing (updating their Points arrays)
+		if (UHoudiniParameterRampFloat* FloatRampParam = Cast<UHoudiniParameterRampFloat>(CurrentParm))
+		{
+			FloatRampsToIndex.Add(FloatRampParam, NewParameters.Num());
+			UHoudiniAssetComponent* ParentHAC = Cast<UHoudiniAssetComponent>(FloatRampParam->GetOuter());
+			if (ParentHAC && !ParentHAC->HasBeenLoaded() && !ParentHAC->HasBeenDuplicated())
+				FloatRampParam->bCaching = false;
+		}
+		else if (UHoudiniParameterRampColor* ColorRampParam = Cast<UHoudiniParameterRampColor>(CurrentParm))
+		{
+			ColorRampsToIndex.Add(ColorRampParam, NewParameters.Num());
+			UHoudiniAssetComponent* ParentHAC = Cast<UHoudiniAssetComponent>(ColorRampParam->GetOuter());
+			if (ParentHAC && !ParentHAC->HasBeenLoaded() && !ParentHAC->HasBeenDuplicated())
+				ColorRampParam->bCaching = false;
+		}
+
+		NewParameters.Add(CurrentParm);
+	}
+
+	// All the current parameters must have been matched
+	return CurrentIdx == CurrentParameters.Num();
+}
+
 bool
 FHoudiniParameterTranslator::BuildAllParameters(
 	const HAPI_NodeId& AssetId, 
@@ -251,6 +473,11 @@ FHoudiniParameterTranslator::BuildAllParameters(
 	HAPI_NodeId NodeId = -1;
 	HAPI_AssetLibraryId AssetLibraryId = -1;
 	FString HoudiniAssetName;
+
+	// Value counts of the instantiated node
+	int32 NodeIntValueCount = 0;
+	int32 NodeFloatValueCount = 0;
+	int32 NodeStringValueCount = 0;
 	
 	if (AssetId >= 0)
 	{
@@ -275,6 +502,9 @@ FHoudiniParameterTranslator::BuildAllParameters(
 			FHoudiniEngine::Get().GetSession(), AssetInfo.nodeId, &NodeInfo), false);
 
 		ParmCount = NodeInfo.parmCount;
+		NodeIntValueCount = NodeInfo.parmIntValueCount;
+		NodeFloatValueCount = NodeInfo.parmFloatValueCount;
+		NodeStringValueCount = NodeInfo.parmStringValueCount;
 	}
 	else
 	{
@@ -387,6 +617,34 @@ FHoudiniParameterTranslator::BuildAllParameters(
 				FHoudiniEngine::Get().GetSession(), AssetLibraryId, TCHAR_TO_UTF8(*HoudiniAssetName), &ParmInfos[0], 0, ParmCount), false);
 	}
 
+	TMap<UHoudiniParameterRampFloat*, int32> FloatRampsToIndex;
+	TMap<UHoudiniParameterRampColor*, int32> ColorRampsToIndex;
+
+	// If the parm layout hasn't changed since the last build, the current parameters can be kept as they are,
+	// and only need their values to be refreshed
+	const uint32 LayoutHash = AssetId >= 0 ? GetParameterLayoutHash(NodeId, ParmInfos) : 0;
+	if (AssetId >= 0 && bUpdateValues && !InForceFullUpdate
+		&& CVarHoudiniEngineIncrementalParameterUpdate.GetValueOnAnyThread() != 0)
+	{
+		const uint32* LastLayoutHash = ParameterLayoutHashes.Find(Outer);
+		if (LastLayoutHash && *LastLayoutHash == LayoutHash)
+		{
+			if (RefreshParameterValues(
+				NodeId, ParmInfos, NodeIntValueCount, NodeFloatValueCount, NodeStringValueCount,
+				CurrentParameters, NewParameters, FloatRampsToIndex, ColorRampsToIndex))
+			{
+				CurrentParameters.Empty();
+				UpdateFolderListsAndRamps(NewParameters, FloatRampsToIndex, ColorRampsToIndex);
+				return true;
+			}
+
+			// Do a full rebuild instead
+			NewParameters.Empty();
+			FloatRampsToIndex.Empty();
+			ColorRampsToIndex.Empty();
+		}
+	}
+
 	// Create a name lookup cache for the current parameters
 	// Use an array has in some cases, multiple parameters can have the same name!
 	TMap<FString, TArray<UHoudiniParameter*>> CurrentParametersByName;
@@ -415,8 +673,6 @@ FHoudiniParameterTranslator::BuildAllParameters(
 	}
 
 	// Create properties for parameters.
-	TMap<UHoudiniParameterRampFloat*, int32> FloatRampsToIndex;
-	TMap<UHoudiniParameterRampColor*, int32> ColorRampsToIndex;
 	TArray<HAPI_ParmId> NewParmIds;
 	TArray<int32> AllMultiParams;
 	for (int32 ParamIdx = 0; ParamIdx < ParmCount; ++ParamIdx)
@@ -616,71 +872,20 @@ FHoudiniParameterTranslator::BuildAllParameters(
 		}
 	}
 
-	// Assign folder type to all folderlists, 
-	// if the first child of the folderlist is Tab or Radio button, set the bIsTabMenu of the folderlistParam to be true, otherwise false
-	for (int32 Idx = 0; Idx < NewParameters.Num(); ++Idx) 
-	{
-		UHoudiniParameter * CurParam = NewParameters[Idx];
-		if (!CurParam || CurParam->IsPendingKill())
-			continue;
-
-		if (CurParam->GetParameterType() == EHoudiniParameterType::FolderList) 
-		{
-			UHoudiniParameterFolderList* CurFolderList = Cast<UHoudiniParameterFolderList>(CurParam);
-			if (!CurFolderList || CurFolderList->IsPendingKill())
-				continue;
-
-			int32 FirstChildIdx = Idx + 1;
-			if (!NewParameters.IsValidIndex(FirstChildIdx))
-				continue;
+	UpdateFolderListsAndRamps(NewParameters, FloatRampsToIndex, ColorRampsToIndex);
 
-			UHoudiniParameterFolder* FirstChildFolder = Cast<UHoudiniParameterFolder>(NewParameters[FirstChildIdx]);
-			if (!FirstChildFolder || FirstChildFolder->IsPendingKill())
-				continue;
-
-			if (FirstChildFolder->GetFolderType() == EHoudiniFolderParameterType::Radio ||
-				FirstChildFolder->GetFolderType() == EHoudiniFolderParameterType::Tabs) 
-			{
-				// If this is the first time build
-				if (!CurFolderList->IsTabMenu())
-				{
-					// Set the folderlist to be tabs
-					CurFolderList->SetIsTabMenu(true);
-					// Select the first child tab folder by default.
-					FirstChildFolder->SetChosen(true); 
-				}
-			}
-			else
-				CurFolderList->SetIsTabMenu(false);
-		}
-	}
-
-	// Create / update the Points arrays for the ramp parameters
-	if (FloatRampsToIndex.Num() > 0)
+	// Remember the layout these parameters were built from
+	if (AssetId >= 0 && IsValid(Outer))
 	{
-		for (TPair<UHoudiniParameterRampFloat*, int32> const& Entry : FloatRampsToIndex)
+		for (auto It = ParameterLayoutHashes.CreateIterator(); It; ++It)
 		{
-			UHoudiniParameterRampFloat* const RampFloatParam = Entry.Key;
-			const int32 ParamIndex = Entry.Value;
-			if (!IsValid(RampFloatParam))
-				continue;
-
-			RampFloatParam->UpdatePointsArray(NewParameters, ParamIndex + 1);
+			if (!It.Key().IsValid())
+				It.RemoveCurrent();
 		}
-	}
-	if (ColorRampsToIndex.Num() > 0)
-	{
-		for (TPair<UHoudiniParameterRampColor*, int32> const& Entry : ColorRampsToIndex)
-		{
-			UHoudiniParameterRampColor* const RampColorParam = Entry.Key;
-			const int32 ParamIndex = Entry.Value;
-			if (!IsValid(RampColorParam))
-				continue;
 
-			RampColorParam->UpdatePointsArray(NewParameters, ParamIndex + 1);
-		}
+		ParameterLayoutHashes.Add(Outer, LayoutHash);
 	}
-	
+
 	return true;
 }
 
@@ -2577,6 +2782,105 @@ FHoudiniParameterTranslator::HapiGetParameterHasTag(const HAPI_NodeId& NodeId, c
 }
 
 
+// Adds the parameter's values to the batch, returns false for parameters that need to be uploaded on their own
+static bool
+AddParameterToUploadBatch(UHoudiniParameter* InParam, FHoudiniParameterUploadBatch& OutBatch)
+{
+	switch (InParam->GetParameterType())
+	{
+		case EHoudiniParameterType::Float:
+		{
+			UHoudiniParameterFloat* FloatParam = Cast<UHoudiniParameterFloat>(InParam);
+			if (!IsValid(FloatParam) || !FloatParam->GetValuesPtr())
+				return false;
+
+			OutBatch.AddFloatValues(
+				FloatParam->GetNodeId(), FloatParam->GetValueIndex(), FloatParam->GetValuesPtr(), FloatParam->GetTupleSize());
+		}
+		break;
+
+		case EHoudiniParameterType::Int:
+		{
+			UHoudiniParameterInt* IntParam = Cast<UHoudiniParameterInt>(InParam);
+			if (!IsValid(IntParam) || !IntParam->GetValuesPtr())
+				return false;
+
+			OutBatch.AddIntValues(
+				IntParam->GetNodeId(), IntParam->GetValueIndex(), IntParam->GetValuesPtr(), IntParam->GetTupleSize());
+		}
+		break;
+
+		case EHoudiniParameterType::Toggle:
+		{
+			UHoudiniParameterToggle* ToggleParam = Cast<UHoudiniParameterToggle>(InParam);
+			if (!IsValid(ToggleParam) || !ToggleParam->GetValuesPtr())
+				return false;
+
+			OutBatch.AddIntValues(
+				ToggleParam->GetNodeId(), ToggleParam->GetValueIndex(), ToggleParam->GetValuesPtr(), ToggleParam->GetTupleSize());
+		}
+		break;
+
+		case EHoudiniParameterType::Color:
+		{
+			UHoudiniParameterColor* ColorParam = Cast<UHoudiniParameterColor>(InParam);
+			if (!IsValid(ColorParam))
+				return false;
+
+			FLinearColor Color = ColorParam->GetColorValue();
+			OutBatch.AddFloatValues(
+				ColorParam->GetNodeId(), ColorParam->GetValueIndex(), (float*)(&Color.R), ColorParam->GetTupleSize() == 4 ? 4 : 3);
+		}
+		break;
+
+		case EHoudiniParameterType::IntChoice:
+		{
+			UHoudiniParameterChoice* ChoiceParam = Cast<UHoudiniParameterChoice>(InParam);
+			if (!IsValid(ChoiceParam))
+				return false;
+
+			const int32 IntValue = ChoiceParam->GetIntValue(ChoiceParam->GetIntValueIndex());
+			OutBatch.AddIntValues(ChoiceParam->GetNodeId(), ChoiceParam->GetValueIndex(), &IntValue, 1);
+		}
+		break;
+
+		case EHoudiniParameterType::StringChoice:
+		{
+			UHoudiniParameterChoice* ChoiceParam = Cast<UHoudiniParameterChoice>(InParam);
+			if (!IsValid(ChoiceParam))
+				return false;
+
+			if (ChoiceParam->IsStringChoice())
+			{
+				OutBatch.AddStringValue(ChoiceParam->GetNodeId(), ChoiceParam->GetParmId(), 0, ChoiceParam->GetStringValue());
+			}
+			else
+			{
+				const int32 IntValue = ChoiceParam->GetIntValueIndex();
+				OutBatch.AddIntValues(ChoiceParam->GetNodeId(), ChoiceParam->GetValueIndex(), &IntValue, 1);
+			}
+		}
+		break;
+
+		case EHoudiniParameterType::String:
+		{
+			UHoudiniParameterString* StringParam = Cast<UHoudiniParameterString>(InParam);
+			if (!IsValid(StringParam) || StringParam->GetNumberOfValues() <= 0)
+				return false;
+
+			for (int32 Idx = 0; Idx < StringParam->GetNumberOfValues(); Idx++)
+				OutBatch.AddStringValue(StringParam->GetNodeId(), StringParam->GetParmId(), Idx, StringParam->GetValueAt(Idx));
+		}
+		break;
+
+		default:
+			// Buttons, files, multiparms, ramps... are uploaded on their own
+			return false;
+	}
+
+	return true;
+}
+
 bool
 FHoudiniParameterTranslator::UploadChangedParameters( UHoudiniAssetComponent * HAC )
 {
@@ -2593,12 +2897,42 @@ FHoudiniParameterTranslator::UploadChangedParameters( UHoudiniAssetComponent * H
 	// parameter values after the insert.
 	TArray<UHoudiniParameter*> RampsToUpload;
 
+	// Simple float/int/string values are sent in batches, merged into contiguous value ranges.
+	// The batch is flushed before any parameter that is uploaded on its own, as these can change the node's layout
+	FHoudiniParameterUploadBatch UploadBatch;
+	TArray<UHoudiniParameter*> BatchedParams;
+	auto FlushUploadBatch = [&UploadBatch, &BatchedParams]()
+	{
+		if (UploadBatch.IsEmpty())
+			return;
+
+		const bool bBatchSuccess = UploadBatch.Upload();
+		for (UHoudiniParameter* BatchedParam : BatchedParams)
+		{
+			// If the batch failed, upload the parameters one by one to find which ones failed
+			if (bBatchSuccess || UploadParameterValue(BatchedParam))
+				BatchedParam->MarkChanged(false);
+			else
+				BatchedParam->SetNeedsToTriggerUpdate(false);
+		}
+
+		BatchedParams.Empty();
+	};
+
 	for (int32 ParmIdx = 0; ParmIdx < HAC->GetNumParameters(); ParmIdx++)
 	{
 		UHoudiniParameter*& CurrentParm = HAC->Parameters[ParmIdx];
 		if (!CurrentParm || CurrentParm->IsPendingKill() || !CurrentParm->HasChanged())
 			continue;
 
+		if (!CurrentParm->IsPendingRevertToDefault() && AddParameterToUploadBatch(CurrentParm, UploadBatch))
+		{
+			BatchedParams.Add(CurrentParm);
+			continue;
+		}
+
+		FlushUploadBatch();
+
 		bool bSuccess = false;
 
 		const EHoudiniParameterType CurrentParmType = CurrentParm->GetParameterType();
@@ -2638,6 +2972,8 @@ FHoudiniParameterTranslator::UploadChangedParameters( UHoudiniAssetComponent * H
 		}
 	}
 
+	FlushUploadBatch();
+
 	FHoudiniParameterTranslator::RevertRampParameters(RampsToRevert, HAC->GetAssetId());
 
 	for (UHoudiniParameter* const RampParam : RampsToUpload)
@@ -2652,6 +2988,168 @@ FHoudiniParameterTranslator::UploadChangedParameters( UHoudiniAssetComponent * H
 	return true;
 }
 
+void
+FHoudiniParameterUploadBatch::AddFloatValues(const HAPI_NodeId& InNodeId, const int32& InValueIndex, const float* InValues, const int32& InCount)
+{
+	if (!InValues || InCount <= 0)
+		return;
+
+	PendingFloats.Add({ InNodeId, InValueIndex, InCount, FloatValues.Num() });
+	FloatValues.Append(InValues, InCount);
+}
+
+void
+FHoudiniParameterUploadBatch::AddIntValues(const HAPI_NodeId& InNodeId, const int32& InValueIndex, const int32* InValues, const int32& InCount)
+{
+	if (!InValues || InCount <= 0)
+		return;
+
+	PendingInts.Add({ InNodeId, InValueIndex, InCount, IntValues.Num() });
+	IntValues.Append(InValues, InCount);
+}
+
+void
+FHoudiniParameterUploadBatch::AddStringValue(const HAPI_NodeId& InNodeId, const HAPI_ParmId& InParmId, const int32& InIndex, const FString& InValue)
+{
+	// Only keep the last value set for a given string
+	PendingStrings.RemoveAll([&](const FPendingString& Pending)
+	{
+		return Pending.NodeId == InNodeId && Pending.ParmId == InParmId && Pending.Index == InIndex;
+	});
+
+	PendingStrings.Add({ InNodeId, InParmId, InIndex, InValue });
+}
+
+bool
+FHoudiniParameterUploadBatch::IsEmpty() const
+{
+	return PendingFloats.Num() <= 0 && PendingInts.Num() <= 0 && PendingStrings.Num() <= 0;
+}
+
+void
+FHoudiniParameterUploadBatch::Empty()
+{
+	PendingFloats.Empty();
+	FloatValues.Empty();
+	PendingInts.Empty();
+	IntValues.Empty();
+	PendingStrings.Empty();
+}
+
+template<typename ValueType>
+void
+FHoudiniParameterUploadBatch::MergeValueRanges(
+	const TArray<FPendingValues>& InPending, const TArray<ValueType>& InValues,
+	TArray<FHoudiniParameterValueRange<ValueType>>& OutRanges)
+{
+	OutRanges.Empty();
+	if (InPending.Num() <= 0)
+		return;
+
+	// Sort the pending values by node and value index
+	TArray<int32> SortedIndices;
+	SortedIndices.SetNumUninitialized(InPending.Num());
+	for (int32 Idx = 0; Idx < InPending.Num(); Idx++)
+		SortedIndices[Idx] = Idx;
+
+	SortedIndices.Sort([&InPending](const int32& A, const int32& B)
+	{
+		if (InPending[A].NodeId != InPending[B].NodeId)
+			return InPending[A].NodeId < InPending[B].NodeId;
+		return InPending[A].ValueIndex < InPending[B].ValueIndex;
+	});
+
+	// Merge touching or overlapping values into ranges
+	TArray<int32> RangeIndices;
+	RangeIndices.SetNumUninitialized(InPending.Num());
+	TArray<int32> RangeEnds;
+	for (const int32& PendingIdx : SortedIndices)
+	{
+		const FPendingValues& Pending = InPending[PendingIdx];
+		const int32 LastRangeIdx = OutRanges.Num() - 1;
+		if (LastRangeIdx >= 0 && OutRanges[LastRangeIdx].NodeId == Pending.NodeId && Pending.ValueIndex <= RangeEnds[LastRangeIdx])
+		{
+			RangeEnds[LastRangeIdx] = FMath::Max(RangeEnds[LastRangeIdx], Pending.ValueIndex + Pending.Count);
+		}
+		else
+		{
+			FHoudiniParameterValueRange<ValueType>& NewRange = OutRanges.AddDefaulted_GetRef();
+			NewRange.NodeId = Pending.NodeId;
+			NewRange.StartIndex = Pending.ValueIndex;
+			RangeEnds.Add(Pending.ValueIndex + Pending.Count);
+		}
+
+		RangeIndices[PendingIdx] = OutRanges.Num() - 1;
+	}
+
+	for (int32 RangeIdx = 0; RangeIdx < OutRanges.Num(); RangeIdx++)
+		OutRanges[RangeIdx].Values.SetNumZeroed(RangeEnds[RangeIdx] - OutRanges[RangeIdx].StartIndex);
+
+	// Fill the ranges in the order the values were added, so later values win
+	for (int32 PendingIdx = 0; PendingIdx < InPending.Num(); PendingIdx++)
+	{
+		const FPendingValues& Pending = InPending[PendingIdx];
+		FHoudiniParameterValueRange<ValueType>& Range = OutRanges[RangeIndices[PendingIdx]];
+		FMemory::Memcpy(
+			&Range.Values[Pending.ValueIndex - Range.StartIndex], &InValues[Pending.Offset], Pending.Count * sizeof(ValueType));
+	}
+}
+
+void
+FHoudiniParameterUploadBatch::BuildRanges(
+	TArray<FHoudiniParameterValueRange<float>>& OutFloatRanges,
+	TArray<FHoudiniParameterValueRange<int32>>& OutIntRanges) const
+{
+	MergeValueRanges(PendingFloats, FloatValues, OutFloatRanges);
+	MergeValueRanges(PendingInts, IntValues, OutIntRanges);
+}
+
+int32
+FHoudiniParameterUploadBatch::GetNumUploadCalls() const
+{
+	TArray<FHoudiniParameterValueRange<float>> FloatRanges;
+	TArray<FHoudiniParameterValueRange<int32>> IntRanges;
+	BuildRanges(FloatRanges, IntRanges);
+
+	// HAPI has no call to set multiple strings, so each string value needs its own call
+	return FloatRanges.Num() + IntRanges.Num() + PendingStrings.Num();
+}
+
+bool
+FHoudiniParameterUploadBatch::Upload()
+{
+	TArray<FHoudiniParameterValueRange<float>> FloatRanges;
+	TArray<FHoudiniParameterValueRange<int32>> IntRanges;
+	BuildRanges(FloatRanges, IntRanges);
+
+	TArray<FPendingString> Strings = MoveTemp(PendingStrings);
+	Empty();
+
+	for (const FHoudiniParameterValueRange<float>& Range : FloatRanges)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetParmFloatValues(
+			FHoudiniEngine::Get().GetSession(),
+			Range.NodeId, Range.Values.GetData(), Range.StartIndex, Range.Values.Num()), false);
+	}
+
+	for (const FHoudiniParameterValueRange<int32>& Range : IntRanges)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetParmIntValues(
+			FHoudiniEngine::Get().GetSession(),
+			Range.NodeId, Range.Values.GetData(), Range.StartIndex, Range.Values.Num()), false);
+	}
+
+	for (const FPendingString& String : Strings)
+	{
+		std::string ConvertedString = TCHAR_TO_UTF8(*String.Value);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetParmStringValue(
+			FHoudiniEngine::Get().GetSession(),
+			String.NodeId, ConvertedString.c_str(), String.ParmId, String.Index), false);
+	}
+
+	return true;
+}
+
 bool
 FHoudiniParameterTranslator::UploadParameterValue(UHoudiniParameter* InParam)
 {
@@ -155,4 +155,73 @@ struct HOUDINIENGINE_API FHoudiniParameterTranslator
 		const HAPI_ParmInfo* ParamInfo);
 
 	static bool RevertRampParameters(TMap<FString, UHoudiniParameter*> & InRampParams, const int32 & AssetId);
+};
+
+// A contiguous range of parameter values of a node, sent with a single HAPI call
+template<typename ValueType>
+struct FHoudiniParameterValueRange
+{
+	HAPI_NodeId NodeId = -1;
+	int32 StartIndex = 0;
+	TArray<ValueType> Values;
+};
+
+// Collects the values of changed parameters so they can be sent with as few HAPI calls as possible.
+// Float and int values are merged by value index into contiguous ranges per node.
+struct HOUDINIENGINE_API FHoudiniParameterUploadBatch
+{
+public:
+
+	void AddFloatValues(const HAPI_NodeId& InNodeId, const int32& InValueIndex, const float* InValues, const int32& InCount);
+
+	void AddIntValues(const HAPI_NodeId& InNodeId, const int32& InValueIndex, const int32* InValues, const int32& InCount);
+
+	void AddStringValue(const HAPI_NodeId& InNodeId, const HAPI_ParmId& InParmId, const int32& InIndex, const FString& InValue);
+
+	bool IsEmpty() const;
+
+	void Empty();
+
+	// Merges the added values into contiguous ranges.
+	// Values added later overwrite earlier values at the same index.
+	void BuildRanges(
+		TArray<FHoudiniParameterValueRange<float>>& OutFloatRanges,
+		TArray<FHoudiniParameterValueRange<int32>>& OutIntRanges) const;
+
+	// Number of HAPI calls needed to send the batch
+	int32 GetNumUploadCalls() const;
+
+	// Sends all the values then empties the batch
+	bool Upload();
+
+protected:
+
+	struct FPendingValues
+	{
+		HAPI_NodeId NodeId;
+		int32 ValueIndex;
+		int32 Count;
+		int32 Offset;
+	};
+
+	struct FPendingString
+	{
+		HAPI_NodeId NodeId;
+		HAPI_ParmId ParmId;
+		int32 Index;
+		FString Value;
+	};
+
+	template<typename ValueType>
+	static void MergeValueRanges(
+		const TArray<FPendingValues>& InPending, const TArray<ValueType>& InValues,
+		TArray<FHoudiniParameterValueRange<ValueType>>& OutRanges);
+
+	TArray<FPendingValues> PendingFloats;
+	TArray<float> FloatValues;
+
+	TArray<FPendingValues> PendingInts;
+	TArray<int32> IntValues;
+
+	TArray<FPendingString> PendingStrings;
 };
\ No newline at end of file
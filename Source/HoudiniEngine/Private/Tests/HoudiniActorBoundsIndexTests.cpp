@@ -0,0 +1,76 @@
+#include "HoudiniActorBoundsIndex.h"
+#include "Misc/AutomationTest.h"
+
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Components/StaticMeshComponent.h"
+
+#if WITH_EDITOR
+	#include "Editor.h"
+#endif
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniActorBoundsIndexTest, "Houdini.Input.ActorBoundsIndex", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniActorBoundsIndexTest::RunTest(const FString & Parameters)
+{
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Editor world"), World) || !TestNotNull(TEXT("Cube mesh"), Mesh))
+		return false;
+
+	// Spawn a row of cubes far from the level's content, in reverse spatial order
+	const FVector Origin(1000000.0f, 1000000.0f, 0.0f);
+	const int32 NumActors = 8;
+	TArray<AActor*> Actors;
+	for (int32 Idx = 0; Idx < NumActors; Idx++)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags = RF_Transient;
+		AStaticMeshActor* Actor = World->SpawnActor<AStaticMeshActor>(
+			Origin + FVector((NumActors - Idx) * 1000.0f, 0.0f, 0.0f), FRotator::ZeroRotator, SpawnParams);
+		Actor->GetStaticMeshComponent()->SetStaticMesh(Mesh);
+		Actors.Add(Actor);
+	}
+
+	// Only keep our actors from the results, in the order they were returned
+	auto FindActors = [&](FHoudiniActorBoundsIndex& InIndex, const FBox& InBox)
+	{
+		TArray<AActor*> FoundActors;
+		InIndex.FindActorsIntersecting(World, { InBox }, FoundActors);
+		FoundActors.RemoveAll([&](AActor* InActor) { return !Actors.Contains(InActor); });
+		return FoundActors;
+	};
+
+	FHoudiniActorBoundsIndex Index;
+	const FBox AllActorsBox(Origin, Origin + FVector((NumActors + 1) * 1000.0f, 100.0f, 100.0f));
+	TArray<AActor*> FoundActors = FindActors(Index, AllActorsBox);
+	bool bSuccess = TestEqual(TEXT("All the actors are found"), FoundActors.Num(), NumActors);
+	bSuccess &= TestTrue(TEXT("Actors are returned in level order"), FoundActors == Actors);
+
+	// Only the first cube is in this box
+	const FBox FirstActorBox = Actors[0]->GetComponentsBoundingBox(true);
+	FoundActors = FindActors(Index, FirstActorBox);
+	bSuccess &= TestTrue(TEXT("Only the first actor is found"), FoundActors.Num() == 1 && FoundActors[0] == Actors[0]);
+
+	// Move the last cube in the first box without any editor notification, as when an HDA rebuilds its outputs
+	Actors.Last()->SetActorLocation(Actors[0]->GetActorLocation() + FVector(0.0f, 10.0f, 0.0f));
+	Index.MarkActorDirty(Actors.Last());
+	FoundActors = FindActors(Index, FirstActorBox);
+	bSuccess &= TestEqual(TEXT("The moved actor is found after being marked dirty"), FoundActors.Num(), 2);
+	bSuccess &= TestTrue(TEXT("The moved actor keeps its level order"), FoundActors.Num() == 2 && FoundActors[1] == Actors.Last());
+
+	// Deleted actors are not returned anymore
+	World->DestroyActor(Actors[0]);
+	Actors.RemoveAt(0);
+	FoundActors = FindActors(Index, FirstActorBox);
+	bSuccess &= TestTrue(TEXT("The deleted actor isn't found"), FoundActors.Num() == 1 && FoundActors[0] == Actors.Last());
+
+	for (AActor* Actor : Actors)
+		World->DestroyActor(Actor);
+
+	return bSuccess;
+}
+
+#endif
@@ -0,0 +1,116 @@
+#include "../HoudiniInstanceTranslator.h"
+#include "HoudiniGeoPartObject.h"
+#include "Misc/AutomationTest.h"
+
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "InstancedFoliageActor.h"
+
+#if WITH_EDITOR
+	#include "Editor.h"
+#endif
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniFoliageSharedTypeTest, "Houdini.Instancer.FoliageSharedType", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniFoliageSharedTypeTest::RunTest(const FString & Parameters)
+{
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Editor world"), World) || !TestNotNull(TEXT("Cube mesh"), Mesh))
+		return false;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.ObjectFlags = RF_Transient;
+	AStaticMeshActor* ParentActor = World->SpawnActor<AStaticMeshActor>(FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+	USceneComponent* ParentComponent = ParentActor ? ParentActor->GetRootComponent() : nullptr;
+	if (!TestNotNull(TEXT("Parent component"), ParentComponent))
+		return false;
+
+	auto MakeTransforms = [](const float& InY, const int32& InCount)
+	{
+		TArray<FTransform> Transforms;
+		for (int32 Idx = 0; Idx < InCount; Idx++)
+			Transforms.Add(FTransform(FVector(Idx * 100.0f, InY, 0.0f)));
+		return Transforms;
+	};
+
+	// Two instancers sharing the same foliage type (created for the mesh) and parent component
+	const TArray<FTransform> TransformsA = MakeTransforms(0.0f, 4);
+	const TArray<FTransform> TransformsB = MakeTransforms(500.0f, 3);
+
+	FHoudiniGeoPartObject HGPO;
+	TArray<FHoudiniGenericAttribute> PropertyAttributes;
+	TArray<uint32> HashesA;
+	TArray<uint32> HashesB;
+	USceneComponent* ComponentA = nullptr;
+	USceneComponent* ComponentB = nullptr;
+	bool bSuccess = TestTrue(TEXT("Create instancer A"), FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
+		Mesh, nullptr, TransformsA, 0, PropertyAttributes, HGPO, ParentComponent, ComponentA, nullptr, &HashesA));
+	bSuccess &= TestTrue(TEXT("Create instancer B"), FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
+		Mesh, nullptr, TransformsB, 0, PropertyAttributes, HGPO, ParentComponent, ComponentB, nullptr, &HashesB));
+
+	// Move two of A's instances and remove one
+	TArray<FTransform> UpdatedTransformsA = TransformsA;
+	UpdatedTransformsA[1].SetLocation(FVector(100.0f, -300.0f, 0.0f));
+	UpdatedTransformsA[2].SetLocation(FVector(200.0f, -300.0f, 0.0f));
+	UpdatedTransformsA.RemoveAt(3);
+	bSuccess &= TestTrue(TEXT("Update instancer A"), FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
+		Mesh, nullptr, UpdatedTransformsA, 0, PropertyAttributes, HGPO, ParentComponent, ComponentA, nullptr, &HashesA));
+
+	AInstancedFoliageActor* IFA = AInstancedFoliageActor::GetInstancedFoliageActorForLevel(World->GetCurrentLevel(), false);
+	UFoliageType* FoliageType = IFA ? IFA->GetLocalFoliageTypeForSource(Mesh) : nullptr;
+	const FFoliageInfo* FoliageInfo = FoliageType ? IFA->FindInfo(FoliageType) : nullptr;
+
+	// Only count the instances of our parent component, the level can have other cube foliage
+	auto CountParentInstances = [&]()
+	{
+		int32 Count = 0;
+		for (const FFoliageInstance& Instance : FoliageInfo->Instances)
+		{
+			if (Instance.BaseComponent == ParentComponent)
+				Count++;
+		}
+		return Count;
+	};
+
+	if (TestNotNull(TEXT("Foliage info"), FoliageInfo))
+	{
+		auto CountInstances = [&](const TArray<FTransform>& InTransforms)
+		{
+			int32 Count = 0;
+			for (const FTransform& Transform : InTransforms)
+			{
+				for (const FFoliageInstance& Instance : FoliageInfo->Instances)
+				{
+					if (Instance.BaseComponent == ParentComponent && Instance.Location.Equals(Transform.GetLocation()))
+					{
+						Count++;
+						break;
+					}
+				}
+			}
+			return Count;
+		};
+
+		bSuccess &= TestEqual(TEXT("Instancer B's instances are kept"), CountInstances(TransformsB), TransformsB.Num());
+		bSuccess &= TestEqual(TEXT("Instancer A's instances are updated"), CountInstances(UpdatedTransformsA), UpdatedTransformsA.Num());
+		bSuccess &= TestEqual(TEXT("Total instance count"), CountParentInstances(), UpdatedTransformsA.Num() + TransformsB.Num());
+		bSuccess &= TestEqual(TEXT("Instancer A's ownership record"), HashesA.Num(), UpdatedTransformsA.Num());
+	}
+
+	// Removing A's instances leaves B's untouched
+	FHoudiniInstanceTranslator::CleanupFoliageInstances(Cast<UHierarchicalInstancedStaticMeshComponent>(ComponentA), FoliageType, ParentComponent, &HashesA);
+	FoliageInfo = FoliageType ? IFA->FindInfo(FoliageType) : nullptr;
+	if (TestNotNull(TEXT("Foliage info after cleanup"), FoliageInfo))
+		bSuccess &= TestEqual(TEXT("Only instancer B's instances remain"), CountParentInstances(), TransformsB.Num());
+
+	FHoudiniInstanceTranslator::CleanupFoliageInstances(Cast<UHierarchicalInstancedStaticMeshComponent>(ComponentB), FoliageType, ParentComponent, &HashesB);
+	World->DestroyActor(ParentActor);
+
+	return bSuccess;
+}
+
+#endif
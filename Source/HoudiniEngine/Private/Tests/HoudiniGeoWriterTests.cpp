@@ -0,0 +1,230 @@
+#include "../HoudiniGeoWriter.h"
+#include "HoudiniApi.h"
+#include "../HoudiniEngine.h"
+#include "../HoudiniEngineUtils.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Writes a triangulated grid with the same kind of attributes as an input static mesh
+static bool
+WriteGridGeo(FHoudiniGeoWriter& GeoWriter, const HAPI_NodeId& NodeId, const int32& GridSize)
+{
+	const int32 NumPoints = (GridSize + 1) * (GridSize + 1);
+	const int32 NumFaces = GridSize * GridSize * 2;
+
+	HAPI_PartInfo Part;
+	FHoudiniApi::PartInfo_Init(&Part);
+	Part.type = HAPI_PARTTYPE_MESH;
+	Part.pointCount = NumPoints;
+	Part.vertexCount = NumFaces * 3;
+	Part.faceCount = NumFaces;
+	if (GeoWriter.SetPartInfo(NodeId, 0, &Part) != HAPI_RESULT_SUCCESS)
+		return false;
+
+	TArray<float> Positions;
+	Positions.Reserve(NumPoints * 3);
+	for (int32 Y = 0; Y <= GridSize; Y++)
+	{
+		for (int32 X = 0; X <= GridSize; X++)
+		{
+			Positions.Add(X * 0.01f);
+			Positions.Add(FMath::Sin(X * 0.1f) * FMath::Cos(Y * 0.1f));
+			Positions.Add(Y * 0.01f);
+		}
+	}
+
+	TArray<int32> Vertices;
+	TArray<float> UVs;
+	Vertices.Reserve(NumFaces * 3);
+	UVs.Reserve(NumFaces * 9);
+	for (int32 Y = 0; Y < GridSize; Y++)
+	{
+		for (int32 X = 0; X < GridSize; X++)
+		{
+			const int32 P0 = Y * (GridSize + 1) + X;
+			const int32 Quad[6] = { P0, P0 + GridSize + 1, P0 + 1, P0 + 1, P0 + GridSize + 1, P0 + GridSize + 2 };
+			for (int32 Point : Quad)
+			{
+				Vertices.Add(Point);
+				UVs.Add((float)(Point % (GridSize + 1)) / GridSize);
+				UVs.Add((float)(Point / (GridSize + 1)) / GridSize);
+				UVs.Add(0.0f);
+			}
+		}
+	}
+
+	HAPI_AttributeInfo PointInfo;
+	FHoudiniApi::AttributeInfo_Init(&PointInfo);
+	PointInfo.count = NumPoints;
+	PointInfo.tupleSize = 3;
+	PointInfo.exists = true;
+	PointInfo.owner = HAPI_ATTROWNER_POINT;
+	PointInfo.storage = HAPI_STORAGETYPE_FLOAT;
+	if (GeoWriter.AddAttribute(NodeId, 0, "P", &PointInfo) != HAPI_RESULT_SUCCESS
+		|| GeoWriter.SetAttributeFloatData(NodeId, 0, "P", &PointInfo, Positions.GetData(), 0, NumPoints) != HAPI_RESULT_SUCCESS)
+		return false;
+
+	HAPI_AttributeInfo UVInfo = PointInfo;
+	UVInfo.count = Vertices.Num();
+	UVInfo.owner = HAPI_ATTROWNER_VERTEX;
+	if (GeoWriter.AddAttribute(NodeId, 0, "uv", &UVInfo) != HAPI_RESULT_SUCCESS
+		|| GeoWriter.SetAttributeFloatData(NodeId, 0, "uv", &UVInfo, UVs.GetData(), 0, Vertices.Num()) != HAPI_RESULT_SUCCESS)
+		return false;
+
+	if (GeoWriter.SetVertexList(NodeId, 0, Vertices.GetData(), 0, Vertices.Num()) != HAPI_RESULT_SUCCESS)
+		return false;
+
+	TArray<int32> FaceCounts;
+	FaceCounts.Init(3, NumFaces);
+	if (GeoWriter.SetFaceCounts(NodeId, 0, FaceCounts.GetData(), 0, NumFaces) != HAPI_RESULT_SUCCESS)
+		return false;
+
+	HAPI_AttributeInfo MaterialInfo = PointInfo;
+	MaterialInfo.count = NumFaces;
+	MaterialInfo.tupleSize = 1;
+	MaterialInfo.owner = HAPI_ATTROWNER_PRIM;
+	MaterialInfo.storage = HAPI_STORAGETYPE_STRING;
+	TArray<const char*> Materials;
+	for (int32 Idx = 0; Idx < NumFaces; Idx++)
+		Materials.Add(Idx % 2 ? "/Game/Materials/M_Odd.M_Odd" : "/Game/Materials/M_Even.M_Even");
+
+	if (GeoWriter.AddAttribute(NodeId, 0, "unreal_material", &MaterialInfo) != HAPI_RESULT_SUCCESS
+		|| GeoWriter.SetAttributeStringData(NodeId, 0, "unreal_material", &MaterialInfo, Materials.GetData(), 0, NumFaces) != HAPI_RESULT_SUCCESS)
+		return false;
+
+	TArray<int32> Membership;
+	Membership.Init(1, NumFaces);
+	if (GeoWriter.AddGroup(NodeId, 0, HAPI_GROUPTYPE_PRIM, "lod0") != HAPI_RESULT_SUCCESS
+		|| GeoWriter.SetGroupMembership(NodeId, 0, HAPI_GROUPTYPE_PRIM, "lod0", Membership.GetData(), 0, NumFaces) != HAPI_RESULT_SUCCESS)
+		return false;
+
+	return GeoWriter.CommitGeo(NodeId) == HAPI_RESULT_SUCCESS;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniGeoWriterEncodeTest, "Houdini.Input.GeoWriterEncode", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniGeoWriterEncodeTest::RunTest(const FString & Parameters)
+{
+	// Only fill the buffers, the node is never used
+	FHoudiniGeoWriter GeoWriter(true);
+	HAPI_PartInfo Part;
+	FHoudiniApi::PartInfo_Init(&Part);
+	Part.type = HAPI_PARTTYPE_MESH;
+	Part.pointCount = 3;
+	Part.vertexCount = 3;
+	Part.faceCount = 1;
+	TestEqual(TEXT("SetPartInfo"), (int32)GeoWriter.SetPartInfo(-1, 0, &Part), (int32)HAPI_RESULT_SUCCESS);
+
+	const int32 Vertices[3] = { 0, 2, 1 };
+	const int32 FaceCounts[1] = { 3 };
+	GeoWriter.SetVertexList(-1, 0, Vertices, 0, 3);
+	GeoWriter.SetFaceCounts(-1, 0, FaceCounts, 0, 1);
+
+	HAPI_AttributeInfo Info;
+	FHoudiniApi::AttributeInfo_Init(&Info);
+	Info.count = 3;
+	Info.tupleSize = 3;
+	Info.owner = HAPI_ATTROWNER_POINT;
+	Info.storage = HAPI_STORAGETYPE_FLOAT;
+	const float Positions[9] = { 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.5f, 1.f };
+	GeoWriter.AddAttribute(-1, 0, "P", &Info);
+	GeoWriter.SetAttributeFloatData(-1, 0, "P", &Info, Positions, 0, 3);
+
+	Info.count = 1;
+	Info.tupleSize = 1;
+	Info.owner = HAPI_ATTROWNER_PRIM;
+	Info.storage = HAPI_STORAGETYPE_STRING;
+	const char* Names[1] = { "a \"quoted\" name" };
+	GeoWriter.AddAttribute(-1, 0, "name", &Info);
+	GeoWriter.SetAttributeStringData(-1, 0, "name", &Info, Names, 0, 1);
+
+	TArray<ANSICHAR> Buffer;
+	if (!TestTrue(TEXT("Geometry encoded"), GeoWriter.EncodeGeo(Buffer)))
+		return false;
+
+	const FString Json = FString(Buffer.Num(), Buffer.GetData());
+	TestTrue(TEXT("Topology"), Json.Contains(TEXT("\"pointref\",[\"indices\",[0,2,1]]")));
+	TestTrue(TEXT("Positions"), Json.Contains(TEXT("\"tuples\",[[0,0,0],[1,0,0],[0,0.5,1]]")));
+	TestTrue(TEXT("Strings are escaped"), Json.Contains(TEXT("\"strings\",[\"\",\"a \\\"quoted\\\" name\"]")));
+	TestTrue(TEXT("Polygon run"), Json.Contains(TEXT("\"nvertices_rle\",[3,1]")));
+
+	// Brackets must be balanced
+	int32 Depth = 0;
+	bool bInString = false;
+	for (int32 Idx = 0; Idx < Json.Len(); Idx++)
+	{
+		const TCHAR Char = Json[Idx];
+		if (bInString)
+		{
+			if (Char == TEXT('\\'))
+				Idx++;
+			else if (Char == TEXT('"'))
+				bInString = false;
+		}
+		else if (Char == TEXT('"'))
+			bInString = true;
+		else if (Char == TEXT('[') || Char == TEXT('{'))
+			Depth++;
+		else if (Char == TEXT(']') || Char == TEXT('}'))
+			Depth--;
+	}
+
+	return TestEqual(TEXT("Balanced brackets"), Depth, 0);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniGeoWriterBenchmark, "Houdini.Input.GeoWriterBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniGeoWriterBenchmark::RunTest(const FString & Parameters)
+{
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	if (!Session)
+	{
+		AddWarning(TEXT("No Houdini Engine session, skipping the benchmark."));
+		return true;
+	}
+
+	bool bSuccess = true;
+	const int32 GridSizes[3] = { 64, 256, 512 };
+	for (const int32& GridSize : GridSizes)
+	{
+		double Times[2] = { 0.0, 0.0 };
+		int32 PointCounts[2] = { -1, -1 };
+		for (int32 Mode = 0; Mode < 2; Mode++)
+		{
+			HAPI_NodeId NodeId = -1;
+			if (FHoudiniApi::CreateInputNode(Session, &NodeId, Mode ? "GeoWriterBuffered" : "GeoWriterDirect") != HAPI_RESULT_SUCCESS)
+				return false;
+
+			const double StartTime = FPlatformTime::Seconds();
+			FHoudiniGeoWriter GeoWriter(Mode == 1);
+			bSuccess &= TestTrue(TEXT("Write the grid"), WriteGridGeo(GeoWriter, NodeId, GridSize));
+			Times[Mode] = FPlatformTime::Seconds() - StartTime;
+
+			// The buffered writer silently falls back to individual calls, make sure the blob was loaded
+			if (Mode == 1)
+				bSuccess &= TestTrue(TEXT("The grid was loaded from memory"), GeoWriter.WasSentAsBlob());
+
+			HAPI_PartInfo PartInfo;
+			FHoudiniApi::PartInfo_Init(&PartInfo);
+			if (FHoudiniEngineUtils::HapiCookNode(NodeId, nullptr, true)
+				&& FHoudiniApi::GetPartInfo(Session, NodeId, 0, &PartInfo) == HAPI_RESULT_SUCCESS)
+			{
+				PointCounts[Mode] = PartInfo.pointCount;
+			}
+
+			FHoudiniApi::DeleteNode(Session, FHoudiniEngineUtils::HapiGetParentNodeId(NodeId));
+		}
+
+		AddInfo(FString::Printf(
+			TEXT("%d faces: individual calls %.1fms, single blob %.1fms (x%.1f)"),
+			GridSize * GridSize * 2, Times[0] * 1000.0, Times[1] * 1000.0, Times[0] / FMath::Max(Times[1], SMALL_NUMBER)));
+
+		bSuccess &= TestEqual(TEXT("Both uploads create the same points"), PointCounts[1], PointCounts[0]);
+	}
+
+	return bSuccess;
+}
+
+#endif
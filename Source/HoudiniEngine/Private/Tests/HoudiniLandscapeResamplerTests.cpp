@@ -0,0 +1,103 @@
+#include "../HoudiniLandscapeResampler.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Scalar resampling, as previously used by the landscape translator. Used as reference for the benchmark.
+template<typename T>
+static void
+ResampleDataReference(const TArray<T>& Data, int32 OldWidth, int32 OldHeight, TArray<T>& Result, int32 NewWidth, int32 NewHeight)
+{
+	Result.Empty(NewWidth * NewHeight);
+	Result.AddUninitialized(NewWidth * NewHeight);
+
+	const float XScale = (float)(OldWidth - 1) / (NewWidth - 1);
+	const float YScale = (float)(OldHeight - 1) / (NewHeight - 1);
+	for (int32 Y = 0; Y < NewHeight; ++Y)
+	{
+		for (int32 X = 0; X < NewWidth; ++X)
+		{
+			const float OldY = Y * YScale;
+			const float OldX = X * XScale;
+			const int32 X0 = FMath::FloorToInt(OldX);
+			const int32 X1 = FMath::Min(FMath::FloorToInt(OldX) + 1, OldWidth - 1);
+			const int32 Y0 = FMath::FloorToInt(OldY);
+			const int32 Y1 = FMath::Min(FMath::FloorToInt(OldY) + 1, OldHeight - 1);
+			const T& Original00 = Data[Y0 * OldWidth + X0];
+			const T& Original10 = Data[Y0 * OldWidth + X1];
+			const T& Original01 = Data[Y1 * OldWidth + X0];
+			const T& Original11 = Data[Y1 * OldWidth + X1];
+			Result[Y * NewWidth + X] = FMath::BiLerp(Original00, Original10, Original01, Original11, FMath::Fractional(OldX), FMath::Fractional(OldY));
+		}
+	}
+}
+
+template<typename T>
+static bool
+RunResampleBenchmark(FAutomationTestBase& Test, const int32& InSize, const int32& OutSize)
+{
+	// Smooth noise, similar to terrain data
+	FRandomStream RandomStream(InSize);
+	TArray<T> InData;
+	InData.SetNumUninitialized(InSize * InSize);
+	const float MaxValue = (float)TNumericLimits<T>::Max();
+	for (int32 Y = 0; Y < InSize; Y++)
+	{
+		for (int32 X = 0; X < InSize; X++)
+		{
+			const float Value = 0.5f + 0.25f * FMath::Sin(X * 0.01f) * FMath::Cos(Y * 0.013f) + 0.1f * RandomStream.GetFraction();
+			InData[X + Y * InSize] = (T)(FMath::Clamp(Value, 0.0f, 1.0f) * MaxValue);
+		}
+	}
+
+	TArray<T> ReferenceData;
+	double StartTime = FPlatformTime::Seconds();
+	ResampleDataReference(InData, InSize, InSize, ReferenceData, OutSize, OutSize);
+	const double ReferenceTime = FPlatformTime::Seconds() - StartTime;
+
+	TArray<T> BilinearData;
+	StartTime = FPlatformTime::Seconds();
+	FHoudiniLandscapeResampler::Resample(InData, InSize, InSize, BilinearData, OutSize, OutSize, EHoudiniLandscapeResampleMethod::Bilinear);
+	const double BilinearTime = FPlatformTime::Seconds() - StartTime;
+
+	TArray<T> BicubicData;
+	StartTime = FPlatformTime::Seconds();
+	FHoudiniLandscapeResampler::Resample(InData, InSize, InSize, BicubicData, OutSize, OutSize, EHoudiniLandscapeResampleMethod::Bicubic);
+	const double BicubicTime = FPlatformTime::Seconds() - StartTime;
+
+	// The reference truncates its intermediate values, the kernels round them, so allow one unit of difference
+	int32 MaxDifference = 0;
+	for (int32 Idx = 0; Idx < ReferenceData.Num(); Idx++)
+		MaxDifference = FMath::Max(MaxDifference, FMath::Abs((int32)ReferenceData[Idx] - (int32)BilinearData[Idx]));
+
+	Test.AddInfo(FString::Printf(
+		TEXT("%d bits, %d -> %d: reference %.1fms, bilinear %.1fms (x%.1f), bicubic %.1fms (x%.1f), max bilinear difference %d"),
+		(int32)sizeof(T) * 8, InSize, OutSize,
+		ReferenceTime * 1000.0, BilinearTime * 1000.0, ReferenceTime / FMath::Max(BilinearTime, SMALL_NUMBER),
+		BicubicTime * 1000.0, ReferenceTime / FMath::Max(BicubicTime, SMALL_NUMBER),
+		MaxDifference));
+
+	return Test.TestTrue(TEXT("Bilinear resampling matches the reference"), MaxDifference <= 1)
+		&& Test.TestEqual(TEXT("Bicubic resampling output size"), BicubicData.Num(), OutSize * OutSize);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniLandscapeResampleBenchmark, "Houdini.Landscape.ResampleBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniLandscapeResampleBenchmark::RunTest(const FString & Parameters)
+{
+	// Houdini heightfield sizes resampled to the closest valid landscape sizes
+	const int32 Sizes[3][2] = { { 2048, 2017 }, { 4096, 4033 }, { 8192, 8129 } };
+
+	bool bSuccess = true;
+	for (const auto& Size : Sizes)
+	{
+		bSuccess &= RunResampleBenchmark<uint16>(*this, Size[0], Size[1]);
+		bSuccess &= RunResampleBenchmark<uint8>(*this, Size[0], Size[1]);
+	}
+
+	return bSuccess;
+}
+
+#endif
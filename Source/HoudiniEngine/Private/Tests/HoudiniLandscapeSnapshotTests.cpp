@@ -0,0 +1,111 @@
+#include "../HoudiniLandscapeSnapshot.h"
+#include "Misc/AutomationTest.h"
+#include "HoudiniLandscapeTestUtils.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+
+#include "Landscape.h"
+#include "LandscapeEdit.h"
+#include "LandscapeInfo.h"
+
+#if WITH_EDITOR
+	#include "Editor.h"
+#endif
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniLandscapeSnapshotRoundTripTest, "Houdini.Input.LandscapeSnapshotRoundTrip", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniLandscapeSnapshotRoundTripTest::RunTest(const FString & Parameters)
+{
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!TestNotNull(TEXT("Editor world"), World))
+		return false;
+
+	// A 2x2 components landscape
+	const int32 ComponentSizeQuads = 7;
+	const int32 Size = ComponentSizeQuads * 2 + 1;
+	TArray<uint16> Heights;
+	ALandscape* Landscape = FHoudiniLandscapeTestUtils::CreateTestLandscape(World, ComponentSizeQuads, 2, Heights);
+	if (!TestNotNull(TEXT("Landscape"), Landscape))
+		return false;
+
+	ULandscapeInfo* LandscapeInfo = Landscape->GetLandscapeInfo();
+	if (!TestNotNull(TEXT("Landscape info"), LandscapeInfo))
+	{
+		World->DestroyActor(Landscape);
+		return false;
+	}
+
+	bool bSuccess = true;
+	const FString SnapshotFile = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("LandscapeSnapshotRoundTrip.hlsnap"));
+	for (const bool bCompress : { false, true })
+	{
+		FHoudiniLandscapeSnapshot Snapshot;
+		bSuccess &= TestTrue(TEXT("Capture the landscape"), Snapshot.Capture(Landscape, bCompress));
+		bSuccess &= TestEqual(TEXT("One chunk per component"), Snapshot.Chunks.Num(), 4);
+		bSuccess &= TestTrue(TEXT("Save the snapshot"), Snapshot.SaveToFile(SnapshotFile));
+
+		FHoudiniLandscapeSnapshot LoadedSnapshot;
+		bSuccess &= TestTrue(TEXT("Load the snapshot"), LoadedSnapshot.LoadFromFile(SnapshotFile));
+		bSuccess &= TestTrue(TEXT("Layer names are kept"), LoadedSnapshot.LayerNames == Snapshot.LayerNames);
+		bSuccess &= TestEqual(TEXT("Chunks are kept"), LoadedSnapshot.Chunks.Num(), Snapshot.Chunks.Num());
+		for (const auto& Pair : Snapshot.Chunks)
+		{
+			const FHoudiniLandscapeSnapshotChunk* LoadedChunk = LoadedSnapshot.Chunks.Find(Pair.Key);
+			if (!TestNotNull(TEXT("Loaded chunk"), LoadedChunk))
+			{
+				bSuccess = false;
+				continue;
+			}
+
+			const FHoudiniLandscapeSnapshotChunk& Chunk = Pair.Value;
+			bSuccess &= TestTrue(TEXT("Chunk is unchanged"),
+				LoadedChunk->Min == Chunk.Min && LoadedChunk->Max == Chunk.Max
+				&& LoadedChunk->Hash == Chunk.Hash && LoadedChunk->UncompressedSize == Chunk.UncompressedSize
+				&& LoadedChunk->bCompressed == Chunk.bCompressed && LoadedChunk->Data == Chunk.Data);
+		}
+
+		// Edit one component, then restore it from the loaded snapshot
+		{
+			TArray<uint16> FlatHeights;
+			FlatHeights.Init(40000, (ComponentSizeQuads + 1) * (ComponentSizeQuads + 1));
+			FLandscapeEditDataInterface LandscapeEdit(LandscapeInfo);
+			LandscapeEdit.SetHeightData(0, 0, ComponentSizeQuads, ComponentSizeQuads, FlatHeights.GetData(), 0, true);
+			LandscapeEdit.Flush();
+		}
+
+		TArray<ULandscapeLayerInfoObject*> RestoredLayers;
+		bSuccess &= TestTrue(TEXT("Restore the landscape"), LoadedSnapshot.Restore(Landscape, RestoredLayers));
+
+		TArray<uint16> RestoredHeights;
+		RestoredHeights.SetNumZeroed(Size * Size);
+		{
+			FLandscapeEditDataInterface LandscapeEdit(LandscapeInfo);
+			LandscapeEdit.GetHeightDataFast(0, 0, Size - 1, Size - 1, RestoredHeights.GetData(), 0);
+		}
+		bSuccess &= TestTrue(TEXT("The landscape's heights are restored"), RestoredHeights == Heights);
+	}
+
+	// Files that aren't snapshots are rejected
+	{
+		TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*SnapshotFile));
+		uint32 InvalidMagic = 0;
+		if (FileWriter)
+		{
+			*FileWriter << InvalidMagic;
+			FileWriter->Close();
+		}
+
+		FHoudiniLandscapeSnapshot InvalidSnapshot;
+		bSuccess &= TestFalse(TEXT("Invalid snapshot files aren't loaded"), InvalidSnapshot.LoadFromFile(SnapshotFile));
+		bSuccess &= TestFalse(TEXT("Invalid snapshots are empty"), InvalidSnapshot.IsValid());
+	}
+
+	IFileManager::Get().Delete(*SnapshotFile);
+	World->DestroyActor(Landscape);
+
+	return bSuccess;
+}
+
+#endif
@@ -0,0 +1,49 @@
+#pragma once
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+#include "CoreMinimal.h"
+
+#include "Engine/World.h"
+#include "Landscape.h"
+
+struct FHoudiniLandscapeTestUtils
+{
+	// Spawns a transient landscape of NumComponents x NumComponents components,
+	// with a slope so every component is different. OutHeights receives the imported heights.
+	static ALandscape* CreateTestLandscape(
+		UWorld* World,
+		const int32 ComponentSizeQuads,
+		const int32 NumComponents,
+		TArray<uint16>& OutHeights)
+	{
+		if (!World)
+			return nullptr;
+
+		const int32 Size = ComponentSizeQuads * NumComponents + 1;
+		OutHeights.SetNumUninitialized(Size * Size);
+		for (int32 Y = 0; Y < Size; Y++)
+		{
+			for (int32 X = 0; X < Size; X++)
+				OutHeights[Y * Size + X] = 32768 + X * 64 + Y * 16;
+		}
+
+		TMap<FGuid, TArray<uint16>> HeightDataPerLayers;
+		HeightDataPerLayers.Add(FGuid(), OutHeights);
+		TMap<FGuid, TArray<FLandscapeImportLayerInfo>> MaterialLayerDataPerLayers;
+		MaterialLayerDataPerLayers.Add(FGuid(), TArray<FLandscapeImportLayerInfo>());
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags = RF_Transient;
+		ALandscape* Landscape = World->SpawnActor<ALandscape>(FVector(0.0f, 0.0f, 0.0f), FRotator::ZeroRotator, SpawnParams);
+		if (!Landscape)
+			return nullptr;
+
+		Landscape->Import(
+			FGuid::NewGuid(), 0, 0, Size - 1, Size - 1, 1, ComponentSizeQuads,
+			HeightDataPerLayers, nullptr, MaterialLayerDataPerLayers, ELandscapeImportAlphamapType::Additive);
+
+		return Landscape;
+	}
+};
+
+#endif
@@ -0,0 +1,135 @@
+#include "../UnrealLandscapeTranslator.h"
+#include "HoudiniApi.h"
+#include "HoudiniInputObject.h"
+#include "../HoudiniEngine.h"
+#include "../HoudiniEngineUtils.h"
+#include "Misc/AutomationTest.h"
+#include "HoudiniLandscapeTestUtils.h"
+
+#include "Landscape.h"
+#include "LandscapeEdit.h"
+#include "LandscapeInfo.h"
+
+#if WITH_EDITOR
+	#include "Editor.h"
+#endif
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniLandscapeComponentUpdateTest, "Houdini.Input.LandscapeComponentUpdate", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniLandscapeComponentUpdateTest::RunTest(const FString & Parameters)
+{
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	if (!Session)
+	{
+		AddWarning(TEXT("No Houdini Engine session, skipping the test."));
+		return true;
+	}
+
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!TestNotNull(TEXT("Editor world"), World))
+		return false;
+
+	// A 2x2 components landscape
+	const int32 ComponentSizeQuads = 7;
+	const int32 Size = ComponentSizeQuads * 2 + 1;
+	TArray<uint16> Heights;
+	ALandscape* Landscape = FHoudiniLandscapeTestUtils::CreateTestLandscape(World, ComponentSizeQuads, 2, Heights);
+	if (!TestNotNull(TEXT("Landscape"), Landscape))
+		return false;
+
+	ULandscapeInfo* LandscapeInfo = Landscape->GetLandscapeInfo();
+	if (!TestNotNull(TEXT("Landscape info"), LandscapeInfo))
+	{
+		World->DestroyActor(Landscape);
+		return false;
+	}
+
+	// Reads the committed data of a heightfield's height volume
+	auto ReadHeights = [&](UHoudiniInputLandscape* InInputLandscape, TArray<float>& OutHeights)
+	{
+		const int32* HeightNodeId = InInputLandscape->CachedVolumeNodeIds.Find(TEXT("height"));
+		if (!HeightNodeId || !FHoudiniEngineUtils::HapiCookNode(*HeightNodeId, nullptr, true))
+			return false;
+
+		HAPI_GeoInfo GeoInfo;
+		FHoudiniApi::GeoInfo_Init(&GeoInfo);
+		if (FHoudiniApi::GetGeoInfo(Session, *HeightNodeId, &GeoInfo) != HAPI_RESULT_SUCCESS)
+			return false;
+
+		OutHeights.SetNumZeroed(Size * Size);
+		return FHoudiniApi::GetHeightFieldData(Session, GeoInfo.nodeId, 0, OutHeights.GetData(), 0, OutHeights.Num()) == HAPI_RESULT_SUCCESS;
+	};
+
+	UHoudiniInputLandscape* InputLandscape = Cast<UHoudiniInputLandscape>(
+		UHoudiniInputLandscape::Create(Landscape, GetTransientPackage(), TEXT("LandscapeUpdateTest")));
+	HAPI_NodeId HeightfieldNodeId = -1;
+	bool bSuccess = TestTrue(TEXT("Send the landscape"), FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
+		Landscape, HeightfieldNodeId, TEXT("LandscapeUpdateTest"), InputLandscape));
+
+	TArray<float> HeightsBefore;
+	bSuccess &= TestTrue(TEXT("Read the heights"), ReadHeights(InputLandscape, HeightsBefore));
+
+	// Raise the last component only
+	{
+		const int32 X1 = ComponentSizeQuads;
+		const int32 Y1 = ComponentSizeQuads;
+		const int32 X2 = Size - 1;
+		const int32 Y2 = Size - 1;
+		TArray<uint16> RaisedHeights;
+		RaisedHeights.Init(40000, (X2 - X1 + 1) * (Y2 - Y1 + 1));
+
+		FLandscapeEditDataInterface LandscapeEdit(LandscapeInfo);
+		LandscapeEdit.SetHeightData(X1, Y1, X2, Y2, RaisedHeights.GetData(), 0, true);
+		LandscapeEdit.Flush();
+	}
+
+	// The update reuses the heightfield and only sends the changed component
+	const HAPI_NodeId PreviousHeightfieldNodeId = HeightfieldNodeId;
+	bSuccess &= TestTrue(TEXT("Update the landscape"), FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
+		Landscape, HeightfieldNodeId, TEXT("LandscapeUpdateTest"), InputLandscape));
+	bSuccess &= TestEqual(TEXT("The heightfield is updated in place"), HeightfieldNodeId, PreviousHeightfieldNodeId);
+
+	TArray<float> HeightsAfter;
+	bSuccess &= TestTrue(TEXT("Read the updated heights"), ReadHeights(InputLandscape, HeightsAfter));
+
+	// Compare with a heightfield sent from scratch
+	UHoudiniInputLandscape* ReferenceInputLandscape = Cast<UHoudiniInputLandscape>(
+		UHoudiniInputLandscape::Create(Landscape, GetTransientPackage(), TEXT("LandscapeUpdateReference")));
+	HAPI_NodeId ReferenceNodeId = -1;
+	bSuccess &= TestTrue(TEXT("Send the reference landscape"), FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
+		Landscape, ReferenceNodeId, TEXT("LandscapeUpdateReference"), ReferenceInputLandscape));
+
+	TArray<float> ReferenceHeights;
+	bSuccess &= TestTrue(TEXT("Read the reference heights"), ReadHeights(ReferenceInputLandscape, ReferenceHeights));
+
+	if (HeightsAfter.Num() == ReferenceHeights.Num() && HeightsBefore.Num() == ReferenceHeights.Num())
+	{
+		int32 NumMismatches = 0;
+		int32 NumChanged = 0;
+		for (int32 Idx = 0; Idx < ReferenceHeights.Num(); Idx++)
+		{
+			if (!FMath::IsNearlyEqual(HeightsAfter[Idx], ReferenceHeights[Idx], KINDA_SMALL_NUMBER))
+				NumMismatches++;
+
+			if (!FMath::IsNearlyEqual(HeightsBefore[Idx], ReferenceHeights[Idx], KINDA_SMALL_NUMBER))
+				NumChanged++;
+		}
+
+		bSuccess &= TestTrue(TEXT("The component's heights changed"), NumChanged > 0);
+		bSuccess &= TestEqual(TEXT("The updated heightfield matches the landscape"), NumMismatches, 0);
+	}
+
+	if (HeightfieldNodeId >= 0)
+		FHoudiniApi::DeleteNode(Session, FHoudiniEngineUtils::HapiGetParentNodeId(HeightfieldNodeId));
+
+	if (ReferenceNodeId >= 0)
+		FHoudiniApi::DeleteNode(Session, FHoudiniEngineUtils::HapiGetParentNodeId(ReferenceNodeId));
+
+	World->DestroyActor(Landscape);
+
+	return bSuccess;
+}
+
+#endif
@@ -0,0 +1,153 @@
+#include "../HoudiniParameterTranslator.h"
+#include "HoudiniApi.h"
+#include "../HoudiniEngine.h"
+#include "../HoudiniEngineUtils.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniParameterUploadBatchTest, "Houdini.Parameters.UploadBatch", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniParameterUploadBatchTest::RunTest(const FString & Parameters)
+{
+	bool bSuccess = true;
+
+	// 200 changed parameters, like a preset being applied: float vectors, scalars, ints/toggles and strings
+	FHoudiniParameterUploadBatch Batch;
+	int32 NumCallsBefore = 0;
+	int32 FloatIndex = 0;
+	int32 IntIndex = 0;
+	for (int32 ParmIdx = 0; ParmIdx < 200; ParmIdx++)
+	{
+		switch (ParmIdx % 4)
+		{
+			case 0:
+			{
+				const float Values[3] = { (float)ParmIdx, ParmIdx + 0.25f, ParmIdx + 0.5f };
+				Batch.AddFloatValues(0, FloatIndex, Values, 3);
+				FloatIndex += 3;
+				NumCallsBefore++;
+			}
+			break;
+
+			case 1:
+			{
+				const float Value = (float)ParmIdx;
+				Batch.AddFloatValues(0, FloatIndex, &Value, 1);
+				FloatIndex++;
+				NumCallsBefore++;
+			}
+			break;
+
+			case 2:
+			{
+				const int32 Value = ParmIdx;
+				Batch.AddIntValues(0, IntIndex, &Value, 1);
+				IntIndex++;
+				NumCallsBefore++;
+			}
+			break;
+
+			case 3:
+			{
+				Batch.AddStringValue(0, ParmIdx, 0, FString::FromInt(ParmIdx));
+				NumCallsBefore++;
+			}
+			break;
+		}
+	}
+
+	// Unchanged parameter on the int side, and a second node
+	IntIndex++;
+	const int32 GapValue = 7;
+	Batch.AddIntValues(0, IntIndex, &GapValue, 1);
+	NumCallsBefore++;
+
+	const float OtherNodeValue = 1.0f;
+	Batch.AddFloatValues(1, 0, &OtherNodeValue, 1);
+	NumCallsBefore++;
+
+	TArray<FHoudiniParameterValueRange<float>> FloatRanges;
+	TArray<FHoudiniParameterValueRange<int32>> IntRanges;
+	Batch.BuildRanges(FloatRanges, IntRanges);
+
+	bSuccess &= TestEqual(TEXT("Float ranges"), FloatRanges.Num(), 2);
+	bSuccess &= TestEqual(TEXT("Int ranges"), IntRanges.Num(), 2);
+	if (FloatRanges.Num() == 2 && IntRanges.Num() == 2)
+	{
+		bSuccess &= TestEqual(TEXT("Merged float count"), FloatRanges[0].Values.Num(), FloatIndex);
+		bSuccess &= TestEqual(TEXT("First vector"), FloatRanges[0].Values[1], 0.25f);
+		bSuccess &= TestEqual(TEXT("Last scalar"), FloatRanges[0].Values[FloatIndex - 1], 197.0f);
+		bSuccess &= TestEqual(TEXT("Other node"), FloatRanges[1].NodeId, 1);
+		bSuccess &= TestEqual(TEXT("Merged int count"), IntRanges[0].Values.Num(), 50);
+		bSuccess &= TestEqual(TEXT("Int after the gap"), IntRanges[1].StartIndex, IntIndex);
+	}
+
+	// Values added later win
+	FHoudiniParameterUploadBatch OverlapBatch;
+	const float Wide[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+	const float Narrow = 10.0f;
+	OverlapBatch.AddFloatValues(0, 2, &Narrow, 1);
+	OverlapBatch.AddFloatValues(0, 0, Wide, 4);
+	OverlapBatch.BuildRanges(FloatRanges, IntRanges);
+	if (TestEqual(TEXT("Overlapping range"), FloatRanges.Num(), 1))
+		bSuccess &= TestEqual(TEXT("Overlapping value"), FloatRanges[0].Values[2], 3.0f);
+
+	const int32 NumCallsAfter = Batch.GetNumUploadCalls();
+	AddInfo(FString::Printf(TEXT("HAPI calls: %d one parameter at a time, %d batched"), NumCallsBefore, NumCallsAfter));
+	bSuccess &= TestEqual(TEXT("HAPI calls after batching"), NumCallsAfter, 2 + 2 + 50);
+
+	// Round trip on a real node when a session is available
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	if (!Session)
+		return bSuccess;
+
+	HAPI_NodeId NodeId = -1;
+	if (FHoudiniEngineUtils::CreateNode(-1, TEXT("SOP/xform"), TEXT("ParameterUploadBatch"), false, &NodeId) != HAPI_RESULT_SUCCESS)
+		return bSuccess;
+
+	HAPI_NodeInfo NodeInfo;
+	FHoudiniApi::NodeInfo_Init(&NodeInfo);
+	FHoudiniApi::GetNodeInfo(Session, NodeId, &NodeInfo);
+
+	TArray<HAPI_ParmInfo> ParmInfos;
+	ParmInfos.SetNum(NodeInfo.parmCount);
+	FHoudiniApi::GetParameters(Session, NodeId, ParmInfos.GetData(), 0, NodeInfo.parmCount);
+
+	FHoudiniParameterUploadBatch NodeBatch;
+	int32 NumFloatParms = 0;
+	for (const HAPI_ParmInfo& ParmInfo : ParmInfos)
+	{
+		if (ParmInfo.type != HAPI_PARMTYPE_FLOAT)
+			continue;
+
+		TArray<float> Values;
+		for (int32 Idx = 0; Idx < ParmInfo.size; Idx++)
+			Values.Add(ParmInfo.floatValuesIndex + Idx * 0.5f);
+
+		NodeBatch.AddFloatValues(NodeId, ParmInfo.floatValuesIndex, Values.GetData(), ParmInfo.size);
+		NumFloatParms++;
+	}
+
+	const int32 NumNodeCalls = NodeBatch.GetNumUploadCalls();
+	bSuccess &= TestTrue(TEXT("Upload"), NodeBatch.Upload());
+	AddInfo(FString::Printf(TEXT("%s: %d float parameters sent with %d calls"), TEXT("SOP/xform"), NumFloatParms, NumNodeCalls));
+
+	TArray<float> ReadValues;
+	ReadValues.SetNum(NodeInfo.parmFloatValueCount);
+	FHoudiniApi::GetParmFloatValues(Session, NodeId, ReadValues.GetData(), 0, NodeInfo.parmFloatValueCount);
+	for (const HAPI_ParmInfo& ParmInfo : ParmInfos)
+	{
+		if (ParmInfo.type != HAPI_PARMTYPE_FLOAT)
+			continue;
+
+		for (int32 Idx = 0; Idx < ParmInfo.size; Idx++)
+			bSuccess &= TestEqual(TEXT("Round trip value"), ReadValues[ParmInfo.floatValuesIndex + Idx], ParmInfo.floatValuesIndex + Idx * 0.5f);
+	}
+
+	FHoudiniApi::DeleteNode(Session, FHoudiniEngineUtils::HapiGetParentNodeId(NodeId));
+
+	return bSuccess;
+}
+
+#endif
@@ -0,0 +1,64 @@
+#include "HoudiniEngineRuntime.h"
+#include "HoudiniInputObject.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniSharedInputNodeRefCountTest, "Houdini.Input.SharedInputNodeRefCount", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniSharedInputNodeRefCountTest::RunTest(const FString & Parameters)
+{
+	FHoudiniEngineRuntime& EngineRuntime = FHoudiniEngineRuntime::Get();
+
+	// No node is created for this key, so releasing its last reference doesn't delete anything
+	const FString Key = TEXT("HoudiniSharedInputNodeTest|") + FGuid::NewGuid().ToString();
+
+	auto NewInputObject = []()
+	{
+		return NewObject<UHoudiniInputStaticMesh>(GetTransientPackage(), NAME_None, RF_Transient);
+	};
+
+	// Acquire
+	UHoudiniInputObject* Source = NewInputObject();
+	EngineRuntime.AcquireSharedInputNode(Key);
+	Source->SharedInputNodeKey = Key;
+	TestEqual(TEXT("Acquired reference"), EngineRuntime.GetSharedInputNodeRefCount(Key), 1);
+
+	// Copies take their own reference, copying the same state again doesn't add another one
+	UHoudiniInputObject* Copy = NewInputObject();
+	Copy->CopyStateFrom(Source, false);
+	TestEqual(TEXT("Reference taken by the copy"), EngineRuntime.GetSharedInputNodeRefCount(Key), 2);
+	Copy->CopyStateFrom(Source, false);
+	TestEqual(TEXT("Reference not taken twice by the copy"), EngineRuntime.GetSharedInputNodeRefCount(Key), 2);
+
+	UHoudiniInputObject* NonDeletingCopy = NewInputObject();
+	NonDeletingCopy->CopyStateFrom(Source, false);
+	TestEqual(TEXT("Reference taken by the second copy"), EngineRuntime.GetSharedInputNodeRefCount(Key), 3);
+
+	// Invalidating an object that can't delete its nodes still releases its reference
+	NonDeletingCopy->SetCanDeleteHoudiniNodes(false);
+	NonDeletingCopy->InvalidateData();
+	TestTrue(TEXT("Key cleared on invalidate"), NonDeletingCopy->SharedInputNodeKey.IsEmpty());
+	TestEqual(TEXT("Reference released on invalidate"), EngineRuntime.GetSharedInputNodeRefCount(Key), 2);
+
+	// Resetting the shared nodes (session stop) keeps the references
+	EngineRuntime.ResetSharedInputNodes();
+	TestEqual(TEXT("References kept on reset"), EngineRuntime.GetSharedInputNodeRefCount(Key), 2);
+	TestEqual(TEXT("Node forgotten on reset"), EngineRuntime.GetSharedInputNodeId(Key), -1);
+
+	// Delete
+	Copy->InvalidateData();
+	TestEqual(TEXT("Reference released on delete"), EngineRuntime.GetSharedInputNodeRefCount(Key), 1);
+	Source->InvalidateData();
+	TestEqual(TEXT("Last reference released"), EngineRuntime.GetSharedInputNodeRefCount(Key), 0);
+
+	// Releasing again must not underflow
+	Source->InvalidateData();
+	EngineRuntime.AcquireSharedInputNode(Key);
+	TestEqual(TEXT("No reference left over"), EngineRuntime.GetSharedInputNodeRefCount(Key), 1);
+	EngineRuntime.ReleaseSharedInputNode(Key);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,90 @@
+#include "../UnrealSplineTranslator.h"
+#include "Misc/AutomationTest.h"
+
+#include "Components/SplineComponent.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniSplineAdaptiveSamplingTest, "Houdini.Input.SplineAdaptiveSampling", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniSplineAdaptiveSamplingTest::RunTest(const FString & Parameters)
+{
+	const float Tolerance = 1.0f;
+
+	auto MakeSpline = [](const TArray<FVector>& InPoints, const ESplinePointType::Type& InPointType, const bool& bInClosed)
+	{
+		USplineComponent* Spline = NewObject<USplineComponent>(GetTransientPackage(), NAME_None, RF_Transient);
+		Spline->ClearSplinePoints(false);
+		for (int32 Idx = 0; Idx < InPoints.Num(); Idx++)
+		{
+			Spline->AddSplinePoint(InPoints[Idx], ESplineCoordinateSpace::Local, false);
+			Spline->SetSplinePointType(Idx, InPointType, false);
+		}
+
+		Spline->SetClosedLoop(bInClosed, false);
+		Spline->UpdateSpline();
+		return Spline;
+	};
+
+	// Largest distance between the spline and the sampled polyline, measured on a dense sampling of the spline
+	auto GetMaxDeviation = [](USplineComponent* InSpline, const TArray<FVector>& InPositions)
+	{
+		float MaxDeviation = 0.0f;
+		const float Length = InSpline->GetSplineLength();
+		for (float Distance = 0.0f; Distance <= Length; Distance += 5.0f)
+		{
+			const FVector Position = InSpline->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+			float MinDistance = MAX_flt;
+			for (int32 Idx = 1; Idx < InPositions.Num(); Idx++)
+				MinDistance = FMath::Min(MinDistance, FMath::PointDistToSegment(Position, InPositions[Idx - 1], InPositions[Idx]));
+
+			MaxDeviation = FMath::Max(MaxDeviation, MinDistance);
+		}
+		return MaxDeviation;
+	};
+
+	TArray<FVector> Positions;
+	TArray<FQuat> Rotations;
+	TArray<FVector> Scales;
+	bool bSuccess = true;
+
+	// A straight spline only needs its control points
+	{
+		const TArray<FVector> Points = { FVector(0.0f), FVector(1000.0f, 0.0f, 0.0f), FVector(2000.0f, 0.0f, 0.0f) };
+		USplineComponent* Spline = MakeSpline(Points, ESplinePointType::Linear, false);
+		FUnrealSplineTranslator::SampleSplineAdaptively(Spline, Tolerance, Positions, Rotations, Scales);
+		bSuccess &= TestEqual(TEXT("Straight spline point count"), Positions.Num(), Points.Num());
+		for (int32 Idx = 0; Idx < Points.Num() && Idx < Positions.Num(); Idx++)
+			bSuccess &= TestTrue(TEXT("Straight spline keeps its control points"), Positions[Idx].Equals(Points[Idx], KINDA_SMALL_NUMBER * 100.0f));
+
+		bSuccess &= TestTrue(TEXT("Straight spline attribute counts"), Rotations.Num() == Positions.Num() && Scales.Num() == Positions.Num());
+	}
+
+	// A curved spline is subdivided until it stays within the tolerance
+	{
+		const TArray<FVector> Points = { FVector(0.0f), FVector(1000.0f, 1000.0f, 0.0f), FVector(2000.0f, 0.0f, 0.0f) };
+		USplineComponent* Spline = MakeSpline(Points, ESplinePointType::Curve, false);
+		FUnrealSplineTranslator::SampleSplineAdaptively(Spline, Tolerance, Positions, Rotations, Scales);
+		bSuccess &= TestTrue(TEXT("Curved spline is subdivided"), Positions.Num() > Points.Num());
+		bSuccess &= TestTrue(TEXT("Curved spline starts on its first point"), Positions.Num() > 0 && Positions[0].Equals(Points[0], 0.01f));
+		bSuccess &= TestTrue(TEXT("Curved spline ends on its last point"), Positions.Num() > 0 && Positions.Last().Equals(Points.Last(), 0.01f));
+		bSuccess &= TestTrue(TEXT("Curved spline stays within the tolerance"), GetMaxDeviation(Spline, Positions) <= Tolerance * 2.0f);
+	}
+
+	// A closed spline goes back to its first point
+	{
+		const TArray<FVector> Points = { FVector(0.0f), FVector(1000.0f, 0.0f, 0.0f), FVector(1000.0f, 1000.0f, 0.0f), FVector(0.0f, 1000.0f, 0.0f) };
+		USplineComponent* Spline = MakeSpline(Points, ESplinePointType::Linear, true);
+		FUnrealSplineTranslator::SampleSplineAdaptively(Spline, Tolerance, Positions, Rotations, Scales);
+		bSuccess &= TestTrue(TEXT("Closed spline has its closing segment"), Positions.Num() > Points.Num());
+		bSuccess &= TestTrue(TEXT("Closed spline ends on its first point"), Positions.Num() > 0 && Positions.Last().Equals(Points[0], 0.01f));
+		for (const FVector& Point : Points)
+			bSuccess &= TestTrue(TEXT("Closed spline keeps its corners"), Positions.ContainsByPredicate([&](const FVector& InPosition) { return InPosition.Equals(Point, 0.01f); }));
+
+		bSuccess &= TestTrue(TEXT("Closed spline stays within the tolerance"), GetMaxDeviation(Spline, Positions) <= Tolerance * 2.0f);
+	}
+
+	return bSuccess;
+}
+
+#endif
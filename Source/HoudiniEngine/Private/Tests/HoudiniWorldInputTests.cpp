@@ -0,0 +1,117 @@
+#include "../HoudiniInputTranslator.h"
+#include "HoudiniApi.h"
+#include "../HoudiniEngine.h"
+#include "../HoudiniEngineUtils.h"
+#include "HoudiniInput.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Components/StaticMeshComponent.h"
+
+#if WITH_EDITOR
+	#include "Editor.h"
+#endif
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniWorldInputMoveBenchmark, "Houdini.Input.WorldInputMoveBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniWorldInputMoveBenchmark::RunTest(const FString & Parameters)
+{
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	if (!Session)
+	{
+		AddWarning(TEXT("No Houdini Engine session, skipping the benchmark."));
+		return true;
+	}
+
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Sphere.Sphere"));
+	if (!TestNotNull(TEXT("Editor world"), World) || !TestNotNull(TEXT("Sphere mesh"), Mesh))
+		return false;
+
+	// Feed a world input with a few actors
+	const int32 NumActors = 64;
+	TArray<AActor*> Actors;
+	for (int32 Idx = 0; Idx < NumActors; Idx++)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags = RF_Transient;
+		AStaticMeshActor* Actor = World->SpawnActor<AStaticMeshActor>(
+			FVector((Idx % 8) * 200.0f, (Idx / 8) * 200.0f, 0.0f), FRotator::ZeroRotator, SpawnParams);
+		Actor->GetStaticMeshComponent()->SetStaticMesh(Mesh);
+		Actors.Add(Actor);
+	}
+
+	UHoudiniInput* Input = NewObject<UHoudiniInput>(GetTransientPackage());
+	bool bBlueprintStructureModified = false;
+	Input->SetInputType(EHoudiniInputType::World, bBlueprintStructureModified);
+	Input->SetInputObjectsNumber(EHoudiniInputType::World, NumActors);
+	for (int32 Idx = 0; Idx < NumActors; Idx++)
+		Input->SetInputObjectAt(EHoudiniInputType::World, Idx, Actors[Idx]);
+
+	bool bSuccess = TestTrue(TEXT("Initial upload"), FHoudiniInputTranslator::UploadInputData(Input));
+	Input->MarkChanged(false);
+	Input->MarkAllInputObjectsChanged(false);
+
+	// Stand-in for a heavy HDA cooking the input
+	HAPI_NodeId HeavyNodeId = -1;
+	FHoudiniEngineUtils::CreateNode(-1, TEXT("SOP/subdivide"), TEXT("WorldInputMoveBenchmark"), false, &HeavyNodeId);
+	FHoudiniApi::SetParmIntValue(Session, HeavyNodeId, "iterations", 0, 2);
+	FHoudiniApi::ConnectNodeInput(Session, HeavyNodeId, 0, Input->GetInputNodeId(), 0);
+	FHoudiniEngineUtils::HapiCookNode(HeavyNodeId, nullptr, true);
+
+	// Drag the first actor around, with the transform-only path then with a full upload of the input
+	const int32 NumSteps = 20;
+	for (int32 Mode = 0; Mode < 2; Mode++)
+	{
+		double UploadTime = 0.0;
+		double CookTime = 0.0;
+		int32 NumDataUploads = 0;
+		for (int32 Step = 0; Step < NumSteps; Step++)
+		{
+			Actors[0]->SetActorLocation(FVector(Step * 10.0f, -200.0f * (Mode + 1), 0.0f));
+
+			double StartTime = FPlatformTime::Seconds();
+			FHoudiniInputTranslator::UpdateWorldInput(Input);
+			if (Mode == 1)
+				Input->MarkAllInputObjectsChanged(true);
+
+			if (Input->IsDataUploadNeeded())
+			{
+				bSuccess &= FHoudiniInputTranslator::UploadInputData(Input);
+				NumDataUploads++;
+			}
+
+			if (Input->IsTransformUploadNeeded())
+				bSuccess &= FHoudiniInputTranslator::UploadInputTransform(Input);
+
+			Input->MarkChanged(false);
+			Input->MarkAllInputObjectsChanged(false);
+			UploadTime += FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			FHoudiniEngineUtils::HapiCookNode(HeavyNodeId, nullptr, true);
+			CookTime += FPlatformTime::Seconds() - StartTime;
+		}
+
+		AddInfo(FString::Printf(
+			TEXT("%s: %.2fms upload + %.2fms cook per step, %d data uploads for %d steps"),
+			Mode == 0 ? TEXT("Transform only") : TEXT("Full upload"),
+			UploadTime * 1000.0 / NumSteps, CookTime * 1000.0 / NumSteps, NumDataUploads, NumSteps));
+
+		if (Mode == 0)
+			bSuccess &= TestEqual(TEXT("Moving an actor doesn't upload its geometry"), NumDataUploads, 0);
+	}
+
+	FHoudiniApi::DeleteNode(Session, FHoudiniEngineUtils::HapiGetParentNodeId(HeavyNodeId));
+	FHoudiniInputTranslator::DisconnectAndDestroyInput(Input, EHoudiniInputType::World);
+	for (AActor* Actor : Actors)
+		World->DestroyActor(Actor);
+
+	return bSuccess;
+}
+
+#endif
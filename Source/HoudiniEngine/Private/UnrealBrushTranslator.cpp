@@ -123,8 +123,14 @@ bool FUnrealBrushTranslator::CreateInputNodeForBrush(
 	TArray<ABrush*> BrushActors;
 	UHoudiniInputBrush::FindIntersectingSubtractiveBrushes(InputBrushObject, BrushActors);
 	
-	UModel* BrushModel = UHCsgUtils::BuildModelFromBrushes(BrushActors);
-	InputBrushObject->UpdateCachedData(BrushModel, BrushActors);
+	// Only rebuild the CSG model if the brushes (surface hash, transform, type) used for it have changed.
+	// The polygons of the unchanged brushes are then reused from the input's cache.
+	UModel* BrushModel = InputBrushObject->GetCachedModel();
+	if (!IsValid(BrushModel) || InputBrushObject->HasBrushesChanged(BrushActors))
+	{
+		BrushModel = UHCsgUtils::BuildModelFromBrushes(BrushActors, &InputBrushObject->GetBrushPolysCache());
+		InputBrushObject->UpdateCachedData(BrushModel, BrushActors);
+	}
 	
 	// DEBUG: Upload the level model (baked by UE) to Houdini
 	// ULevel* Level = BrushActor->GetTypedOuter<ULevel>();
@@ -0,0 +1,435 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "UnrealDataTableTranslator.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "Engine/DataTable.h"
+#include "DataTableUtils.h"
+#include "UObject/UnrealType.h"
+
+#include <string>
+
+// How a data table column is sent to Houdini
+enum class EHoudiniDataTableColumnType : uint8
+{
+	Float,
+	Int,
+	Int64,
+	String
+};
+
+// A column of the data table, found once from the row struct's layout
+struct FHoudiniDataTableColumn
+{
+	const FProperty* Property = nullptr;
+	FString AttributeName;
+	EHoudiniDataTableColumnType Type = EHoudiniDataTableColumnType::String;
+	int32 TupleSize = 1;
+};
+
+// Finds how a row struct property is sent, returns false for properties sent as strings
+static bool
+GetDataTableColumnType(const FProperty* InProperty, EHoudiniDataTableColumnType& OutType, int32& OutTupleSize)
+{
+	OutTupleSize = 1;
+
+	// Static arrays are sent as strings, like the other containers
+	if (InProperty->ArrayDim != 1)
+		return false;
+
+	if (InProperty->IsA<FBoolProperty>())
+	{
+		OutType = EHoudiniDataTableColumnType::Int;
+		return true;
+	}
+
+	if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(InProperty))
+	{
+		// Enums are sent with their names
+		if (NumericProperty->IsEnum())
+			return false;
+
+		if (NumericProperty->IsFloatingPoint())
+			OutType = EHoudiniDataTableColumnType::Float;
+		else if (InProperty->IsA<FInt64Property>() || InProperty->IsA<FUInt64Property>() || InProperty->IsA<FUInt32Property>())
+			OutType = EHoudiniDataTableColumnType::Int64;
+		else
+			OutType = EHoudiniDataTableColumnType::Int;
+
+		return true;
+	}
+
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty))
+	{
+		const UScriptStruct* Struct = StructProperty->Struct;
+		if (Struct == TBaseStructure<FVector>::Get() || Struct == TBaseStructure<FRotator>::Get())
+		{
+			OutType = EHoudiniDataTableColumnType::Float;
+			OutTupleSize = 3;
+			return true;
+		}
+		else if (Struct == TBaseStructure<FVector2D>::Get())
+		{
+			OutType = EHoudiniDataTableColumnType::Float;
+			OutTupleSize = 2;
+			return true;
+		}
+		else if (Struct == TBaseStructure<FVector4>::Get() || Struct == TBaseStructure<FQuat>::Get() || Struct == TBaseStructure<FLinearColor>::Get())
+		{
+			OutType = EHoudiniDataTableColumnType::Float;
+			OutTupleSize = 4;
+			return true;
+		}
+		else if (Struct == TBaseStructure<FColor>::Get())
+		{
+			OutType = EHoudiniDataTableColumnType::Int;
+			OutTupleSize = 4;
+			return true;
+		}
+		else if (Struct == TBaseStructure<FIntPoint>::Get())
+		{
+			OutType = EHoudiniDataTableColumnType::Int;
+			OutTupleSize = 2;
+			return true;
+		}
+		else if (Struct == TBaseStructure<FIntVector>::Get())
+		{
+			OutType = EHoudiniDataTableColumnType::Int;
+			OutTupleSize = 3;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Sets a string attribute, converting each unique value only once
+static HAPI_Result
+SetDataTableStringAttribute(
+	const HAPI_NodeId& InNodeId, const std::string& InAttributeName, const HAPI_AttributeInfo& InAttributeInfo, const TArray<FString>& InValues)
+{
+	TMap<FString, int32> UniqueIndices;
+	TArray<int32> ValueIndices;
+	ValueIndices.SetNumUninitialized(InValues.Num());
+	for (int32 Idx = 0; Idx < InValues.Num(); Idx++)
+		ValueIndices[Idx] = UniqueIndices.FindOrAdd(InValues[Idx], UniqueIndices.Num());
+
+	TArray<std::string> UniqueStrings;
+	UniqueStrings.SetNum(UniqueIndices.Num());
+	for (auto& CurrentUnique : UniqueIndices)
+		FHoudiniEngineUtils::ConvertUnrealString(CurrentUnique.Key, UniqueStrings[CurrentUnique.Value]);
+
+	// The values point to the converted unique strings
+	TArray<const char*> StringDataArray;
+	StringDataArray.SetNumUninitialized(InValues.Num());
+	for (int32 Idx = 0; Idx < InValues.Num(); Idx++)
+		StringDataArray[Idx] = UniqueStrings[ValueIndices[Idx]].c_str();
+
+	return FHoudiniApi::SetAttributeStringData(
+		FHoudiniEngine::Get().GetSession(), InNodeId, 0, InAttributeName.c_str(), &InAttributeInfo,
+		StringDataArray.GetData(), 0, InAttributeInfo.count);
+}
+
+bool
+FUnrealDataTableTranslator::CreateInputNodeForDataTable(UDataTable* DataTable, HAPI_NodeId& CreatedInputNodeId, const FString& NodeName)
+{
+	if (!DataTable || DataTable->IsPendingKill())
+		return false;
+
+	const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+	if (!RowStruct)
+		return true;
+
+	// Get the rows in the same order as UDataTable::GetTableData()
+	TArray<FName> RowNames;
+	TArray<const uint8*> Rows;
+	for (auto& CurrentRow : DataTable->GetRowMap())
+	{
+		RowNames.Add(CurrentRow.Key);
+		Rows.Add(CurrentRow.Value);
+	}
+
+	const int32 NumRows = Rows.Num();
+	if (NumRows <= 0)
+		return true;
+
+	// Walk the row struct's layout once to find how each column is sent.
+	// The attribute names match the columns of UDataTable::GetTableData(): "unreal_data_table_COL_NAME",
+	// with the row names as the first column
+	TArray<FHoudiniDataTableColumn> Columns;
+	for (TFieldIterator<FProperty> It(RowStruct); It; ++It)
+	{
+		FHoudiniDataTableColumn& Column = Columns.AddDefaulted_GetRef();
+		Column.Property = *It;
+		Column.AttributeName = TEXT(HAPI_UNREAL_ATTRIB_DATA_TABLE_PREFIX) + FString::FromInt(Columns.Num())
+			+ TEXT("_") + DataTableUtils::GetPropertyExportName(*It);
+
+		if (!GetDataTableColumnType(*It, Column.Type, Column.TupleSize))
+			Column.Type = EHoudiniDataTableColumnType::String;
+	}
+
+	// Create the input node
+	HAPI_NodeId InputNodeId = -1;
+	std::string NodeNameRawString;
+	FHoudiniEngineUtils::ConvertUnrealString(NodeName, NodeNameRawString);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateInputNode(
+		FHoudiniEngine::Get().GetSession(), &InputNodeId, NodeNameRawString.c_str()), false);
+
+	CreatedInputNodeId = InputNodeId;
+
+	// Create a part
+	HAPI_PartInfo Part;
+	FHoudiniApi::PartInfo_Init(&Part);
+	Part.id = 0;
+	Part.nameSH = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_POINT] = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_PRIM] = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_VERTEX] = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_DETAIL] = 0;
+	Part.vertexCount = 0;
+	Part.faceCount = 0;
+	Part.pointCount = NumRows;
+	Part.type = HAPI_PARTTYPE_MESH;
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPartInfo(
+		FHoudiniEngine::Get().GetSession(), InputNodeId, 0, &Part), false);
+
+	HAPI_AttributeInfo AttributeInfo;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+	AttributeInfo.count = NumRows;
+	AttributeInfo.tupleSize = 3;
+	AttributeInfo.exists = true;
+	AttributeInfo.owner = HAPI_ATTROWNER_POINT;
+	AttributeInfo.storage = HAPI_STORAGETYPE_FLOAT;
+	AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+	AttributeInfo.typeInfo = HAPI_ATTRIBUTE_TYPE_NONE;
+
+	// One point per row along Y
+	{
+		TArray<float> Positions;
+		Positions.SetNumZeroed(NumRows * 3);
+		for (int32 RowIdx = 0; RowIdx < NumRows; RowIdx++)
+			Positions[RowIdx * 3 + 1] = (float)RowIdx;
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(), InputNodeId, 0,
+			HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfo), false);
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+			FHoudiniEngine::Get().GetSession(), InputNodeId, 0,
+			HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfo,
+			Positions.GetData(), 0, AttributeInfo.count), false);
+	}
+
+	// Object path, row struct name and row names
+	AttributeInfo.tupleSize = 1;
+	AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
+	{
+		TArray<FString> Values;
+		Values.Init(DataTable->GetPathName(), NumRows);
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(), InputNodeId, 0,
+			HAPI_UNREAL_ATTRIB_OBJECT_PATH, &AttributeInfo), false);
+
+		HOUDINI_CHECK_ERROR_RETURN(SetDataTableStringAttribute(
+			InputNodeId, HAPI_UNREAL_ATTRIB_OBJECT_PATH, AttributeInfo, Values), false);
+
+		Values.Init(DataTable->GetRowStructName().ToString(), NumRows);
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(), InputNodeId, 0,
+			HAPI_UNREAL_ATTRIB_DATA_TABLE_ROWSTRUCT, &AttributeInfo), false);
+
+		HOUDINI_CHECK_ERROR_RETURN(SetDataTableStringAttribute(
+			InputNodeId, HAPI_UNREAL_ATTRIB_DATA_TABLE_ROWSTRUCT, AttributeInfo, Values), false);
+
+		for (int32 RowIdx = 0; RowIdx < NumRows; RowIdx++)
+			Values[RowIdx] = RowNames[RowIdx].ToString();
+
+		const std::string RowNameAttribute = std::string(HAPI_UNREAL_ATTRIB_DATA_TABLE_PREFIX) + "0_Name";
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(), InputNodeId, 0,
+			RowNameAttribute.c_str(), &AttributeInfo), false);
+
+		HOUDINI_CHECK_ERROR_RETURN(SetDataTableStringAttribute(
+			InputNodeId, RowNameAttribute, AttributeInfo, Values), false);
+	}
+
+	// Now send each column with a single call
+	TArray<float> FloatValues;
+	TArray<int32> IntValues;
+	TArray<HAPI_Int64> Int64Values;
+	TArray<FString> StringValues;
+	for (const FHoudiniDataTableColumn& Column : Columns)
+	{
+		const FProperty* Property = Column.Property;
+		const int32 TupleSize = Column.TupleSize;
+
+		std::string AttributeName;
+		FHoudiniEngineUtils::ConvertUnrealString(Column.AttributeName, AttributeName);
+
+		AttributeInfo.tupleSize = TupleSize;
+		switch (Column.Type)
+		{
+			case EHoudiniDataTableColumnType::Float:
+			{
+				FloatValues.SetNumUninitialized(NumRows * TupleSize);
+				const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+				for (int32 RowIdx = 0; RowIdx < NumRows; RowIdx++)
+				{
+					const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Rows[RowIdx]);
+					float* RowValues = &FloatValues[RowIdx * TupleSize];
+					if (NumericProperty)
+					{
+						RowValues[0] = (float)NumericProperty->GetFloatingPointPropertyValue(ValuePtr);
+					}
+					else if (CastField<FStructProperty>(Property)->Struct == TBaseStructure<FRotator>::Get())
+					{
+						const FRotator& Rotator = *(const FRotator*)ValuePtr;
+						RowValues[0] = Rotator.Pitch;
+						RowValues[1] = Rotator.Yaw;
+						RowValues[2] = Rotator.Roll;
+					}
+					else
+					{
+						// The other structs are made of TupleSize floats
+						FMemory::Memcpy(RowValues, ValuePtr, TupleSize * sizeof(float));
+					}
+				}
+
+				AttributeInfo.storage = HAPI_STORAGETYPE_FLOAT;
+				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+					FHoudiniEngine::Get().GetSession(), InputNodeId, 0, AttributeName.c_str(), &AttributeInfo), false);
+
+				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+					FHoudiniEngine::Get().GetSession(), InputNodeId, 0, AttributeName.c_str(), &AttributeInfo,
+					FloatValues.GetData(), 0, AttributeInfo.count), false);
+
+				break;
+			}
+
+			case EHoudiniDataTableColumnType::Int:
+			{
+				IntValues.SetNumUninitialized(NumRows * TupleSize);
+				const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+				const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property);
+				const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+				for (int32 RowIdx = 0; RowIdx < NumRows; RowIdx++)
+				{
+					const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Rows[RowIdx]);
+					int32* RowValues = &IntValues[RowIdx * TupleSize];
+					if (BoolProperty)
+					{
+						RowValues[0] = BoolProperty->GetPropertyValue(ValuePtr) ? 1 : 0;
+					}
+					else if (NumericProperty)
+					{
+						RowValues[0] = (int32)NumericProperty->GetSignedIntPropertyValue(ValuePtr);
+					}
+					else if (StructProperty && StructProperty->Struct == TBaseStructure<FColor>::Get())
+					{
+						const FColor& Color = *(const FColor*)ValuePtr;
+						RowValues[0] = Color.R;
+						RowValues[1] = Color.G;
+						RowValues[2] = Color.B;
+						RowValues[3] = Color.A;
+					}
+					else
+					{
+						// FIntPoint / FIntVector are made of TupleSize ints
+						FMemory::Memcpy(RowValues, ValuePtr, TupleSize * sizeof(int32));
+					}
+				}
+
+				AttributeInfo.storage = HAPI_STORAGETYPE_INT;
+				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+					FHoudiniEngine::Get().GetSession(), InputNodeId, 0, AttributeName.c_str(), &AttributeInfo), false);
+
+				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeIntData(
+					FHoudiniEngine::Get().GetSession(), InputNodeId, 0, AttributeName.c_str(), &AttributeInfo,
+					IntValues.GetData(), 0, AttributeInfo.count), false);
+
+				break;
+			}
+
+			case EHoudiniDataTableColumnType::Int64:
+			{
+				Int64Values.SetNumUninitialized(NumRows);
+				const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+				const bool bIsUnsigned = Property->IsA<FUInt64Property>() || Property->IsA<FUInt32Property>();
+				for (int32 RowIdx = 0; RowIdx < NumRows; RowIdx++)
+				{
+					const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Rows[RowIdx]);
+					Int64Values[RowIdx] = bIsUnsigned
+						? (HAPI_Int64)NumericProperty->GetUnsignedIntPropertyValue(ValuePtr)
+						: (HAPI_Int64)NumericProperty->GetSignedIntPropertyValue(ValuePtr);
+				}
+
+				AttributeInfo.storage = HAPI_STORAGETYPE_INT64;
+				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+					FHoudiniEngine::Get().GetSession(), InputNodeId, 0, AttributeName.c_str(), &AttributeInfo), false);
+
+				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeInt64Data(
+					FHoudiniEngine::Get().GetSession(), InputNodeId, 0, AttributeName.c_str(), &AttributeInfo,
+					Int64Values.GetData(), 0, AttributeInfo.count), false);
+
+				break;
+			}
+
+			case EHoudiniDataTableColumnType::String:
+			{
+				// Use the same text export as UDataTable::GetTableData()
+				StringValues.SetNum(NumRows);
+				for (int32 RowIdx = 0; RowIdx < NumRows; RowIdx++)
+					StringValues[RowIdx] = DataTableUtils::GetPropertyValueAsString(Property, Rows[RowIdx], EDataTableExportFlags::None);
+
+				AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
+				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+					FHoudiniEngine::Get().GetSession(), InputNodeId, 0, AttributeName.c_str(), &AttributeInfo), false);
+
+				HOUDINI_CHECK_ERROR_RETURN(SetDataTableStringAttribute(
+					InputNodeId, AttributeName, AttributeInfo, StringValues), false);
+
+				break;
+			}
+		}
+	}
+
+	// Commit the geo.
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
+		FHoudiniEngine::Get().GetSession(), InputNodeId), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CookNode(
+		FHoudiniEngine::Get().GetSession(), InputNodeId, nullptr), false);
+
+	return true;
+}
@@ -33,6 +33,7 @@
 
 #include "Engine/StaticMesh.h"
 #include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/Level.h"
 
 bool
 FUnrealInstanceTranslator::HapiCreateInputNodeForInstancer(
@@ -209,4 +210,174 @@ FUnrealInstanceTranslator::HapiCreateInputNodeForInstancer(
 	OutCreatedNodeId = CopyNodeId;
 
 	return true;
-}
\ No newline at end of file
+}
+
+bool
+FUnrealInstanceTranslator::HapiCreateInputNodeForComponentInstances(
+	const TArray<UStaticMeshComponent*>& InComponents,
+	const HAPI_NodeId& InMeshNodeId,
+	HAPI_NodeId& OutCreatedNodeId)
+{
+	TArray<UStaticMeshComponent*> Components;
+	for (UStaticMeshComponent* CurrentSMC : InComponents)
+	{
+		if (CurrentSMC && !CurrentSMC->IsPendingKill())
+			Components.Add(CurrentSMC);
+	}
+
+	int32 InstanceCount = Components.Num();
+	if (InstanceCount < 1 || InMeshNodeId < 0)
+		return true;
+
+	// The instancer lives in the mesh node's OBJ
+	HAPI_NodeId ParentNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(InMeshNodeId);
+
+	int32 InstancesNodeId = -1;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::CreateNode(
+		ParentNodeId, TEXT("null"), "instances", false, &InstancesNodeId), false);
+
+	int32 CopyNodeId = -1;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::CreateNode(
+		ParentNodeId, TEXT("copytopoints"), "instancer", false, &CopyNodeId), false);
+
+	// set "Pack And Instance" (pack) to true
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetParmIntValue(
+		FHoudiniEngine::Get().GetSession(), CopyNodeId, "pack", 0, 1), false);
+
+	// MARSHALL THE COMPONENT TRANSFORMS
+	{
+		TArray<float> Positions;
+		Positions.SetNumZeroed(InstanceCount * 3);
+		TArray<float> Rotations;
+		Rotations.SetNumZeroed(InstanceCount * 4);
+		TArray<float> Scales;
+		Scales.SetNumZeroed(InstanceCount * 3);
+		TArray<FString> ActorPaths;
+		ActorPaths.SetNum(InstanceCount);
+		TArray<FString> LevelPaths;
+		LevelPaths.SetNum(InstanceCount);
+		for (int32 InstanceIdx = 0; InstanceIdx < InstanceCount; InstanceIdx++)
+		{
+			UStaticMeshComponent* CurrentSMC = Components[InstanceIdx];
+			FTransform CurTransform = CurrentSMC->GetComponentTransform();
+
+			// Convert Unreal Position to Houdini
+			FVector PositionVector = CurTransform.GetLocation();
+			Positions[InstanceIdx * 3 + 0] = PositionVector.X / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+			Positions[InstanceIdx * 3 + 1] = PositionVector.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+			Positions[InstanceIdx * 3 + 2] = PositionVector.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+
+			// Convert Unreal Rotation to Houdini
+			FQuat RotationQuaternion = CurTransform.GetRotation();
+			Rotations[InstanceIdx * 4 + 0] = RotationQuaternion.X;
+			Rotations[InstanceIdx * 4 + 1] = RotationQuaternion.Z;
+			Rotations[InstanceIdx * 4 + 2] = RotationQuaternion.Y;
+			Rotations[InstanceIdx * 4 + 3] = -RotationQuaternion.W;
+
+			// Convert Unreal Scale to Houdini
+			FVector ScaleVector = CurTransform.GetScale3D();
+			Scales[InstanceIdx * 3 + 0] = ScaleVector.X;
+			Scales[InstanceIdx * 3 + 1] = ScaleVector.Z;
+			Scales[InstanceIdx * 3 + 2] = ScaleVector.Y;
+
+			AActor* Owner = CurrentSMC->GetOwner();
+			if (Owner)
+			{
+				ActorPaths[InstanceIdx] = Owner->GetPathName();
+				if (Owner->GetLevel())
+					LevelPaths[InstanceIdx] = Owner->GetLevel()->GetPathName();
+			}
+		}
+
+		// Create a part for the instance points.
+		HAPI_PartInfo Part;
+		FHoudiniApi::PartInfo_Init(&Part);
+		Part.id = 0;
+		Part.nameSH = 0;
+		Part.attributeCounts[HAPI_ATTROWNER_POINT] = 0;
+		Part.attributeCounts[HAPI_ATTROWNER_PRIM] = 0;
+		Part.attributeCounts[HAPI_ATTROWNER_VERTEX] = 0;
+		Part.attributeCounts[HAPI_ATTROWNER_DETAIL] = 0;
+		Part.vertexCount = 0;
+		Part.faceCount = 0;
+		Part.pointCount = InstanceCount;
+		Part.type = HAPI_PARTTYPE_MESH;
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPartInfo(
+			FHoudiniEngine::Get().GetSession(), InstancesNodeId, 0, &Part), false);
+
+		HAPI_AttributeInfo AttributeInfoPoint;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfoPoint);
+		AttributeInfoPoint.count = InstanceCount;
+		AttributeInfoPoint.tupleSize = 3;
+		AttributeInfoPoint.exists = true;
+		AttributeInfoPoint.owner = HAPI_ATTROWNER_POINT;
+		AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
+		AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
+
+		// Position (P), rotation (rot) and scale
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(),
+			InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint), false);
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+			FHoudiniEngine::Get().GetSession(),
+			InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
+			Positions.GetData(), 0, AttributeInfoPoint.count), false);
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(),
+			InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_SCALE, &AttributeInfoPoint), false);
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+			FHoudiniEngine::Get().GetSession(),
+			InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_SCALE, &AttributeInfoPoint,
+			Scales.GetData(), 0, AttributeInfoPoint.count), false);
+
+		AttributeInfoPoint.tupleSize = 4;
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(),
+			InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_ROTATION, &AttributeInfoPoint), false);
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+			FHoudiniEngine::Get().GetSession(),
+			InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_ROTATION, &AttributeInfoPoint,
+			Rotations.GetData(), 0, AttributeInfoPoint.count), false);
+
+		// Per-instance actor and level paths, copied to the packed primitives
+		AttributeInfoPoint.tupleSize = 1;
+		AttributeInfoPoint.storage = HAPI_STORAGETYPE_STRING;
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(),
+			InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_ACTOR_PATH, &AttributeInfoPoint), false);
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::SetAttributeStringData(
+			ActorPaths, InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_ACTOR_PATH, AttributeInfoPoint), false);
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(),
+			InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_LEVEL_PATH, &AttributeInfoPoint), false);
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::SetAttributeStringData(
+			LevelPaths, InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_LEVEL_PATH, AttributeInfoPoint), false);
+
+		// Commit the instance point geo.
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
+			FHoudiniEngine::Get().GetSession(), InstancesNodeId), false);
+	}
+
+	// Connect the mesh to the copytopoints node's first input
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::ConnectNodeInput(
+		FHoudiniEngine::Get().GetSession(), CopyNodeId, 0, InMeshNodeId, 0), false);
+
+	// Connect the instances to the copytopoints node's second input
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::ConnectNodeInput(
+		FHoudiniEngine::Get().GetSession(), CopyNodeId, 1, InstancesNodeId, 0), false);
+
+	// The instancer is the OBJ's output
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetNodeDisplay(
+		FHoudiniEngine::Get().GetSession(), CopyNodeId, 1), false);
+
+	OutCreatedNodeId = CopyNodeId;
+
+	return true;
+}
@@ -32,6 +32,7 @@
 #include "UObject/ObjectMacros.h"
 
 class UInstancedStaticMeshComponent;
+class UStaticMeshComponent;
 
 struct HOUDINIENGINE_API FUnrealInstanceTranslator
 {
@@ -46,4 +47,11 @@ struct HOUDINIENGINE_API FUnrealInstanceTranslator
 			const bool& bExportSockets,
 			const bool& bExportColliders,
 			const bool& bExportAsAttributeInstancer);
+
+		// HAPI : Creates a packed instancer of InMeshNodeId with one point per component, carrying the
+		// components' transforms and actor/level paths. The nodes are created next to InMeshNodeId.
+		static bool HapiCreateInputNodeForComponentInstances(
+			const TArray<UStaticMeshComponent*>& InComponents,
+			const HAPI_NodeId& InMeshNodeId,
+			HAPI_NodeId& OutCreatedNodeId);
 };
\ No newline at end of file
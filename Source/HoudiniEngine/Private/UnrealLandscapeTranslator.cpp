@@ -34,13 +34,18 @@
 
 #include "UnrealLandscapeTranslator.h"
 #include "HoudiniGeoPartObject.h"
+#include "HoudiniInputObject.h"
 
 #include "Landscape.h"
+#include "LandscapeComponent.h"
 #include "LandscapeDataAccess.h"
 #include "LandscapeEdit.h"
+#include "LandscapeInfo.h"
 #include "LightMap.h"
+#include "Engine/Texture2D.h"
 #include "Engine/MapBuildDataRegistry.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Async/ParallelFor.h"
 
 
 bool 
@@ -175,7 +180,13 @@ FUnrealLandscapeTranslator::CreateMeshOrPointsFromLandscape(
 		return false;
 
 	// Create point attribute containing landscape component name.
-	if (!AddLandscapeComponentNameAttribute(DisplayGeoInfo.nodeId, LandscapeComponentNameArray))
+	bool bNameAttributeSuccess = AddLandscapeComponentNameAttribute(DisplayGeoInfo.nodeId, LandscapeComponentNameArray);
+
+	// Free the memory allocated for the component names, which are shared by all the points of a component
+	for (int32 PointIdx = 0; PointIdx < LandscapeComponentNameArray.Num(); PointIdx += VertexCountPerComponent)
+		FHoudiniEngineUtils::FreeRawStringMemory(LandscapeComponentNameArray[PointIdx]);
+
+	if (!bNameAttributeSuccess)
 		return false;
 
 	// Create point attribute info containing lightmap information.
@@ -272,62 +283,422 @@ FUnrealLandscapeTranslator::CreateMeshOrPointsFromLandscape(
 	return FHoudiniEngineUtils::HapiCookNode(InputNodeId, nullptr, true);
 }
 
+// Number of landscape components whose data is extracted in parallel for mesh/points inputs
+static const int32 HoudiniLandscapeExtractBatchSize = 64;
+
+// Number of values sent per SetHeightFieldData call when uploading landscape data to Houdini
+static const int32 HoudiniLandscapeUploadChunkSize = 1 << 20;
+
+// Unreal's landscape uses 16bits precision and range from -256m to 256m with the default scale of 100.0
+// To convert the uint16 values to float "metric" values, offset the int by 32768 to center it, then scale it
+static void
+GetLandscapeHeightConversion(const FTransform& LandscapeTransform, double& ZSpacing, double& ZPositionOffset)
+{
+	ZSpacing = 512.0 / ((double)UINT16_MAX);
+	ZSpacing *= ((double)LandscapeTransform.GetScale3D().Z / 100.0);
+	ZPositionOffset = LandscapeTransform.GetLocation().Z / 100.0f;
+}
+
+static float
+ConvertLandscapeHeightValue(const uint16& Value, const double& ZSpacing, const double& ZPositionOffset)
+{
+	// Unreal's digit value have a zero value of 32768
+	return (float)(((double)Value - 32767.0) * ZSpacing + ZPositionOffset);
+}
+
+// Sends float values to a volume, in chunks of HoudiniLandscapeUploadChunkSize
+static bool
+SetHeightfieldValues(
+	const HAPI_NodeId& VolumeNodeId, const HAPI_PartId& PartId, const std::string& VolumeName,
+	const float* Values, const int32& Start, const int32& Num)
+{
+	for (int32 Offset = 0; Offset < Num; Offset += HoudiniLandscapeUploadChunkSize)
+	{
+		const int32 Length = FMath::Min(HoudiniLandscapeUploadChunkSize, Num - Offset);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetHeightFieldData(
+			FHoudiniEngine::Get().GetSession(),
+			VolumeNodeId, PartId, VolumeName.c_str(), Values + Offset, Start + Offset, Length), false);
+	}
+
+	return true;
+}
+
+// Reads the columns [StartColumn, EndColumn) of the landscape extent in bands, converts them and sends them to the volume.
+// Unreal's X/Y are swapped in Houdini, so each landscape column is a contiguous row of the volume, and the volume
+// is written with start/length writes without ever needing the whole landscape in memory.
+template<typename TData, typename TReadFunc, typename TConvertFunc>
+static bool
+UploadLandscapeColumns(
+	const HAPI_NodeId& VolumeNodeId, const HAPI_PartId& PartId, const FString& VolumeName,
+	const int32& MinX, const int32& MinY, const int32& MaxY,
+	const int32& StartColumn, const int32& EndColumn,
+	TReadFunc ReadFunc, TConvertFunc ConvertFunc)
+{
+	const int32 YSize = MaxY - MinY + 1;
+	const int32 ColumnsPerChunk = FMath::Max(1, HoudiniLandscapeUploadChunkSize / YSize);
+
+	std::string NameStr;
+	FHoudiniEngineUtils::ConvertUnrealString(VolumeName, NameStr);
+
+	TArray<TData> BandData;
+	TArray<float> FloatData;
+	for (int32 Column = StartColumn; Column < EndColumn; Column += ColumnsPerChunk)
+	{
+		const int32 NumColumns = FMath::Min(ColumnsPerChunk, EndColumn - Column);
+		BandData.Reset();
+		BandData.AddZeroed(NumColumns * YSize);
+		ReadFunc(MinX + Column, MinY, MinX + Column + NumColumns - 1, MaxY, BandData.GetData());
+
+		FloatData.SetNumUninitialized(NumColumns * YSize);
+		ParallelFor(NumColumns, [&](int32 nX)
+		{
+			for (int32 nY = 0; nY < YSize; nY++)
+				FloatData[nY + nX * YSize] = ConvertFunc(BandData[nX + nY * NumColumns]);
+		});
+
+		if (!SetHeightfieldValues(VolumeNodeId, PartId, NameStr, FloatData.GetData(), Column * YSize, FloatData.Num()))
+			return false;
+	}
+
+	return true;
+}
+
+// Gets the extent (in quads) and bounds of a landscape proxy, or of its selected components
+static bool
+GetLandscapeProxyExtent(
+	ALandscapeProxy* LandscapeProxy, ULandscapeInfo* LandscapeInfo, const bool& bExportSelectionOnly,
+	int32& MinX, int32& MinY, int32& MaxX, int32& MaxY,
+	FVector& Min, FVector& Max,
+	TArray<ULandscapeComponent*>& OutComponents)
+{
+	MinX = MAX_int32;
+	MinY = MAX_int32;
+	MaxX = -MAX_int32;
+	MaxY = -MAX_int32;
+	OutComponents.Empty();
+
+	ALandscape* Landscape = LandscapeProxy->GetLandscapeActor();
+
+	TSet<ULandscapeComponent*> SelectedComponents;
+#if WITH_EDITOR
+	if (bExportSelectionOnly)
+		SelectedComponents = LandscapeInfo->GetSelectedComponents();
+#endif
+
+	FBox Bounds(ForceInit);
+	for (ULandscapeComponent* Comp : SelectedComponents)
+	{
+		// Only keep the selected components that belong to this proxy
+		if (!IsValid(Comp) || (LandscapeProxy != Landscape && Comp->GetLandscapeProxy() != LandscapeProxy))
+			continue;
+
+		Comp->GetComponentExtent(MinX, MinY, MaxX, MaxY);
+		OutComponents.Add(Comp);
+		if (Comp->IsRegistered())
+			Bounds += Comp->Bounds.GetBox();
+	}
+
+	FVector Origin, Extent;
+	if (OutComponents.Num() > 0)
+	{
+		Bounds.GetCenterAndExtents(Origin, Extent);
+	}
+	else
+	{
+		if (LandscapeProxy == Landscape)
+		{
+			// The proxy is a landscape actor, so we have to use the landscape extent (landscape components
+			// may have been moved to proxies and may not be present on this actor).
+			LandscapeInfo->GetLandscapeExtent(MinX, MinY, MaxX, MaxY);
+			LandscapeInfo->XYtoComponentMap.GenerateValueArray(OutComponents);
+		}
+		else
+		{
+			// We only want to get the data for this landscape proxy.
+			// To handle streaming proxies correctly, get the extents via all the components,
+			// not by calling GetLandscapeExtent or we'll end up sending ALL the streaming proxies.
+			for (ULandscapeComponent* Comp : LandscapeProxy->LandscapeComponents)
+			{
+				if (!IsValid(Comp))
+					continue;
+
+				Comp->GetComponentExtent(MinX, MinY, MaxX, MaxY);
+				OutComponents.Add(Comp);
+			}
+		}
+
+		// Do not use Landscape->GetActorBounds() here as instanced geo
+		// (due to grass layers for example) can cause it to return incorrect bounds!
+		FUnrealLandscapeTranslator::GetLandscapeProxyBounds(LandscapeProxy, Origin, Extent);
+	}
+
+	Min = Origin - Extent;
+	Max = Origin + Extent;
+
+	return MinX != MAX_int32 && MinY != MAX_int32 && MaxX != -MAX_int32 && MaxY != -MAX_int32;
+}
+
+// Adds a landscape texture's source id to a hash, the id changes whenever the texture's data is edited
+static uint32
+HashLandscapeTexture(UTexture2D* InTexture, const uint32& InHash)
+{
+	if (!IsValid(InTexture))
+		return InHash;
+
+	return HashCombine(InHash, GetTypeHash(InTexture->Source.GetId()));
+}
+
+// Adds the weightmaps and their layer allocations to a hash
+static uint32
+HashLandscapeWeightmaps(
+	const TArray<UTexture2D*>& InWeightmaps, const TArray<FWeightmapLayerAllocationInfo>& InAllocations, uint32 InHash)
+{
+	for (UTexture2D* Weightmap : InWeightmaps)
+		InHash = HashLandscapeTexture(Weightmap, InHash);
+
+	for (const FWeightmapLayerAllocationInfo& Allocation : InAllocations)
+	{
+		InHash = HashCombine(InHash, GetTypeHash(Allocation.LayerInfo));
+		InHash = HashCombine(InHash, GetTypeHash(Allocation.WeightmapTextureIndex));
+		InHash = HashCombine(InHash, GetTypeHash(Allocation.WeightmapTextureChannel));
+	}
+
+	return InHash;
+}
+
+// Hashes the height, weight and edit layer data of each component.
+// Only the textures' source ids are read: they change when the data is edited, so we don't need to read the data itself.
+// Components sharing a texture are all considered changed when one of them is edited.
+static void
+HashLandscapeComponentsData(
+	const TArray<ULandscapeComponent*>& Components,
+	const TArray<FLandscapeLayer*>& EditLayers,
+	TMap<FIntPoint, uint32>& OutHashes)
+{
+	OutHashes.Empty(Components.Num());
+	for (ULandscapeComponent* Comp : Components)
+	{
+		if (!IsValid(Comp))
+			continue;
+
+		uint32 Hash = HashLandscapeTexture(Comp->GetHeightmap(), 0);
+		Hash = HashLandscapeWeightmaps(Comp->GetWeightmapTextures(), Comp->GetWeightmapLayerAllocations(), Hash);
+
+		for (const FLandscapeLayer* Layer : EditLayers)
+		{
+			const FLandscapeLayerComponentData* LayerData = Comp->GetLayerData(Layer->Guid);
+			if (!LayerData)
+				continue;
+
+			Hash = HashLandscapeTexture(LayerData->HeightmapData.Texture, Hash);
+			Hash = HashLandscapeWeightmaps(LayerData->WeightmapData.Textures, LayerData->WeightmapData.LayerAllocations, Hash);
+		}
+
+		OutHashes.Add(Comp->GetSectionBase(), Hash);
+	}
+}
+
+// Returns the lowest weight value of a layer, reading it in bands
+static int32
+GetLandscapeLayerMinValue(
+	ULandscapeInfo* LandscapeInfo, ULandscapeLayerInfoObject* LayerInfo,
+	const int32& MinX, const int32& MinY, const int32& MaxX, const int32& MaxY)
+{
+	const int32 YSize = MaxY - MinY + 1;
+	const int32 ColumnsPerChunk = FMath::Max(1, HoudiniLandscapeUploadChunkSize / YSize);
+
+	FLandscapeEditDataInterface LandscapeEdit(LandscapeInfo);
+	TArray<uint8> BandData;
+	uint8 MinValue = UINT8_MAX;
+	for (int32 X = MinX; X <= MaxX; X += ColumnsPerChunk)
+	{
+		const int32 BandMaxX = FMath::Min(X + ColumnsPerChunk - 1, MaxX);
+		BandData.Reset();
+		BandData.AddZeroed((BandMaxX - X + 1) * YSize);
+		LandscapeEdit.GetWeightDataFast(LayerInfo, X, MinY, BandMaxX, MaxY, BandData.GetData(), 0);
+		for (const uint8& Value : BandData)
+			MinValue = FMath::Min(MinValue, Value);
+	}
+
+	return MinValue;
+}
+
 bool 
 FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
-	ALandscapeProxy* LandscapeProxy, HAPI_NodeId& CreatedHeightfieldNodeId, const FString& InputNodeNameStr) 
+	ALandscapeProxy* LandscapeProxy,
+	HAPI_NodeId& CreatedHeightfieldNodeId,
+	const FString& InputNodeNameStr,
+	UHoudiniInputLandscape* InInputLandscape,
+	const bool& bExportSelectionOnly)
 {
 	if (!LandscapeProxy)
 		return false;
 
+	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+	if (!LandscapeInfo)
+		return false;
+
 	// Export the whole landscape and its layer as a single heightfield.
 	FString NodeName = InputNodeNameStr + TEXT("_") + LandscapeProxy->GetName();
 
 	//--------------------------------------------------------------------------------------------------
-	// 1. Extracting the height data
+	// 1. Get the extent of the data to send, and the volume info
 	//--------------------------------------------------------------------------------------------------
-	TArray<uint16> HeightData;
-	int32 XSize, YSize;
+	int32 MinX, MinY, MaxX, MaxY;
 	FVector Min, Max;
-	if (!GetLandscapeData(LandscapeProxy, HeightData, XSize, YSize, Min, Max))
+	TArray<ULandscapeComponent*> Components;
+	if (!GetLandscapeProxyExtent(LandscapeProxy, LandscapeInfo, bExportSelectionOnly, MinX, MinY, MaxX, MaxY, Min, Max, Components))
 		return false;
 
-	//--------------------------------------------------------------------------------------------------
-	// 2. Convert the height uint16 data to float
-	//--------------------------------------------------------------------------------------------------
-	TArray<float> HeightfieldFloatValues;
-	HAPI_VolumeInfo HeightfieldVolumeInfo;
-	FHoudiniApi::VolumeInfo_Init(&HeightfieldVolumeInfo);
-	//FTransform LandscapeTransform = LandscapeProxy->LandscapeActorToWorld();// LandscapeProxy->ActorToWorld();
+	const int32 XSize = MaxX - MinX + 1;
+	const int32 YSize = MaxY - MinY + 1;
+	if ((XSize < 2) || (YSize < 2))
+		return false;
 
 	// Get the actual transform of this proxy, not the landscape actor's transform!
 	FTransform LandscapeTM = LandscapeProxy->LandscapeActorToWorld();
 	FTransform ProxyRelativeTM(FVector(LandscapeProxy->LandscapeSectionOffset));
 	FTransform LandscapeTransform = ProxyRelativeTM * LandscapeTM;
 
+	HAPI_VolumeInfo HeightfieldVolumeInfo;
+	FHoudiniApi::VolumeInfo_Init(&HeightfieldVolumeInfo);
 	FVector CenterOffset = FVector::ZeroVector;
-	if (!ConvertLandscapeDataToHeightfieldData(
-		HeightData, XSize, YSize, Min, Max, LandscapeTransform,
-		HeightfieldFloatValues, HeightfieldVolumeInfo, CenterOffset))
-		return false;
+	GetHeightfieldVolumeInfo(XSize, YSize, Min, Max, LandscapeTransform, HeightfieldVolumeInfo, CenterOffset);
+
+	// Paint layers and edit layers to send
+	TArray<int32> PaintLayerIndices;
+	for (int32 n = 0; n < LandscapeInfo->Layers.Num(); n++)
+	{
+		if (LandscapeInfo->Layers[n].LayerInfoObj)
+			PaintLayerIndices.Add(n);
+	}
+
+	ALandscape* Landscape = LandscapeProxy->GetLandscapeActor();
+	TArray<FLandscapeLayer*> EditLayers;
+	if (IsValid(Landscape))
+	{
+		for (FLandscapeLayer& Layer : Landscape->LandscapeLayers)
+			EditLayers.Add(&Layer);
+	}
+
+	// Names of the volumes of the heightfield: height, mask, paint layers and edit layers
+	TArray<FString> VolumeNames = { TEXT("height"), TEXT("mask") };
+	for (const int32& LayerIndex : PaintLayerIndices)
+	{
+		const FString LayerName = LandscapeInfo->Layers[LayerIndex].GetLayerName().ToString();
+		VolumeNames.AddUnique(LayerName.Equals(TEXT("mask"), ESearchCase::IgnoreCase) ? FString(TEXT("mask")) : LayerName);
+	}
+
+	for (const FLandscapeLayer* Layer : EditLayers)
+		VolumeNames.AddUnique(FString::Format(TEXT("landscapelayer_{0}"), { Layer->Name.ToString() }));
 
 	//--------------------------------------------------------------------------------------------------
-	// 3. Create the Heightfield Input Node
+	// 2. Hash the components' data, and see which part of the previous heightfield needs to be updated
+	//--------------------------------------------------------------------------------------------------
+	TMap<FIntPoint, uint32> ComponentHashes;
+	HashLandscapeComponentsData(Components, EditLayers, ComponentHashes);
+
+	// We can update the previous heightfield in place if it is still valid and has the same layout
+	bool bUpdate = IsValid(InInputLandscape)
+		&& FHoudiniEngineUtils::IsHoudiniNodeValid(CreatedHeightfieldNodeId)
+		&& InInputLandscape->CachedExtentMin == FIntPoint(MinX, MinY)
+		&& InInputLandscape->CachedExtentMax == FIntPoint(MaxX, MaxY)
+		&& InInputLandscape->CachedHeightfieldTransform.Equals(LandscapeTransform)
+		&& InInputLandscape->CachedVolumeNodeIds.Num() == VolumeNames.Num();
+
+	if (bUpdate)
+	{
+		for (const FString& VolumeName : VolumeNames)
+		{
+			const int32* VolumeNodeId = InInputLandscape->CachedVolumeNodeIds.Find(VolumeName);
+			if (!VolumeNodeId || !FHoudiniEngineUtils::IsHoudiniNodeValid(*VolumeNodeId))
+			{
+				bUpdate = false;
+				break;
+			}
+		}
+	}
+
+	// Range of landscape columns that need to be sent
+	int32 StartColumn = 0;
+	int32 EndColumn = XSize;
+	if (bUpdate)
+	{
+		StartColumn = XSize;
+		EndColumn = 0;
+
+		const int32 ComponentSizeQuads = LandscapeProxy->ComponentSizeQuads;
+		auto AddChangedComponent = [&](const FIntPoint& SectionBase)
+		{
+			StartColumn = FMath::Max(0, FMath::Min(StartColumn, SectionBase.X - MinX));
+			EndColumn = FMath::Min(XSize, FMath::Max(EndColumn, SectionBase.X + ComponentSizeQuads + 1 - MinX));
+		};
+
+		for (const auto& Pair : ComponentHashes)
+		{
+			const uint32* CachedHash = InInputLandscape->CachedComponentHashes.Find(Pair.Key);
+			if (!CachedHash || *CachedHash != Pair.Value)
+				AddChangedComponent(Pair.Key);
+		}
+
+		// Removed components need to be sent as well
+		for (const auto& Pair : InInputLandscape->CachedComponentHashes)
+		{
+			if (!ComponentHashes.Contains(Pair.Key))
+				AddChangedComponent(Pair.Key);
+		}
+
+		HOUDINI_LANDSCAPE_MESSAGE(TEXT("[FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape] Updating landscape columns %d to %d"), StartColumn, EndColumn);
+	}
+	else if (IsValid(InInputLandscape))
+	{
+		InInputLandscape->ResetCachedHeightfieldData();
+	}
+
+	//--------------------------------------------------------------------------------------------------
+	// 3. Create the Heightfield Input Node, or reuse the previous one
 	//-------------------------------------------------------------------------------------------------- 
 	HAPI_NodeId HeightFieldId = -1;
 	HAPI_NodeId HeightId = -1;
 	HAPI_NodeId MaskId = -1;
 	HAPI_NodeId MergeId = -1;
-	if (!CreateHeightfieldInputNode(NodeName, XSize, YSize, HeightFieldId, HeightId, MaskId, MergeId))
-		return false;
+	TMap<FString, int32> VolumeNodeIds;
+	if (bUpdate)
+	{
+		HeightFieldId = CreatedHeightfieldNodeId;
+		VolumeNodeIds = InInputLandscape->CachedVolumeNodeIds;
+		HeightId = VolumeNodeIds.FindRef(TEXT("height"));
+		MaskId = VolumeNodeIds.FindRef(TEXT("mask"));
+	}
+	else
+	{
+		if (!CreateHeightfieldInputNode(NodeName, XSize, YSize, HeightFieldId, HeightId, MaskId, MergeId))
+			return false;
+
+		VolumeNodeIds.Add(TEXT("height"), HeightId);
+		VolumeNodeIds.Add(TEXT("mask"), MaskId);
+	}
 
 	//--------------------------------------------------------------------------------------------------
 	// 4. Set the HeightfieldData in Houdini
 	//--------------------------------------------------------------------------------------------------    
-	// Set the Height volume's data
+	// The volume info is sent on updates as well, so the volume is set up before its changed columns are written
 	HAPI_PartId PartId = 0;
-	if (!SetHeightfieldData(HeightId, PartId, HeightfieldFloatValues, HeightfieldVolumeInfo, TEXT("height")))
+	if (!SetHeightfieldVolumeInfo(HeightId, PartId, HeightfieldVolumeInfo))
 		return false;
 
+	{
+		double ZSpacing, ZPositionOffset;
+		GetLandscapeHeightConversion(LandscapeTransform, ZSpacing, ZPositionOffset);
+
+		FLandscapeEditDataInterface LandscapeEdit(LandscapeInfo);
+		if (!UploadLandscapeColumns<uint16>(
+			HeightId, PartId, TEXT("height"), MinX, MinY, MaxY, StartColumn, EndColumn,
+			[&](int32 X1, int32 Y1, int32 X2, int32 Y2, uint16* OutData) { LandscapeEdit.GetHeightDataFast(X1, Y1, X2, Y2, OutData, 0); },
+			[&](const uint16& Value) { return ConvertLandscapeHeightValue(Value, ZSpacing, ZPositionOffset); }))
+			return false;
+	}
+
 	// Apply attributes to the heightfield
 	ApplyAttributesToHeightfieldNode(HeightId, PartId, LandscapeProxy);
 
@@ -336,12 +707,8 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 		FHoudiniEngine::Get().GetSession(), HeightId), false);
 
 	//--------------------------------------------------------------------------------------------------
-    // 5. Extract and convert all the layers
-    //--------------------------------------------------------------------------------------------------
-	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
-	if (!LandscapeInfo)
-		return false;
-
+	// 5. Extract, convert and send all the layers
+	//--------------------------------------------------------------------------------------------------
 	bool MaskInitialized = false;
 	int32 MergeInputIndex = 2;
 
@@ -358,37 +725,50 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 		}
 		return Result;
 	};
-	
-	int32 NumLayers = LandscapeInfo->Layers.Num();
-	for (int32 n = 0; n < NumLayers; n++)
-	{
-		// 1. Extract the uint8 values from the layer
-		TArray<uint8> CurrentLayerIntData;
-		FLinearColor LayerUsageDebugColor;
-		FString LayerName;
-		if (!GetLandscapeLayerData(LandscapeProxy, LandscapeInfo, n, CurrentLayerIntData, LayerUsageDebugColor, LayerName))
-			continue;
 
-		// 2. Convert unreal uint8 values to floats
-		// If the layer came from Houdini, additional info might have been stored in the DebugColor to convert the data back to float
-		HAPI_VolumeInfo CurrentLayerVolumeInfo;
-		FHoudiniApi::VolumeInfo_Init(&CurrentLayerVolumeInfo);
-		TArray<float> CurrentLayerFloatData;
-		if (!ConvertLandscapeLayerDataToHeightfieldData(
-			CurrentLayerIntData, XSize, YSize, LayerUsageDebugColor,
-			CurrentLayerFloatData, CurrentLayerVolumeInfo))
-			continue;
+	TMap<FString, int32> LayerMinValues;
+	for (const int32& LayerIndex : PaintLayerIndices)
+	{
+		ULandscapeLayerInfoObject* LayerInfo = LandscapeInfo->Layers[LayerIndex].LayerInfoObj;
+		const FString LayerName = LandscapeInfo->Layers[LayerIndex].GetLayerName().ToString();
+
+		// See if we need to create an input volume, or can reuse the HF's default mask volume
+		const bool IsMask = LayerName.Equals(TEXT("mask"), ESearchCase::IgnoreCase);
+		const FString VolumeKey = IsMask ? FString(TEXT("mask")) : LayerName;
+
+		// By default, values are converted from unreal [0 255] uint8 to Houdini [0 1] float
+		int32 IntMin = 0;
+		float LayerMin = 0.0f;
+		float LayerSpacing = 1.0f / (float)UINT8_MAX;
+
+		// If this layer came from Houdini, its alpha value should be PI
+		// This indicates that we can extract additional infos stored its debug usage color
+		// so we can reconstruct the original source values (float) more accurately
+		int32 LayerStartColumn = StartColumn;
+		int32 LayerEndColumn = EndColumn;
+		if (LayerInfo->LayerUsageDebugColor.A == PI)
+		{
+			IntMin = GetLandscapeLayerMinValue(LandscapeInfo, LayerInfo, MinX, MinY, MaxX, MaxY);
+			LayerMin = LayerInfo->LayerUsageDebugColor.R;
+			LayerSpacing = LayerInfo->LayerUsageDebugColor.B;
 
-		// We reuse the height layer's transform
-		CurrentLayerVolumeInfo.transform = HeightfieldVolumeInfo.transform;
+			// The whole layer needs to be sent again if its lowest value changed
+			const int32* CachedIntMin = bUpdate ? InInputLandscape->CachedLayerMinValues.Find(VolumeKey) : nullptr;
+			if (bUpdate && (!CachedIntMin || *CachedIntMin != IntMin))
+			{
+				LayerStartColumn = 0;
+				LayerEndColumn = XSize;
+			}
 
-		// 3. See if we need to create an input volume, or can reuse the HF's default mask volume
-		bool IsMask = false;
-		if (LayerName.Equals(TEXT("mask"), ESearchCase::IgnoreCase))
-			IsMask = true;
+			LayerMinValues.Add(VolumeKey, IntMin);
+		}
 
 		HAPI_NodeId LayerVolumeNodeId = -1;
-		if (!IsMask)
+		if (bUpdate)
+		{
+			LayerVolumeNodeId = VolumeNodeIds.FindRef(VolumeKey);
+		}
+		else if (!IsMask)
 		{
 			// Current layer is not mask, so we need to create a new input volume
 			std::string LayerNameStr;
@@ -397,6 +777,8 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 			FHoudiniApi::CreateHeightfieldInputVolumeNode(
 				FHoudiniEngine::Get().GetSession(),
 				HeightFieldId, &LayerVolumeNodeId, LayerNameStr.c_str(), XSize, YSize, 1.0f);
+
+			VolumeNodeIds.Add(VolumeKey, LayerVolumeNodeId);
 		}
 		else
 		{
@@ -408,18 +790,17 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 		if (!FHoudiniEngineUtils::IsHoudiniNodeValid(LayerVolumeNodeId))
 			continue;
 
-		// 4. Set the layer/mask heighfield data in Houdini
-		HAPI_PartId CurrentPartId = 0;
-		if (!SetHeightfieldData(LayerVolumeNodeId, PartId, CurrentLayerFloatData, CurrentLayerVolumeInfo, LayerName))
+		// Set the layer/mask heighfield data in Houdini, the layers reuse the height layer's transform
+		if (!SetHeightfieldVolumeInfo(LayerVolumeNodeId, PartId, HeightfieldVolumeInfo))
 			continue;
 
-		// Get the physical material used by that layer
-		UPhysicalMaterial* LayerPhysicalMat = LandscapeProxy->DefaultPhysMaterial;
 		{
-			FLandscapeInfoLayerSettings LayersSetting = LandscapeInfo->Layers[n];
-			ULandscapeLayerInfoObject* LayerInfo = LayersSetting.LayerInfoObj;
-			if (LayerInfo)
-				LayerPhysicalMat = LayerInfo->PhysMaterial;
+			FLandscapeEditDataInterface LandscapeEdit(LandscapeInfo);
+			if (!UploadLandscapeColumns<uint8>(
+				LayerVolumeNodeId, PartId, LayerName, MinX, MinY, MaxY, LayerStartColumn, LayerEndColumn,
+				[&](int32 X1, int32 Y1, int32 X2, int32 Y2, uint8* OutData) { LandscapeEdit.GetWeightDataFast(LayerInfo, X1, Y1, X2, Y2, OutData, 0); },
+				[&](const uint8& Value) { return (float)(((double)Value - (double)IntMin) * LayerSpacing + LayerMin); }))
+				continue;
 		}
 
 		// Apply attributes to the heightfield input node
@@ -429,21 +810,21 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
 			FHoudiniEngine::Get().GetSession(), LayerVolumeNodeId), false);
 
-		if (!IsMask)
+		if (IsMask)
 		{
-			// We had to create a new volume for this layer, so we need to connect it to the HF's merge node
-			HOUDINI_CHECK_ERROR_RETURN(MergeInputFn(MergeId, LayerVolumeNodeId), false);
+			MaskInitialized = true;
 		}
-		else
+		else if (!bUpdate)
 		{
-			MaskInitialized = true;
+			// We had to create a new volume for this layer, so we need to connect it to the HF's merge node
+			HOUDINI_CHECK_ERROR_RETURN(MergeInputFn(MergeId, LayerVolumeNodeId), false);
 		}
 	}
 
 	// We need to have a mask layer as it is required for proper heightfield functionalities
 	// Setting the volume info on the mask is needed for the HF to have proper transform in H!
 	// If we didn't create a mask volume before, send a default one now
-	if (!MaskInitialized)
+	if (!MaskInitialized && !bUpdate)
 	{
 		MaskInitialized = InitDefaultHeightfieldMask(HeightfieldVolumeInfo, MaskId);
 
@@ -454,22 +835,20 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 			FHoudiniEngine::Get().GetSession(), MaskId), false);
 	}
 
-	// We need a valid landscape actor to get the edit layers
-	ALandscape* Landscape = LandscapeProxy->GetLandscapeActor();
-	if(IsValid(Landscape))
+	//--------------------------------------------------------------------------------------------------
+	// 6. Create heightfield input for each editable landscape layer
+	//--------------------------------------------------------------------------------------------------
+	for (FLandscapeLayer* Layer : EditLayers)
 	{
-		//--------------------------------------------------------------------------------------------------
-		// Create heightfield input for each editable landscape layer
-		//--------------------------------------------------------------------------------------------------
-		HAPI_VolumeInfo LayerVolumeInfo;
-		FHoudiniApi::VolumeInfo_Init(&HeightfieldVolumeInfo);
-		
-		for(FLandscapeLayer& Layer : Landscape->LandscapeLayers)
+		const FString LayerVolumeName = FString::Format(TEXT("landscapelayer_{0}"), { Layer->Name.ToString() });
+
+		HAPI_NodeId LandscapeLayerNodeId = -1;
+		if (bUpdate)
+		{
+			LandscapeLayerNodeId = VolumeNodeIds.FindRef(LayerVolumeName);
+		}
+		else
 		{
-			const FString LayerVolumeName = FString::Format(TEXT("landscapelayer_{0}"), {Layer.Name.ToString()});
-			
-			HAPI_NodeId LandscapeLayerNodeId = -1;
-			
 			HOUDINI_LANDSCAPE_MESSAGE(TEXT("[FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape] Creating input node for editable landscape layer: %s"), *LayerVolumeName);
 
 			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateHeightfieldInputVolumeNode(
@@ -481,8 +860,10 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 				1.f
 				), false);
 
+			VolumeNodeIds.Add(LayerVolumeName, LandscapeLayerNodeId);
+
 			// Create a volume visualization node
-			const FString VisualizationName = FString::Format(TEXT("visualization_{0}"), {Layer.Name.ToString()});
+			const FString VisualizationName = FString::Format(TEXT("visualization_{0}"), { Layer->Name.ToString() });
 			HAPI_NodeId VisualizationNodeId = -1;
 			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateNode(
 				FHoudiniEngine::Get().GetSession(),
@@ -500,7 +881,7 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 				"vismode",
 				0, 2
 				), false);
-			
+
 			// Set Density Field to '*'.
 			HAPI_ParmId DensityFieldParmId = -1;
 			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmIdFromName(
@@ -517,7 +898,7 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 				), false);
 
 			// Create a visibility node
-			const FString VisibilityName = FString::Format(TEXT("visibility_{0}"), {Layer.Name.ToString()});
+			const FString VisibilityName = FString::Format(TEXT("visibility_{0}"), { Layer->Name.ToString() });
 			HAPI_NodeId VisibilityNodeId = -1;
 			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateNode(
 				FHoudiniEngine::Get().GetSession(),
@@ -540,35 +921,32 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 
 			// Connect the visibility node to the merge input
 			HOUDINI_CHECK_ERROR_RETURN(MergeInputFn(MergeId, VisibilityNodeId), false);
+		}
 
-			FScopedSetLandscapeEditingLayer Scope(Landscape, Layer.Guid ); // Scope landscape access to the current layer
+		if (!SetHeightfieldVolumeInfo(LandscapeLayerNodeId, 0, HeightfieldVolumeInfo))
+			return false;
 
-			TArray<uint16> LayerHeightData;
-			TArray<float> LayerHeightFloatData;
-			//--------------------------------------------------------------------------------------------------
-			// Extracting height data
-			//--------------------------------------------------------------------------------------------------
-			if (!GetLandscapeData(LandscapeProxy, LayerHeightData, XSize, YSize, Min, Max))
-				return false;
+		{
+			// Scope landscape access to the current layer
+			FScopedSetLandscapeEditingLayer Scope(Landscape, Layer->Guid);
+
+			double ZSpacing, ZPositionOffset;
+			GetLandscapeHeightConversion(LandscapeTransform, ZSpacing, ZPositionOffset);
 
-			//--------------------------------------------------------------------------------------------------
-			// Convert the height uint16 data to float
-			//--------------------------------------------------------------------------------------------------
-			if (!ConvertLandscapeDataToHeightfieldData(
-				LayerHeightData, XSize, YSize, Min, Max, LandscapeTransform,
-				LayerHeightFloatData, LayerVolumeInfo, CenterOffset))
+			FLandscapeEditDataInterface LandscapeEdit(LandscapeInfo);
+			if (!UploadLandscapeColumns<uint16>(
+				LandscapeLayerNodeId, 0, LayerVolumeName, MinX, MinY, MaxY, StartColumn, EndColumn,
+				[&](int32 X1, int32 Y1, int32 X2, int32 Y2, uint16* OutData) { LandscapeEdit.GetHeightDataFast(X1, Y1, X2, Y2, OutData, 0); },
+				[&](const uint16& Value) { return ConvertLandscapeHeightValue(Value, ZSpacing, ZPositionOffset); }))
 				return false;
+		}
 
-			HAPI_PartId LayerPartId = 0;
-			SetHeightfieldData(LandscapeLayerNodeId, LayerPartId, LayerHeightFloatData, LayerVolumeInfo, LayerVolumeName);
+		// Apply attributes to the heightfield input node
+		ApplyAttributesToHeightfieldNode(LandscapeLayerNodeId, 0, LandscapeProxy);
 
-			// Apply attributes to the heightfield input node
-			ApplyAttributesToHeightfieldNode(LandscapeLayerNodeId, 0, LandscapeProxy);
-			
-			// Commit the volume's geo
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
+		// Commit the volume's geo
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
 			FHoudiniEngine::Get().GetSession(), LandscapeLayerNodeId), false);
-		}
 	}
 
 	HAPI_TransformEuler HAPIObjectTransform;
@@ -597,6 +975,17 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 
 	CreatedHeightfieldNodeId = HeightFieldId;
 
+	// Cache what we sent, so the next update only sends the components that changed
+	if (IsValid(InInputLandscape))
+	{
+		InInputLandscape->CachedComponentHashes = MoveTemp(ComponentHashes);
+		InInputLandscape->CachedExtentMin = FIntPoint(MinX, MinY);
+		InInputLandscape->CachedExtentMax = FIntPoint(MaxX, MaxY);
+		InInputLandscape->CachedHeightfieldTransform = ProxyRelativeTM * LandscapeTM;
+		InInputLandscape->CachedVolumeNodeIds = MoveTemp(VolumeNodeIds);
+		InInputLandscape->CachedLayerMinValues = MoveTemp(LayerMinValues);
+	}
+
 	return true;
 }
 
@@ -923,33 +1312,12 @@ FUnrealLandscapeTranslator::ConvertLandscapeDataToHeightfieldData(
 	if (IntHeightData.Num() != SizeInPoints)
 		return false;
 
-	// Use default unreal scaling for marshalling landscapes
-	// A lot of precision will be lost in order to keep the same transform as the landscape input
-	bool bUseDefaultUE4Scaling = false;
-	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
-	if (HoudiniRuntimeSettings && HoudiniRuntimeSettings->MarshallingLandscapesUseDefaultUnrealScaling)
-		bUseDefaultUE4Scaling = HoudiniRuntimeSettings->MarshallingLandscapesUseDefaultUnrealScaling;
-
 	//--------------------------------------------------------------------------------------------------
 	// 1. Convert values to float
 	//--------------------------------------------------------------------------------------------------
+	double ZSpacing, ZPositionOffset;
+	GetLandscapeHeightConversion(LandscapeTransform, ZSpacing, ZPositionOffset);
 
-
-	// Convert the min/max values from cm to meters
-	Min /= 100.0;
-	Max /= 100.0;
-
-	// Unreal's landscape uses 16bits precision and range from -256m to 256m with the default scale of 100.0
-	// To convert the uint16 values to float "metric" values, offset the int by 32768 to center it,
-	// then scale it
-
-	// Spacing used to convert from uint16 to meters
-	double ZSpacing = 512.0 / ((double)UINT16_MAX);
-	ZSpacing *= ((double)LandscapeTransform.GetScale3D().Z / 100.0);
-
-	// Center value in meters (Landscape ranges from [-255:257] meters at default scale
-	double ZCenterOffset = 32767;
-	double ZPositionOffset = LandscapeTransform.GetLocation().Z / 100.0f;
 	// Convert the Int data to Float
 	HeightfieldFloatValues.SetNumUninitialized(SizeInPoints);
 
@@ -962,14 +1330,42 @@ FUnrealLandscapeTranslator::ConvertLandscapeDataToHeightfieldData(
 			int32 nUnreal = nY + nX * XSize;
 
 			// Convert the int values to meter
-			// Unreal's digit value have a zero value of 32768
-			double DoubleValue = ((double)IntHeightData[nUnreal] - ZCenterOffset) * ZSpacing + ZPositionOffset;
-			HeightfieldFloatValues[nHoudini] = (float)DoubleValue;
+			HeightfieldFloatValues[nHoudini] = ConvertLandscapeHeightValue(IntHeightData[nUnreal], ZSpacing, ZPositionOffset);
 		}
 	}
 
 	//--------------------------------------------------------------------------------------------------
-	// 2. Convert the Unreal Transform to a HAPI_transform
+	// 2. Fill the volume info
+	//--------------------------------------------------------------------------------------------------
+	return GetHeightfieldVolumeInfo(XSize, YSize, Min, Max, LandscapeTransform, HeightfieldVolumeInfo, CenterOffset);
+}
+
+bool
+FUnrealLandscapeTranslator::GetHeightfieldVolumeInfo(
+	const int32& XSize, const int32& YSize,
+	FVector Min, FVector Max,
+	const FTransform& LandscapeTransform,
+	HAPI_VolumeInfo& HeightfieldVolumeInfo,
+	FVector& CenterOffset)
+{
+	int32 HoudiniXSize = YSize;
+	int32 HoudiniYSize = XSize;
+	if ((HoudiniXSize < 2) || (HoudiniYSize < 2))
+		return false;
+
+	// Use default unreal scaling for marshalling landscapes
+	// A lot of precision will be lost in order to keep the same transform as the landscape input
+	bool bUseDefaultUE4Scaling = false;
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+	if (HoudiniRuntimeSettings && HoudiniRuntimeSettings->MarshallingLandscapesUseDefaultUnrealScaling)
+		bUseDefaultUE4Scaling = HoudiniRuntimeSettings->MarshallingLandscapesUseDefaultUnrealScaling;
+
+	// Convert the min/max values from cm to meters
+	Min /= 100.0;
+	Max /= 100.0;
+
+	//--------------------------------------------------------------------------------------------------
+	// 1. Convert the Unreal Transform to a HAPI_transform
 	//--------------------------------------------------------------------------------------------------
 	HAPI_Transform HapiTransform;
 	FHoudiniApi::Transform_Init(&HapiTransform);
@@ -1014,7 +1410,7 @@ FUnrealLandscapeTranslator::ConvertLandscapeDataToHeightfieldData(
 	}
 
 	//--------------------------------------------------------------------------------------------------
-	// 3. Fill the volume info
+	// 2. Fill the volume info
 	//--------------------------------------------------------------------------------------------------
 	HeightfieldVolumeInfo.xLength = HoudiniXSize;
 	HeightfieldVolumeInfo.yLength = HoudiniYSize;
@@ -1080,6 +1476,23 @@ FUnrealLandscapeTranslator::SetHeightfieldData(
 	TArray<float>& FloatValues,
 	const HAPI_VolumeInfo& VolumeInfo,
 	const FString& HeightfieldName)
+{
+	if (!SetHeightfieldVolumeInfo(VolumeNodeId, PartId, VolumeInfo))
+		return false;
+
+	// Volume name
+	std::string NameStr;
+	FHoudiniEngineUtils::ConvertUnrealString(HeightfieldName, NameStr);
+
+	// Set the Heighfield data on the volume
+	return SetHeightfieldValues(VolumeNodeId, PartId, NameStr, FloatValues.GetData(), 0, FloatValues.Num());
+}
+
+bool
+FUnrealLandscapeTranslator::SetHeightfieldVolumeInfo(
+	const HAPI_NodeId& VolumeNodeId,
+	const HAPI_PartId& PartId,
+	const HAPI_VolumeInfo& VolumeInfo)
 {
 	// Cook the node to get proper infos on it
 	/*
@@ -1110,16 +1523,6 @@ FUnrealLandscapeTranslator::SetHeightfieldData(
 		FHoudiniEngine::Get().GetSession(),
 		VolumeNodeId, PartInfo.id, &VolumeInfo), false);
 
-	// Volume name
-	std::string NameStr;
-	FHoudiniEngineUtils::ConvertUnrealString(HeightfieldName, NameStr);
-
-	// Set the Heighfield data on the volume
-	float * HeightData = FloatValues.GetData();
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetHeightFieldData(
-		FHoudiniEngine::Get().GetSession(),
-		GeoInfo.nodeId, PartInfo.id, NameStr.c_str(), HeightData, 0, FloatValues.Num()), false);
-
 	return true;
 }
 
@@ -1432,19 +1835,24 @@ FUnrealLandscapeTranslator::InitDefaultHeightfieldMask(
 {
 	// We need to have a mask layer as it is required for proper heightfield functionalities
 
-	// Creating an array filled with 0.0
-	TArray< float > MaskFloatData;
-	MaskFloatData.Init(0.0f, HeightVolumeInfo.xLength * HeightVolumeInfo.yLength);
-
 	// Creating the volume infos
 	HAPI_VolumeInfo MaskVolumeInfo = HeightVolumeInfo;
-
-	// Set the heighfield data in Houdini
-	FString MaskName = TEXT("mask");
 	HAPI_PartId PartId = 0;
-	if (!SetHeightfieldData(MaskVolumeNodeId, PartId, MaskFloatData, MaskVolumeInfo, MaskName))
+	if (!SetHeightfieldVolumeInfo(MaskVolumeNodeId, PartId, MaskVolumeInfo))
 		return false;
 
+	// Set the heighfield data in Houdini, by sending the same chunk filled with 0.0
+	const int32 NumValues = HeightVolumeInfo.xLength * HeightVolumeInfo.yLength;
+	TArray< float > MaskFloatData;
+	MaskFloatData.Init(0.0f, FMath::Min(NumValues, HoudiniLandscapeUploadChunkSize));
+
+	std::string MaskName = "mask";
+	for (int32 Start = 0; Start < NumValues; Start += MaskFloatData.Num())
+	{
+		if (!SetHeightfieldValues(MaskVolumeNodeId, PartId, MaskName, MaskFloatData.GetData(), Start, FMath::Min(MaskFloatData.Num(), NumValues - Start)))
+			return false;
+	}
+
 	return true;
 }
 
@@ -1546,9 +1954,6 @@ FUnrealLandscapeTranslator::ExtractLandscapeData(
 	if (SelectedComponents.Num() < 1)
 		return false;
 
-	// Get runtime settings.
-	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
-
 	// Calc all the needed sizes
 	int32 ComponentSizeQuads = ((LandscapeProxy->ComponentSizeQuads + 1) >> LandscapeProxy->ExportLOD) - 1;
 	float ScaleFactor = (float)LandscapeProxy->ComponentSizeQuads / (float)ComponentSizeQuads;
@@ -1570,145 +1975,164 @@ FUnrealLandscapeTranslator::ExtractLandscapeData(
 	if (bExportLighting)
 		LandscapeLightmapValues.SetNumUninitialized(VertexCount);
 
-	//-----------------------------------------------------------------------------------------------------------------
-	// EXTRACT THE LANDSCAPE DATA
-	//-----------------------------------------------------------------------------------------------------------------
-	FIntPoint IntPointMax = FIntPoint::ZeroValue;
-
-	int32 AllPositionsIdx = 0;
-	for (int32 ComponentIdx = 0; ComponentIdx < LandscapeProxy->LandscapeComponents.Num(); ComponentIdx++)
+	// The components to export, in the proxy's order
+	TArray<ULandscapeComponent*> Components;
+	Components.Reserve(NumComponents);
+	for (ULandscapeComponent* LandscapeComponent : LandscapeProxy->LandscapeComponents)
 	{
-		ULandscapeComponent * LandscapeComponent = LandscapeProxy->LandscapeComponents[ComponentIdx];
 		if (bExportOnlySelected && !SelectedComponents.Contains(LandscapeComponent))
 			continue;
 
-		TArray64< uint8 > LightmapMipData;
+		Components.Add(LandscapeComponent);
+	}
+
+	//-----------------------------------------------------------------------------------------------------------------
+	// EXTRACT THE LANDSCAPE DATA
+	//-----------------------------------------------------------------------------------------------------------------
+	// Data acquired on the game thread for each component, before extracting its vertices in parallel
+	struct FLandscapeComponentExtractData
+	{
+		TUniquePtr<FLandscapeComponentDataInterface> CDI;
+		TArray64<uint8> LightmapMipData;
 		int32 LightmapMipSizeX = 0;
 		int32 LightmapMipSizeY = 0;
+		FIntPoint SectionBase = FIntPoint::ZeroValue;
+		FVector ScaleVector = FVector::OneVector;
+		int32 FirstVertexIdx = 0;
+	};
+
+	FIntPoint IntPointMax = FIntPoint::ZeroValue;
+	for (int32 BatchStart = 0; BatchStart < Components.Num(); BatchStart += HoudiniLandscapeExtractBatchSize)
+	{
+		const int32 BatchNum = FMath::Min(HoudiniLandscapeExtractBatchSize, Components.Num() - BatchStart);
 
-		// See if we need to export lighting information.
-		if (bExportLighting)
+		TArray<FLandscapeComponentExtractData> Batch;
+		Batch.SetNum(BatchNum);
+		for (int32 BatchIdx = 0; BatchIdx < BatchNum; BatchIdx++)
 		{
-			const FMeshMapBuildData* MapBuildData = LandscapeComponent->GetMeshMapBuildData();
-			FLightMap2D* LightMap2D = MapBuildData && MapBuildData->LightMap ? MapBuildData->LightMap->GetLightMap2D() : nullptr;
-			if (LightMap2D && LightMap2D->IsValid(0))
+			ULandscapeComponent* LandscapeComponent = Components[BatchStart + BatchIdx];
+			FLandscapeComponentExtractData& ExtractData = Batch[BatchIdx];
+
+			// See if we need to export lighting information.
+			if (bExportLighting)
 			{
-				UTexture2D * TextureLightmap = LightMap2D->GetTexture(0);
-				if (TextureLightmap)
+				const FMeshMapBuildData* MapBuildData = LandscapeComponent->GetMeshMapBuildData();
+				FLightMap2D* LightMap2D = MapBuildData && MapBuildData->LightMap ? MapBuildData->LightMap->GetLightMap2D() : nullptr;
+				if (LightMap2D && LightMap2D->IsValid(0))
 				{
-					if (TextureLightmap->Source.GetMipData(LightmapMipData, 0, 0, 0, nullptr))
+					UTexture2D * TextureLightmap = LightMap2D->GetTexture(0);
+					if (TextureLightmap)
 					{
-						LightmapMipSizeX = TextureLightmap->Source.GetSizeX();
-						LightmapMipSizeY = TextureLightmap->Source.GetSizeY();
-					}
-					else
-					{
-						LightmapMipData.Empty();
+						if (TextureLightmap->Source.GetMipData(ExtractData.LightmapMipData, 0, 0, 0, nullptr))
+						{
+							ExtractData.LightmapMipSizeX = TextureLightmap->Source.GetSizeX();
+							ExtractData.LightmapMipSizeY = TextureLightmap->Source.GetSizeY();
+						}
+						else
+						{
+							ExtractData.LightmapMipData.Empty();
+						}
 					}
 				}
 			}
-		}
 
-		// Construct landscape component data interface to access raw data.
-		FLandscapeComponentDataInterface CDI(LandscapeComponent, LandscapeProxy->ExportLOD);
+			// Construct landscape component data interface to access raw data.
+			ExtractData.CDI = MakeUnique<FLandscapeComponentDataInterface>(LandscapeComponent, LandscapeProxy->ExportLOD);
+			ExtractData.SectionBase = LandscapeComponent->GetSectionBase();
+			ExtractData.ScaleVector = LandscapeComponent->GetComponentTransform().GetScale3D();
+			ExtractData.FirstVertexIdx = (BatchStart + BatchIdx) * VertexCountPerComponent;
 
-		// Get name of this landscape component.
-		const char * LandscapeComponentNameStr = FHoudiniEngineUtils::ExtractRawString(LandscapeComponent->GetName());
-		for (int32 VertexIdx = 0; VertexIdx < VertexCountPerComponent; VertexIdx++)
-		{
-			int32 VertX = 0;
-			int32 VertY = 0;
-			CDI.VertexIndexToXY(VertexIdx, VertX, VertY);
-
-			// Get position.
-			FVector PositionVector = CDI.GetWorldVertex(VertX, VertY);
-
-			// Get normal / tangent / binormal.
-			FVector Normal = FVector::ZeroVector;
-			FVector TangentX = FVector::ZeroVector;
-			FVector TangentY = FVector::ZeroVector;
-			CDI.GetLocalTangentVectors(VertX, VertY, TangentX, TangentY, Normal);
-
-			// Export UVs.
-			FVector TextureUV = FVector::ZeroVector;
-			if (bExportTileUVs)
-			{
-				// We want to export uvs per tile.
-				TextureUV = FVector(VertX, VertY, 0.0f);
+			// Keep track of max offset.
+			if (!bExportTileUVs)
+				IntPointMax = IntPointMax.ComponentMax(ExtractData.SectionBase);
 
-				// If we need to normalize UV space.
-				if (bExportNormalizedUVs)
-					TextureUV /= ComponentSizeQuads;
-			}
-			else
-			{
-				// We want to export global uvs (default).
-				FIntPoint IntPoint = LandscapeComponent->GetSectionBase();
-				TextureUV = FVector(VertX * ScaleFactor + IntPoint.X, VertY * ScaleFactor + IntPoint.Y, 0.0f);
+			// Get name of this landscape component, the string is freed once the name attribute has been sent
+			const char * LandscapeComponentNameStr = FHoudiniEngineUtils::ExtractRawString(LandscapeComponent->GetName());
+			for (int32 VertexIdx = 0; VertexIdx < VertexCountPerComponent; VertexIdx++)
+				LandscapeComponentNameArray[ExtractData.FirstVertexIdx + VertexIdx] = LandscapeComponentNameStr;
+		}
 
-				// Keep track of max offset.
-				IntPointMax = IntPointMax.ComponentMax(IntPoint);
-			}
+		// Extract the vertices of the batch's components in parallel, directly in the output arrays
+		ParallelFor(BatchNum, [&](int32 BatchIdx)
+		{
+			const FLandscapeComponentExtractData& ExtractData = Batch[BatchIdx];
+			const FLandscapeComponentDataInterface& CDI = *ExtractData.CDI;
 
-			if (bExportLighting)
+			for (int32 VertexIdx = 0; VertexIdx < VertexCountPerComponent; VertexIdx++)
 			{
-				FLinearColor VertexLightmapColor(0.0f, 0.0f, 0.0f, 1.0f);
-				if (LightmapMipData.Num() > 0)
-				{
-					FVector2D UVCoord(VertX, VertY);
-					UVCoord /= (ComponentSizeQuads + 1);
+				const int32 PositionIdx = ExtractData.FirstVertexIdx + VertexIdx;
 
-					FColor LightmapColorRaw = PickVertexColorFromTextureMip(
-						LightmapMipData.GetData(), UVCoord, LightmapMipSizeX, LightmapMipSizeY);
+				int32 VertX = 0;
+				int32 VertY = 0;
+				CDI.VertexIndexToXY(VertexIdx, VertX, VertY);
 
-					VertexLightmapColor = LightmapColorRaw.ReinterpretAsLinear();
-				}
+				// Get position.
+				FVector PositionVector = CDI.GetWorldVertex(VertX, VertY);
 
-				LandscapeLightmapValues[AllPositionsIdx] = VertexLightmapColor;
-			}
+				// Get normal / tangent / binormal.
+				FVector Normal = FVector::ZeroVector;
+				FVector TangentX = FVector::ZeroVector;
+				FVector TangentY = FVector::ZeroVector;
+				CDI.GetLocalTangentVectors(VertX, VertY, TangentX, TangentY, Normal);
 
-			// Retrieve component transform.
-			const FTransform & ComponentTransform = LandscapeComponent->GetComponentTransform();
-
-			// Retrieve component scale.
-			const FVector & ScaleVector = ComponentTransform.GetScale3D();
+				// Export UVs.
+				FVector TextureUV = FVector::ZeroVector;
+				if (bExportTileUVs)
+				{
+					// We want to export uvs per tile.
+					TextureUV = FVector(VertX, VertY, 0.0f);
 
-			// Perform normalization.
-			Normal /= ScaleVector;
-			Normal.Normalize();
+					// If we need to normalize UV space.
+					if (bExportNormalizedUVs)
+						TextureUV /= ComponentSizeQuads;
+				}
+				else
+				{
+					// We want to export global uvs (default).
+					TextureUV = FVector(VertX * ScaleFactor + ExtractData.SectionBase.X, VertY * ScaleFactor + ExtractData.SectionBase.Y, 0.0f);
+				}
 
-			TangentX /= ScaleVector;
-			TangentX.Normalize();
+				// Only sample the lightmap if it was requested
+				if (bExportLighting)
+				{
+					FLinearColor VertexLightmapColor(0.0f, 0.0f, 0.0f, 1.0f);
+					if (ExtractData.LightmapMipData.Num() > 0)
+					{
+						FVector2D UVCoord(VertX, VertY);
+						UVCoord /= (ComponentSizeQuads + 1);
 
-			TangentY /= ScaleVector;
-			TangentY.Normalize();
+						FColor LightmapColorRaw = PickVertexColorFromTextureMip(
+							ExtractData.LightmapMipData.GetData(), UVCoord, ExtractData.LightmapMipSizeX, ExtractData.LightmapMipSizeY);
 
-			// Perform position scaling.
-			FVector PositionTransformed = PositionVector / HAPI_UNREAL_SCALE_FACTOR_POSITION;
-			LandscapePositionArray[AllPositionsIdx].X = PositionTransformed.X;
-			LandscapePositionArray[AllPositionsIdx].Y = PositionTransformed.Z;
-			LandscapePositionArray[AllPositionsIdx].Z = PositionTransformed.Y;
+						VertexLightmapColor = LightmapColorRaw.ReinterpretAsLinear();
+					}
 
-			Swap(Normal.Y, Normal.Z);
+					LandscapeLightmapValues[PositionIdx] = VertexLightmapColor;
+				}
 
-			// Store landscape component name for this point.
-			LandscapeComponentNameArray[AllPositionsIdx] = LandscapeComponentNameStr;
+				// Perform normalization.
+				Normal /= ExtractData.ScaleVector;
+				Normal.Normalize();
 
-			// Store vertex index (x,y) for this point.
-			LandscapeComponentVertexIndicesArray[AllPositionsIdx].X = VertX;
-			LandscapeComponentVertexIndicesArray[AllPositionsIdx].Y = VertY;
+				// Perform position scaling.
+				FVector PositionTransformed = PositionVector / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+				LandscapePositionArray[PositionIdx].X = PositionTransformed.X;
+				LandscapePositionArray[PositionIdx].Y = PositionTransformed.Z;
+				LandscapePositionArray[PositionIdx].Z = PositionTransformed.Y;
 
-			// Store point normal.
-			LandscapeNormalArray[AllPositionsIdx] = Normal;
+				Swap(Normal.Y, Normal.Z);
 
-			// Store uv.
-			LandscapeUVArray[AllPositionsIdx] = TextureUV;
+				// Store vertex index (x,y) for this point.
+				LandscapeComponentVertexIndicesArray[PositionIdx].X = VertX;
+				LandscapeComponentVertexIndicesArray[PositionIdx].Y = VertY;
 
-			AllPositionsIdx++;
-		}
+				// Store point normal.
+				LandscapeNormalArray[PositionIdx] = Normal;
 
-		// Free the memory allocated for LandscapeComponentNameStr
-		FHoudiniEngineUtils::FreeRawStringMemory(LandscapeComponentNameStr);
+				// Store uv.
+				LandscapeUVArray[PositionIdx] = TextureUV;
+			}
+		});
 	}
 
 	// If we need to normalize UV space and we are doing global UVs.
@@ -1717,12 +2141,12 @@ FUnrealLandscapeTranslator::ExtractLandscapeData(
 		IntPointMax += FIntPoint(ComponentSizeQuads, ComponentSizeQuads);
 		IntPointMax = IntPointMax.ComponentMax(FIntPoint(1, 1));
 
-		for (int32 UVIdx = 0; UVIdx < VertexCount; ++UVIdx)
+		ParallelFor(VertexCount, [&](int32 UVIdx)
 		{
 			FVector & PositionUV = LandscapeUVArray[UVIdx];
 			PositionUV.X /= IntPointMax.X;
 			PositionUV.Y /= IntPointMax.Y;
-		}
+		});
 	}
 
 	return true;
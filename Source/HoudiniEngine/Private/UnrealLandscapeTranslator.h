@@ -39,10 +39,14 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 		// ------------------------------------------------------------------------------------------
 		// Unreal Landscape to Houdini Heightfield
 		// ------------------------------------------------------------------------------------------
+		// If an input landscape is given, the data sent is cached on it so that the next call
+		// only updates the parts of the heightfield whose landscape components changed.
 		static bool CreateHeightfieldFromLandscape(
 			ALandscapeProxy* LandcapeProxy, 
 			HAPI_NodeId& CreatedHeightfieldNodeId,
-			const FString &InputNodeNameStr);
+			const FString &InputNodeNameStr,
+			UHoudiniInputLandscape* InInputLandscape = nullptr,
+			const bool& bExportSelectionOnly = false);
 
 		static bool CreateInputNodeForLandscape(
 			ALandscapeProxy* LandscapeProxy,
@@ -99,6 +103,16 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			HAPI_VolumeInfo& HeightfieldVolumeInfo,
 			FVector& CenterOffset);
 
+		// Fills the volume info and center offset of a heightfield of the given size
+		static bool GetHeightfieldVolumeInfo(
+			const int32& XSize,
+			const int32& YSize,
+			FVector Min,
+			FVector Max,
+			const FTransform& LandscapeTransform,
+			HAPI_VolumeInfo& HeightfieldVolumeInfo,
+			FVector& CenterOffset);
+
 		// Converts Unreal uint8 values to Houdini Float
 		static bool ConvertLandscapeLayerDataToHeightfieldData(
 			const TArray<uint8>& IntHeightData,
@@ -125,6 +139,12 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			const HAPI_VolumeInfo& VolumeInfo,
 			const FString& HeightfieldName);
 
+		// Set the volume info of a heightfield volume, before sending its data
+		static bool SetHeightfieldVolumeInfo(
+			const HAPI_NodeId& VolumeNodeId,
+			const HAPI_PartId& PartId,
+			const HAPI_VolumeInfo& VolumeInfo);
+
 		static bool AddLandscapeMaterialAttributesToVolume(
 			const HAPI_NodeId& VolumeNodeId,
 			const HAPI_PartId& PartId,
@@ -28,6 +28,7 @@
 
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniGeoWriter.h"
 #include "HoudiniEnginePrivatePCH.h"
 
 #include "RawMesh.h"
@@ -46,6 +47,127 @@
 	#include "EditorFramework/AssetImportData.h"
 #endif
 
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/ThreadSafeCounter.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineInputMarshallingThreads(
+	TEXT("HoudiniEngine.InputMarshallingThreads"),
+	0,
+	TEXT("Maximum number of threads used to convert input meshes before they are sent to Houdini.\n")
+	TEXT("0: Use all the task graph's worker threads\n")
+	TEXT("1: Convert the meshes one after the other\n"));
+
+// Identifies a static mesh LOD converted by PrepareStaticMeshInputGeos
+struct FHoudiniPreparedMeshGeoKey
+{
+	FHoudiniPreparedMeshGeoKey(UStaticMesh* InStaticMesh, UStaticMeshComponent* InComponent, const int32& InLODIndex, const bool& bInAddLODGroups)
+		: StaticMesh(InStaticMesh), Component(InComponent), LODIndex(InLODIndex), bAddLODGroups(bInAddLODGroups) {}
+
+	bool operator==(const FHoudiniPreparedMeshGeoKey& Other) const
+	{
+		return StaticMesh == Other.StaticMesh && Component == Other.Component
+			&& LODIndex == Other.LODIndex && bAddLODGroups == Other.bAddLODGroups;
+	}
+
+	friend uint32 GetTypeHash(const FHoudiniPreparedMeshGeoKey& Key)
+	{
+		uint32 Hash = HashCombine(GetTypeHash(Key.StaticMesh), GetTypeHash(Key.Component));
+		return HashCombine(Hash, GetTypeHash(Key.LODIndex * 2 + (Key.bAddLODGroups ? 1 : 0)));
+	}
+
+	UStaticMesh* StaticMesh;
+	UStaticMeshComponent* Component;
+	int32 LODIndex;
+	bool bAddLODGroups;
+};
+
+// Geometry converted ahead of its upload, only accessed on the game thread
+static TMap<FHoudiniPreparedMeshGeoKey, TSharedPtr<FHoudiniGeoWriter>> PreparedStaticMeshInputGeos;
+
+void
+FUnrealMeshTranslator::PrepareStaticMeshInputGeos(
+	const TArray<TPair<UStaticMesh*, UStaticMeshComponent*>>& InMeshes, const bool& bExportAllLODs)
+{
+	struct FPrepareJob
+	{
+		FHoudiniPreparedMeshGeoKey Key;
+		const FStaticMeshLODResources* LODResources;
+		TSharedPtr<FHoudiniGeoWriter> Geo;
+		double Seconds;
+		bool bSuccess;
+	};
+
+	// Gather the LODs to convert on the game thread, the same way HapiCreateInputNodeForStaticMesh does
+	TArray<FPrepareJob> Jobs;
+	for (const TPair<UStaticMesh*, UStaticMeshComponent*>& Mesh : InMeshes)
+	{
+		UStaticMesh* StaticMesh = Mesh.Key;
+		if (!StaticMesh || StaticMesh->IsPendingKill() || !StaticMesh->RenderData)
+			continue;
+
+		const bool bAddLODGroups = bExportAllLODs && (StaticMesh->GetNumLODs() > 1);
+		const int32 NumLODs = bAddLODGroups ? StaticMesh->GetNumLODs() : 1;
+		for (int32 LODIndex = 0; LODIndex < NumLODs; LODIndex++)
+		{
+			FHoudiniPreparedMeshGeoKey Key(StaticMesh, Mesh.Value, LODIndex, bAddLODGroups);
+			if (PreparedStaticMeshInputGeos.Contains(Key))
+				continue;
+
+			Jobs.Add(FPrepareJob{ Key, &StaticMesh->GetLODForExport(LODIndex), nullptr, 0.0, false });
+		}
+	}
+
+	if (Jobs.Num() <= 0)
+		return;
+
+	// Use a bounded number of workers, each picking the next job until they're all done
+	const int32 MaxThreads = CVarHoudiniEngineInputMarshallingThreads.GetValueOnGameThread();
+	const int32 NumWorkers = FMath::Clamp(
+		MaxThreads > 0 ? MaxThreads : FTaskGraphInterface::Get().GetNumWorkerThreads(), 1, Jobs.Num());
+
+	const double StartTime = FPlatformTime::Seconds();
+	FThreadSafeCounter NextJob;
+	ParallelFor(NumWorkers, [&](int32 WorkerIndex)
+	{
+		for (int32 JobIndex = NextJob.Increment() - 1; JobIndex < Jobs.Num(); JobIndex = NextJob.Increment() - 1)
+		{
+			FPrepareJob& Job = Jobs[JobIndex];
+			const double JobStartTime = FPlatformTime::Seconds();
+
+			// Deferred writers don't make any HAPI call
+			Job.Geo = MakeShared<FHoudiniGeoWriter>(true, true);
+			Job.bSuccess = CreateInputNodeForStaticMeshLODResources(
+				-1, *Job.LODResources, Job.Key.LODIndex, Job.Key.bAddLODGroups,
+				Job.Key.StaticMesh, Job.Key.Component, Job.Geo.Get()) && Job.Geo->HasDeferredCommit();
+
+			Job.Seconds = FPlatformTime::Seconds() - JobStartTime;
+		}
+	}, NumWorkers <= 1);
+
+	for (FPrepareJob& Job : Jobs)
+	{
+		const FString ObjectName = Job.Key.Component ? Job.Key.Component->GetPathName() : Job.Key.StaticMesh->GetPathName();
+		if (!Job.bSuccess)
+		{
+			HOUDINI_LOG_WARNING(TEXT("Failed to prepare the input geometry of %s LOD %d, it will be converted during its upload."), *ObjectName, Job.Key.LODIndex);
+			continue;
+		}
+
+		HOUDINI_LOG_HELPER(Verbose, TEXT("Prepared the input geometry of %s LOD %d in %.4f seconds"), *ObjectName, Job.Key.LODIndex, Job.Seconds);
+		PreparedStaticMeshInputGeos.Add(Job.Key, Job.Geo);
+	}
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Prepared %d input mesh LODs on %d threads in %.4f seconds"), Jobs.Num(), NumWorkers, FPlatformTime::Seconds() - StartTime);
+}
+
+void
+FUnrealMeshTranslator::ResetPreparedStaticMeshInputGeos()
+{
+	PreparedStaticMeshInputGeos.Empty();
+}
+
 bool
 FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 	UStaticMesh* StaticMesh,
@@ -213,16 +335,33 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 		}
 		else if (ExportMethod == 2)
 		{
-			// Convert the LOD Mesh using FStaticMeshLODResources
+			// Send the geometry if this LOD has already been converted by PrepareStaticMeshInputGeos
+			TSharedPtr<FHoudiniGeoWriter> PreparedGeo;
+			PreparedStaticMeshInputGeos.RemoveAndCopyValue(
+				FHoudiniPreparedMeshGeoKey(StaticMesh, StaticMeshComponent, LODIndex, DoExportLODs), PreparedGeo);
+
 			const double StartTime = FPlatformTime::Seconds();
-			bMeshSuccess = FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
-				CurrentLODNodeId,
-				StaticMesh->GetLODForExport(LODIndex),
-				LODIndex,
-				DoExportLODs,
-				StaticMesh,
-				StaticMeshComponent);
-			HOUDINI_LOG_MESSAGE(TEXT("FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources completed in %.4f seconds"), FPlatformTime::Seconds() - StartTime);
+			if (PreparedGeo.IsValid())
+			{
+				HAPI_Result Result = PreparedGeo->SendBufferedGeo(CurrentLODNodeId, FHoudiniGeoWriter::ShouldBufferMeshInputs());
+				if (Result != HAPI_RESULT_SUCCESS)
+					HOUDINI_LOG_ERROR(TEXT("Hapi failed: %s"), *FHoudiniEngineUtils::GetErrorDescription());
+
+				bMeshSuccess = Result == HAPI_RESULT_SUCCESS;
+				HOUDINI_LOG_HELPER(Verbose, TEXT("Sending the prepared geometry of %s LOD %d completed in %.4f seconds"), *StaticMesh->GetName(), LODIndex, FPlatformTime::Seconds() - StartTime);
+			}
+			else
+			{
+				// Convert the LOD Mesh using FStaticMeshLODResources
+				bMeshSuccess = FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
+					CurrentLODNodeId,
+					StaticMesh->GetLODForExport(LODIndex),
+					LODIndex,
+					DoExportLODs,
+					StaticMesh,
+					StaticMeshComponent);
+				HOUDINI_LOG_MESSAGE(TEXT("FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources completed in %.4f seconds"), FPlatformTime::Seconds() - StartTime);
+			}
 		}
 		else
 		{
@@ -703,6 +842,9 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 	FRawMesh RawMesh;
 	SourceModel.LoadRawMesh(RawMesh);
 	
+	// Either sends the geometry with individual HAPI calls, or buffers it and sends it in one LoadGeoFromMemory call
+	FHoudiniGeoWriter GeoWriter(FHoudiniGeoWriter::ShouldBufferMeshInputs());
+
 	// Create part.
 	HAPI_PartInfo Part;
 	FHoudiniApi::PartInfo_Init(&Part);
@@ -718,8 +860,8 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 	Part.pointCount = RawMesh.VertexPositions.Num();
 	Part.type = HAPI_PARTTYPE_MESH;
 
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPartInfo(
-		FHoudiniEngine::Get().GetSession(), NodeId, 0, &Part), false);
+	HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetPartInfo(
+		NodeId, 0, &Part), false);
 
 	// Create point attribute info.
 	HAPI_AttributeInfo AttributeInfoPoint;
@@ -732,8 +874,8 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 	AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
 	AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
 
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-		FHoudiniEngine::Get().GetSession(), NodeId, 0,
+	HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
+		NodeId, 0,
 		HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint), false);
 
 	// Grab the build scale
@@ -756,8 +898,7 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 		}
 
 		// Now that we have raw positions, we can upload them for our attribute.
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 			NodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
 			StaticMeshVertices.GetData(), 0, AttributeInfoPoint.count), false);
 	}
@@ -802,12 +943,10 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
 			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId,	0, TCHAR_TO_ANSI(*UVAttributeName), &AttributeInfoVertex), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 				NodeId, 0, TCHAR_TO_ANSI(*UVAttributeName), 
 				&AttributeInfoVertex, (const float *)StaticMeshUVs.GetData(),
 				0, AttributeInfoVertex.count), false);
@@ -846,12 +985,10 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 		AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
 		AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 			NodeId,	0, HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoVertex), false);
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 			NodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL,
 			&AttributeInfoVertex, (const float *)ChangedNormals.GetData(),
 			0, AttributeInfoVertex.count), false);
@@ -889,12 +1026,10 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 		AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
 		AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 			NodeId,	0, HAPI_UNREAL_ATTRIB_TANGENTU, &AttributeInfoVertex), false);
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 			NodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTU, &AttributeInfoVertex,
 			(const float *)ChangedTangentU.GetData(), 0, AttributeInfoVertex.count), false);
 	}
@@ -929,12 +1064,10 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 		AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
 		AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-			FHoudiniEngine::Get().GetSession(), 
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 			NodeId,	0, HAPI_UNREAL_ATTRIB_TANGENTV, &AttributeInfoVertex), false);
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 			NodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTV, &AttributeInfoVertex,
 			(const float *)ChangedTangentV.GetData(), 0, AttributeInfoVertex.count), false);
 	}
@@ -1022,12 +1155,10 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
 			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId,	0, HAPI_UNREAL_ATTRIB_COLOR, &AttributeInfoVertex), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_COLOR, &AttributeInfoVertex,
 				ColorValues.GetData(), 0, AttributeInfoVertex.count), false);
 
@@ -1045,12 +1176,10 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
 			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId,	0, HAPI_UNREAL_ATTRIB_ALPHA, &AttributeInfoVertex), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_ALPHA, &AttributeInfoVertex,
 				AlphaValues.GetData(), 0, AttributeInfoVertex.count), false);
 		}
@@ -1074,15 +1203,13 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 		}
 
 		// We can now set vertex list.
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetVertexList(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetVertexList(
 			NodeId,	0, StaticMeshIndices.GetData(), 0, StaticMeshIndices.Num()), false);
 
 		// We need to generate array of face counts.
 		TArray< int32 > StaticMeshFaceCounts;
 		StaticMeshFaceCounts.Init(3, Part.faceCount);
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetFaceCounts(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetFaceCounts(
 			NodeId,	0, StaticMeshFaceCounts.GetData(), 0, StaticMeshFaceCounts.Num()), false);
 	}
 
@@ -1186,7 +1313,8 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 				StaticMeshFaceMaterials,
 				ScalarMaterialParameters,
 				VectorMaterialParameters,
-				TextureMaterialParameters);
+				TextureMaterialParameters,
+				&GeoWriter);
 		}
 		else
 		{
@@ -1203,7 +1331,8 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 				StaticMeshFaceMaterials,
 				ScalarMaterialParameters,
 				VectorMaterialParameters,
-				TextureMaterialParameters);
+				TextureMaterialParameters,
+				&GeoWriter);
 		}
 
 		// Delete material names.
@@ -1237,12 +1366,10 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 		AttributeInfoSmoothingMasks.storage = HAPI_STORAGETYPE_INT;
 		AttributeInfoSmoothingMasks.originalOwner = HAPI_ATTROWNER_INVALID;
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-			FHoudiniEngine::Get().GetSession(), 
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 			NodeId,	0, HAPI_UNREAL_ATTRIB_FACE_SMOOTHING_MASK, &AttributeInfoSmoothingMasks), false);
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeIntData(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeIntData(
 			NodeId, 0, HAPI_UNREAL_ATTRIB_FACE_SMOOTHING_MASK, &AttributeInfoSmoothingMasks,
 			(const int32 *)RawMesh.FaceSmoothingMasks.GetData(), 0, RawMesh.FaceSmoothingMasks.Num()), false);
 	}
@@ -1268,12 +1395,10 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 		AttributeInfoLightMapResolution.storage = HAPI_STORAGETYPE_INT;
 		AttributeInfoLightMapResolution.originalOwner = HAPI_ATTROWNER_INVALID;
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 			NodeId, 0, HAPI_UNREAL_ATTRIB_LIGHTMAP_RESOLUTION, &AttributeInfoLightMapResolution), false);
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeIntData(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeIntData(
 			NodeId, 0, HAPI_UNREAL_ATTRIB_LIGHTMAP_RESOLUTION, &AttributeInfoLightMapResolution,
 			(const int32 *)LightMapResolutions.GetData(), 0, LightMapResolutions.Num()), false);
 	}
@@ -1302,12 +1427,10 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 		AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
 		AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
 
-		HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-			FHoudiniEngine::Get().GetSession(), 
+		HOUDINI_CHECK_ERROR_RETURN( GeoWriter.AddAttribute(
 			NodeId,	0, HAPI_UNREAL_ATTRIB_INPUT_MESH_NAME, &AttributeInfo), false);
 
-		HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeStringData(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN( GeoWriter.SetAttributeStringData(
 			NodeId, 0, HAPI_UNREAL_ATTRIB_INPUT_MESH_NAME, &AttributeInfo,
 			PrimitiveAttrs.GetData(), 0, PrimitiveAttrs.Num()), false);
 	}
@@ -1347,12 +1470,10 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 			AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
 			AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId,	0, HAPI_UNREAL_ATTRIB_INPUT_SOURCE_FILE, &AttributeInfo), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeStringData(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeStringData(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_INPUT_SOURCE_FILE, &AttributeInfo,
 				PrimitiveAttrs.GetData(), 0, PrimitiveAttrs.Num()), false);
 		}
@@ -1386,15 +1507,13 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 		}
 
 		// Add a LOD group
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddGroup(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddGroup(
 			NodeId, 0, HAPI_GROUPTYPE_PRIM, LODGroupStr), false);
 
 		// Set GroupMembership
 		TArray<int> GroupArray;
 		GroupArray.Init(1, Part.faceCount);
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetGroupMembership(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetGroupMembership(
 			NodeId, 0, HAPI_GROUPTYPE_PRIM, LODGroupStr,
 			GroupArray.GetData(), 0, Part.faceCount), false);
 
@@ -1414,15 +1533,14 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 			AttributeInfoLODScreenSize.storage = HAPI_STORAGETYPE_FLOAT;
 			AttributeInfoLODScreenSize.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId, 0, TCHAR_TO_UTF8(*LODAttributeName), &AttributeInfoLODScreenSize), false);
 
 			// TODO: FIX?
 			// Get the actual screensize instead of the src model default?
 			float lodscreensize = SourceModel.ScreenSize.Default;
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(), NodeId, 0,
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
+				NodeId, 0,
 				TCHAR_TO_UTF8(*LODAttributeName), &AttributeInfoLODScreenSize,
 				&lodscreensize, 0, 1), false);
 		}
@@ -1445,16 +1563,16 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 		}
 
 		// Try to create groups for the tags
-		if (!FHoudiniEngineUtils::CreateGroupsFromTags(NodeId, 0, AllTags))
+		if (!FHoudiniEngineUtils::CreateGroupsFromTags(NodeId, 0, AllTags, &GeoWriter))
 			HOUDINI_LOG_WARNING(TEXT("Could not create groups for the Static Mesh Component and Actor tags!"));
 
 		if (ParentActor && !ParentActor->IsPendingKill())
 		{
 			// Add the unreal_actor_path attribute
-			FHoudiniEngineUtils::AddActorPathAttribute(NodeId, 0, ParentActor, Part.faceCount);
+			FHoudiniEngineUtils::AddActorPathAttribute(NodeId, 0, ParentActor, Part.faceCount, &GeoWriter);
 
 			// Add the unreal_level_path attribute
-			FHoudiniEngineUtils::AddLevelPathAttribute(NodeId, 0, ParentActor->GetLevel(), Part.faceCount);
+			FHoudiniEngineUtils::AddLevelPathAttribute(NodeId, 0, ParentActor->GetLevel(), Part.faceCount, &GeoWriter);
 			/*
 			if (ULevel* Level = ParentActor->GetLevel())
 			{
@@ -1472,8 +1590,8 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 	}
 
 	// Commit the geo.
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-		FHoudiniEngine::Get().GetSession(), NodeId), false);
+	HOUDINI_CHECK_ERROR_RETURN(GeoWriter.CommitGeo(
+		NodeId), false);
 
 	return true;
 }
@@ -1486,7 +1604,8 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 	const int32& InLODIndex,
 	const bool& bAddLODGroups,
 	UStaticMesh* StaticMesh,
-	UStaticMeshComponent* StaticMeshComponent)
+	UStaticMeshComponent* StaticMeshComponent,
+	FHoudiniGeoWriter* InGeoWriter /* = nullptr */)
 {
 	// Convert the Mesh using FStaticMeshLODResources
 
@@ -1551,6 +1670,11 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 	StaticMeshVertices.Shrink();
 	const uint32 NumVertices = StaticMeshVertices.Num() / 3;
 
+	// Either sends the geometry with individual HAPI calls, or buffers it and sends it in one LoadGeoFromMemory call
+	// When a writer is provided, the geometry is only written to it
+	FHoudiniGeoWriter LocalGeoWriter(!InGeoWriter && FHoudiniGeoWriter::ShouldBufferMeshInputs());
+	FHoudiniGeoWriter& GeoWriter = InGeoWriter ? *InGeoWriter : LocalGeoWriter;
+
 	// Now that we know how many vertices (points), vertex instances (vertices) and triagnles we have,
 	// we can create the part.
 	HAPI_PartInfo Part;
@@ -1567,8 +1691,8 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 	Part.pointCount = NumVertices;
 	Part.type = HAPI_PARTTYPE_MESH;
 
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPartInfo(
-		FHoudiniEngine::Get().GetSession(), NodeId, 0, &Part), false);
+	HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetPartInfo(
+		NodeId, 0, &Part), false);
 
 	// Create point attribute info.
 	HAPI_AttributeInfo AttributeInfoPoint;
@@ -1581,13 +1705,12 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 	AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
 	AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
 
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-		FHoudiniEngine::Get().GetSession(), NodeId, 0,
+	HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
+		NodeId, 0,
 		HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint), false);
 
 	// Now that we have raw positions, we can upload them for our attribute.
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-		FHoudiniEngine::Get().GetSession(),
+	HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 		NodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
 		StaticMeshVertices.GetData(), 0, AttributeInfoPoint.count), false);
 
@@ -1881,12 +2004,10 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 				AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
 				AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-					FHoudiniEngine::Get().GetSession(),
+				HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 					NodeId, 0, TCHAR_TO_ANSI(*UVAttributeName), &AttributeInfoVertex), false);
 
-				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-					FHoudiniEngine::Get().GetSession(),
+				HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 					NodeId, 0, TCHAR_TO_ANSI(*UVAttributeName),
 					&AttributeInfoVertex, UVs[UVLayerIndex].GetData(),
 					0, AttributeInfoVertex.count), false);
@@ -1909,12 +2030,10 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
 			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoVertex), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL,
 				&AttributeInfoVertex, Normals.GetData(),
 				0, AttributeInfoVertex.count), false);
@@ -1936,12 +2055,10 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
 			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTU, &AttributeInfoVertex), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTU, &AttributeInfoVertex,
 				Tangents.GetData(), 0, AttributeInfoVertex.count), false);
 		}
@@ -1962,12 +2079,10 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
 			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTV, &AttributeInfoVertex), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTV, &AttributeInfoVertex,
 				Binormals.GetData(), 0, AttributeInfoVertex.count), false);
 		}
@@ -1988,12 +2103,10 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
 			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_COLOR, &AttributeInfoVertex), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_COLOR, &AttributeInfoVertex,
 				RGBColors.GetData(), 0, AttributeInfoVertex.count), false);
 
@@ -2005,12 +2118,10 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
 			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_ALPHA, &AttributeInfoVertex), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_ALPHA, &AttributeInfoVertex,
 				Alphas.GetData(), 0, AttributeInfoVertex.count), false);
 		}
@@ -2019,15 +2130,13 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 		// TRIANGLE/FACE VERTEX INDICES
 		//---------------------------------------------------------------------------------------------------------------------
 		// We can now set vertex list.
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetVertexList(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetVertexList(
 			NodeId, 0, MeshTriangleVertexIndices.GetData(), 0, MeshTriangleVertexIndices.Num()), false);
 
 		// Send the array of face vertex counts.
 		TArray< int32 > StaticMeshFaceCounts;
 		StaticMeshFaceCounts.Init(3, Part.faceCount);
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetFaceCounts(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetFaceCounts(
 			NodeId, 0, MeshTriangleVertexCounts.GetData(), 0, MeshTriangleVertexCounts.Num()), false);
 
 		// Send material assignments to Houdini
@@ -2060,7 +2169,8 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 					TriangleMaterials,
 					ScalarMaterialParameters,
 					VectorMaterialParameters,
-					TextureMaterialParameters);
+					TextureMaterialParameters,
+					&GeoWriter);
 			}
 			else
 			{
@@ -2077,7 +2187,8 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 					TriangleMaterials,
 					ScalarMaterialParameters,
 					VectorMaterialParameters,
-					TextureMaterialParameters);
+					TextureMaterialParameters,
+					&GeoWriter);
 			}
 
 			// Delete material names.
@@ -2148,12 +2259,10 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 		AttributeInfoLightMapResolution.storage = HAPI_STORAGETYPE_INT;
 		AttributeInfoLightMapResolution.originalOwner = HAPI_ATTROWNER_INVALID;
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 			NodeId, 0, HAPI_UNREAL_ATTRIB_LIGHTMAP_RESOLUTION, &AttributeInfoLightMapResolution), false);
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeIntData(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeIntData(
 			NodeId, 0, HAPI_UNREAL_ATTRIB_LIGHTMAP_RESOLUTION, &AttributeInfoLightMapResolution,
 			(const int32 *)LightMapResolutions.GetData(), 0, LightMapResolutions.Num()), false);
 	}
@@ -2182,12 +2291,10 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 		AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
 		AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 			NodeId, 0, HAPI_UNREAL_ATTRIB_INPUT_MESH_NAME, &AttributeInfo), false);
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeStringData(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeStringData(
 			NodeId, 0, HAPI_UNREAL_ATTRIB_INPUT_MESH_NAME, &AttributeInfo,
 			PrimitiveAttrs.GetData(), 0, PrimitiveAttrs.Num()), false);
 	}
@@ -2227,12 +2334,10 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 			AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
 			AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_INPUT_SOURCE_FILE, &AttributeInfo), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeStringData(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeStringData(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_INPUT_SOURCE_FILE, &AttributeInfo,
 				PrimitiveAttrs.GetData(), 0, PrimitiveAttrs.Num()), false);
 		}
@@ -2266,15 +2371,13 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 		}
 
 		// Add a LOD group
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddGroup(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddGroup(
 			NodeId, 0, HAPI_GROUPTYPE_PRIM, LODGroupStr), false);
 
 		// Set GroupMembership
 		TArray<int> GroupArray;
 		GroupArray.Init(1, Part.faceCount);
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetGroupMembership(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetGroupMembership(
 			NodeId, 0, HAPI_GROUPTYPE_PRIM, LODGroupStr,
 			GroupArray.GetData(), 0, Part.faceCount), false);
 
@@ -2294,15 +2397,14 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 			AttributeInfoLODScreenSize.storage = HAPI_STORAGETYPE_FLOAT;
 			AttributeInfoLODScreenSize.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId, 0, TCHAR_TO_UTF8(*LODAttributeName), &AttributeInfoLODScreenSize), false);
 
 			// TODO: FIX?
 			// Get the actual screensize instead of the src model default?
 			float lodscreensize = SourceModel.ScreenSize.Default;
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(), NodeId, 0,
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
+				NodeId, 0,
 				TCHAR_TO_UTF8(*LODAttributeName), &AttributeInfoLODScreenSize,
 				&lodscreensize, 0, 1), false);
 		}
@@ -2315,7 +2417,7 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 	{
 		// Try to create groups for the static mesh component's tags
 		if (StaticMeshComponent->ComponentTags.Num() > 0
-			&& !FHoudiniEngineUtils::CreateGroupsFromTags(NodeId, 0, StaticMeshComponent->ComponentTags))
+			&& !FHoudiniEngineUtils::CreateGroupsFromTags(NodeId, 0, StaticMeshComponent->ComponentTags, &GeoWriter))
 			HOUDINI_LOG_WARNING(TEXT("Could not create groups from the Static Mesh Component's tags!"));
 
 		AActor* ParentActor = StaticMeshComponent->GetOwner();
@@ -2323,14 +2425,14 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 		{
 			// Try to create groups for the parent Actor's tags
 			if (ParentActor->Tags.Num() > 0
-				&& !FHoudiniEngineUtils::CreateGroupsFromTags(NodeId, 0, ParentActor->Tags))
+				&& !FHoudiniEngineUtils::CreateGroupsFromTags(NodeId, 0, ParentActor->Tags, &GeoWriter))
 				HOUDINI_LOG_WARNING(TEXT("Could not create groups from the Static Mesh Component's parent actor tags!"));
 
 			// Add the unreal_actor_path attribute
-			FHoudiniEngineUtils::AddActorPathAttribute(NodeId, 0, ParentActor, Part.faceCount);
+			FHoudiniEngineUtils::AddActorPathAttribute(NodeId, 0, ParentActor, Part.faceCount, &GeoWriter);
 
 			// Add the unreal_level_path attribute
-			FHoudiniEngineUtils::AddLevelPathAttribute(NodeId, 0, ParentActor->GetLevel(), Part.faceCount);
+			FHoudiniEngineUtils::AddLevelPathAttribute(NodeId, 0, ParentActor->GetLevel(), Part.faceCount, &GeoWriter);
 
 			/*
 			// Add the unreal_level_path attribute
@@ -2351,8 +2453,8 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 	}
 
 	// Commit the geo.
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-		FHoudiniEngine::Get().GetSession(), NodeId), false);
+	HOUDINI_CHECK_ERROR_RETURN(GeoWriter.CommitGeo(
+		NodeId), false);
 
 	return true;
 }
@@ -2407,6 +2509,9 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 	const bool bIsVertexInstanceUVsValid = VertexInstanceUVs.IsValid();
 	//const bool bIsPolygonGroupImportedMaterialSlotNamesValid = PolygonGroupMaterialSlotNames.IsValid();
 
+	// Either sends the geometry with individual HAPI calls, or buffers it and sends it in one LoadGeoFromMemory call
+	FHoudiniGeoWriter GeoWriter(FHoudiniGeoWriter::ShouldBufferMeshInputs());
+
 	// Create part.
 	HAPI_PartInfo Part;
 	FHoudiniApi::PartInfo_Init(&Part);
@@ -2422,8 +2527,8 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 	Part.pointCount = NumVertices;
 	Part.type = HAPI_PARTTYPE_MESH;
 
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPartInfo(
-		FHoudiniEngine::Get().GetSession(), NodeId, 0, &Part), false);
+	HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetPartInfo(
+		NodeId, 0, &Part), false);
 
 	// Create point attribute info.
 	HAPI_AttributeInfo AttributeInfoPoint;
@@ -2436,8 +2541,8 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 	AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
 	AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
 
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-		FHoudiniEngine::Get().GetSession(), NodeId, 0,
+	HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
+		NodeId, 0,
 		HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint), false);
 
 	// Grab the build scale
@@ -2472,8 +2577,7 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 		}
 
 		// Now that we have raw positions, we can upload them for our attribute.
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 			NodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
 			StaticMeshVertices.GetData(), 0, AttributeInfoPoint.count), false);
 	}
@@ -2824,12 +2928,10 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 				AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
 				AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-					FHoudiniEngine::Get().GetSession(),
+				HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 					NodeId, 0, TCHAR_TO_ANSI(*UVAttributeName), &AttributeInfoVertex), false);
 
-				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-					FHoudiniEngine::Get().GetSession(),
+				HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 					NodeId, 0, TCHAR_TO_ANSI(*UVAttributeName),
 					&AttributeInfoVertex, UVs[UVLayerIndex].GetData(),
 					0, AttributeInfoVertex.count), false);
@@ -2852,12 +2954,10 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
 			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoVertex), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL,
 				&AttributeInfoVertex, Normals.GetData(),
 				0, AttributeInfoVertex.count), false);
@@ -2879,12 +2979,10 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
 			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTU, &AttributeInfoVertex), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTU, &AttributeInfoVertex,
 				Tangents.GetData(), 0, AttributeInfoVertex.count), false);
 		}
@@ -2905,12 +3003,10 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
 			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTV, &AttributeInfoVertex), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTV, &AttributeInfoVertex,
 				Binormals.GetData(), 0, AttributeInfoVertex.count), false);
 		}
@@ -2931,12 +3027,10 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
 			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_COLOR, &AttributeInfoVertex), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_COLOR, &AttributeInfoVertex,
 				RGBColors.GetData(), 0, AttributeInfoVertex.count), false);
 
@@ -2948,12 +3042,10 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
 			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_ALPHA, &AttributeInfoVertex), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_ALPHA, &AttributeInfoVertex,
 				Alphas.GetData(), 0, AttributeInfoVertex.count), false);
 		}
@@ -2962,15 +3054,13 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 		// TRIANGLE/FACE VERTEX INDICES
 		//---------------------------------------------------------------------------------------------------------------------
 		// We can now set vertex list.
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetVertexList(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetVertexList(
 			NodeId, 0, MeshTriangleVertexIndices.GetData(), 0, MeshTriangleVertexIndices.Num()), false);
 
 		// Send the array of face vertex counts.
 		TArray< int32 > StaticMeshFaceCounts;
 		StaticMeshFaceCounts.Init(3, Part.faceCount);
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetFaceCounts(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetFaceCounts(
 			NodeId, 0, MeshTriangleVertexCounts.GetData(), 0, MeshTriangleVertexCounts.Num()), false);
 
 		// Send material assignments to Houdini
@@ -3003,7 +3093,8 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 					TriangleMaterials,
 					ScalarMaterialParameters,
 					VectorMaterialParameters,
-					TextureMaterialParameters);
+					TextureMaterialParameters,
+					&GeoWriter);
 			}
 			else
 			{
@@ -3020,7 +3111,8 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 					TriangleMaterials,
 					ScalarMaterialParameters,
 					VectorMaterialParameters,
-					TextureMaterialParameters);
+					TextureMaterialParameters,
+					&GeoWriter);
 			}
 
 			// Delete material names.
@@ -3057,12 +3149,10 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 			AttributeInfoSmoothingMasks.storage = HAPI_STORAGETYPE_INT;
 			AttributeInfoSmoothingMasks.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_FACE_SMOOTHING_MASK, &AttributeInfoSmoothingMasks), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeIntData(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeIntData(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_FACE_SMOOTHING_MASK, &AttributeInfoSmoothingMasks,
 				(const int32 *)TriangleSmoothingMasks.GetData(), 0, TriangleSmoothingMasks.Num()), false);
 		}
@@ -3089,12 +3179,10 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 		AttributeInfoLightMapResolution.storage = HAPI_STORAGETYPE_INT;
 		AttributeInfoLightMapResolution.originalOwner = HAPI_ATTROWNER_INVALID;
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 			NodeId, 0, HAPI_UNREAL_ATTRIB_LIGHTMAP_RESOLUTION, &AttributeInfoLightMapResolution), false);
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeIntData(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeIntData(
 			NodeId, 0, HAPI_UNREAL_ATTRIB_LIGHTMAP_RESOLUTION, &AttributeInfoLightMapResolution,
 			(const int32 *)LightMapResolutions.GetData(), 0, LightMapResolutions.Num()), false);
 	}
@@ -3123,12 +3211,10 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 		AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
 		AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 			NodeId, 0, HAPI_UNREAL_ATTRIB_INPUT_MESH_NAME, &AttributeInfo), false);
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeStringData(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeStringData(
 			NodeId, 0, HAPI_UNREAL_ATTRIB_INPUT_MESH_NAME, &AttributeInfo,
 			PrimitiveAttrs.GetData(), 0, PrimitiveAttrs.Num()), false);
 	}
@@ -3168,12 +3254,10 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 			AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
 			AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_INPUT_SOURCE_FILE, &AttributeInfo), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeStringData(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeStringData(
 				NodeId, 0, HAPI_UNREAL_ATTRIB_INPUT_SOURCE_FILE, &AttributeInfo,
 				PrimitiveAttrs.GetData(), 0, PrimitiveAttrs.Num()), false);
 		}
@@ -3207,15 +3291,13 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 		}
 
 		// Add a LOD group
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddGroup(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddGroup(
 			NodeId, 0, HAPI_GROUPTYPE_PRIM, LODGroupStr), false);
 
 		// Set GroupMembership
 		TArray<int> GroupArray;
 		GroupArray.Init(1, Part.faceCount);
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetGroupMembership(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetGroupMembership(
 			NodeId, 0, HAPI_GROUPTYPE_PRIM, LODGroupStr,
 			GroupArray.GetData(), 0, Part.faceCount), false);
 
@@ -3235,15 +3317,14 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 			AttributeInfoLODScreenSize.storage = HAPI_STORAGETYPE_FLOAT;
 			AttributeInfoLODScreenSize.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.AddAttribute(
 				NodeId, 0, TCHAR_TO_UTF8(*LODAttributeName), &AttributeInfoLODScreenSize), false);
 
 			// TODO: FIX?
 			// Get the actual screensize instead of the src model default?
 			float lodscreensize = SourceModel.ScreenSize.Default;
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(), NodeId, 0,
+			HOUDINI_CHECK_ERROR_RETURN(GeoWriter.SetAttributeFloatData(
+				NodeId, 0,
 				TCHAR_TO_UTF8(*LODAttributeName), &AttributeInfoLODScreenSize,
 				&lodscreensize, 0, 1), false);
 		}
@@ -3256,7 +3337,7 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 	{
 		// Try to create groups for the static mesh component's tags
 		if (StaticMeshComponent->ComponentTags.Num() > 0
-			&& !FHoudiniEngineUtils::CreateGroupsFromTags(NodeId, 0, StaticMeshComponent->ComponentTags))
+			&& !FHoudiniEngineUtils::CreateGroupsFromTags(NodeId, 0, StaticMeshComponent->ComponentTags, &GeoWriter))
 			HOUDINI_LOG_WARNING(TEXT("Could not create groups from the Static Mesh Component's tags!"));
 
 		AActor* ParentActor = StaticMeshComponent->GetOwner();
@@ -3264,14 +3345,14 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 		{
 			// Try to create groups for the parent Actor's tags
 			if (ParentActor->Tags.Num() > 0
-				&& !FHoudiniEngineUtils::CreateGroupsFromTags(NodeId, 0, ParentActor->Tags))
+				&& !FHoudiniEngineUtils::CreateGroupsFromTags(NodeId, 0, ParentActor->Tags, &GeoWriter))
 				HOUDINI_LOG_WARNING(TEXT("Could not create groups from the Static Mesh Component's parent actor tags!"));
 
 			// Add the unreal_actor_path attribute
-			FHoudiniEngineUtils::AddActorPathAttribute(NodeId, 0, ParentActor, Part.faceCount);
+			FHoudiniEngineUtils::AddActorPathAttribute(NodeId, 0, ParentActor, Part.faceCount, &GeoWriter);
 
 			// Add the unreal_level_path attribute
-			FHoudiniEngineUtils::AddLevelPathAttribute(NodeId, 0, ParentActor->GetLevel(), Part.faceCount);
+			FHoudiniEngineUtils::AddLevelPathAttribute(NodeId, 0, ParentActor->GetLevel(), Part.faceCount, &GeoWriter);
 
 			/*
 			FString LevelPath = FString();
@@ -3294,8 +3375,8 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 	}
 
 	// Commit the geo.
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-		FHoudiniEngine::Get().GetSession(), NodeId), false);
+	HOUDINI_CHECK_ERROR_RETURN(GeoWriter.CommitGeo(
+		NodeId), false);
 
 	return true;
 }
@@ -4054,11 +4135,16 @@ FUnrealMeshTranslator::CreateHoudiniMeshAttributes(
 	const TArray<char *> & TriangleMaterials,
 	const TMap<FString, TArray<float>> & ScalarMaterialParameters,
 	const TMap<FString, TArray<float>> & VectorMaterialParameters,
-	const TMap<FString, TArray<char *>> & TextureMaterialParameters) 
+	const TMap<FString, TArray<char *>> & TextureMaterialParameters,
+	FHoudiniGeoWriter* InGeoWriter /* = nullptr */)
 {
-	if (NodeId < 0)
+	// Buffered writers don't need the node yet
+	if (NodeId < 0 && !(InGeoWriter && InGeoWriter->IsBuffered()))
 		return false;
 
+	FHoudiniGeoWriter DirectGeoWriter(false);
+	FHoudiniGeoWriter& GeoWriter = InGeoWriter ? *InGeoWriter : DirectGeoWriter;
+
 	bool bSuccess = true;
 
 	// Create attribute for materials.
@@ -4072,13 +4158,11 @@ FUnrealMeshTranslator::CreateHoudiniMeshAttributes(
 	AttributeInfoMaterial.originalOwner = HAPI_ATTROWNER_INVALID;
 
 	// Create the new attribute
-	if (HAPI_RESULT_SUCCESS == FHoudiniApi::AddAttribute(
-		FHoudiniEngine::Get().GetSession(),
+	if (HAPI_RESULT_SUCCESS == GeoWriter.AddAttribute(
 		NodeId, PartId, HAPI_UNREAL_ATTRIB_MATERIAL, &AttributeInfoMaterial))
 	{
 		// The New attribute has been successfully created, set its value
-		if (HAPI_RESULT_SUCCESS != FHoudiniApi::SetAttributeStringData(
-			FHoudiniEngine::Get().GetSession(),
+		if (HAPI_RESULT_SUCCESS != GeoWriter.SetAttributeStringData(
 			NodeId, PartId, HAPI_UNREAL_ATTRIB_MATERIAL, &AttributeInfoMaterial,
 			(const char **)TriangleMaterials.GetData(), PartId, TriangleMaterials.Num()))
 		{
@@ -4103,13 +4187,11 @@ FUnrealMeshTranslator::CreateHoudiniMeshAttributes(
 		AttributeInfoMaterialParameter.originalOwner = HAPI_ATTROWNER_INVALID;
 
 		// Create the new attribute
-		if (HAPI_RESULT_SUCCESS == FHoudiniApi::AddAttribute(
-			FHoudiniEngine::Get().GetSession(),
+		if (HAPI_RESULT_SUCCESS == GeoWriter.AddAttribute(
 			NodeId, PartId, CurMaterialParamAttriNameRawStr, &AttributeInfoMaterialParameter))
 		{
 			// The New attribute has been successfully created, set its value
-			if (HAPI_RESULT_SUCCESS != FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(),
+			if (HAPI_RESULT_SUCCESS != GeoWriter.SetAttributeFloatData(
 				NodeId, PartId, CurMaterialParamAttriNameRawStr, &AttributeInfoMaterialParameter,
 				Pair.Value.GetData(), PartId, TriangleMaterials.Num()))
 			{
@@ -4134,12 +4216,10 @@ FUnrealMeshTranslator::CreateHoudiniMeshAttributes(
 		AttributeInfoMaterialParameter.storage = HAPI_STORAGETYPE_FLOAT;
 		AttributeInfoMaterialParameter.originalOwner = HAPI_ATTROWNER_INVALID;
 
-		if (HAPI_RESULT_SUCCESS == FHoudiniApi::AddAttribute(FHoudiniEngine::Get().GetSession(),
-			NodeId, PartId, CurMaterialParamAttriNameRawStr, &AttributeInfoMaterialParameter))
+		if (HAPI_RESULT_SUCCESS == GeoWriter.AddAttribute(NodeId, PartId, CurMaterialParamAttriNameRawStr, &AttributeInfoMaterialParameter))
 		{
 			// The New attribute has been successfully created, set its value
-			if (HAPI_RESULT_SUCCESS != FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(),
+			if (HAPI_RESULT_SUCCESS != GeoWriter.SetAttributeFloatData(
 				NodeId, PartId, CurMaterialParamAttriNameRawStr, &AttributeInfoMaterialParameter,
 				Pair.Value.GetData(), PartId, TriangleMaterials.Num()))
 			{
@@ -4164,8 +4244,7 @@ FUnrealMeshTranslator::CreateHoudiniMeshAttributes(
 		AttributeInfoMaterialParameter.storage = HAPI_STORAGETYPE_STRING;
 		AttributeInfoMaterialParameter.originalOwner = HAPI_ATTROWNER_INVALID;
 
-		if (HAPI_RESULT_SUCCESS == FHoudiniApi::AddAttribute(FHoudiniEngine::Get().GetSession(),
-			NodeId, PartId, CurMaterialParamAttriNameRawStr, &AttributeInfoMaterialParameter))
+		if (HAPI_RESULT_SUCCESS == GeoWriter.AddAttribute(NodeId, PartId, CurMaterialParamAttriNameRawStr, &AttributeInfoMaterialParameter))
 		{
 			// Replace null strings by empty strings to prevent crashes when setting the attribute.
 			char* EmptyString = nullptr;
@@ -4185,8 +4264,7 @@ FUnrealMeshTranslator::CreateHoudiniMeshAttributes(
 			}
 
 			// The New attribute has been successfully created, set its value
-			if (HAPI_RESULT_SUCCESS != FHoudiniApi::SetAttributeStringData(
-				FHoudiniEngine::Get().GetSession(),
+			if (HAPI_RESULT_SUCCESS != GeoWriter.SetAttributeStringData(
 				NodeId, PartId, CurMaterialParamAttriNameRawStr, &AttributeInfoMaterialParameter,
 				(const char **)StringData.GetData(), PartId, TriangleMaterials.Num()))
 			{
@@ -40,6 +40,7 @@ struct FStaticMeshSourceModel;
 struct FStaticMeshLODResources;
 struct FMeshDescription;
 struct FKConvexElem;
+struct FHoudiniGeoWriter;
 
 struct HOUDINIENGINE_API FUnrealMeshTranslator
 {
@@ -62,7 +63,17 @@ struct HOUDINIENGINE_API FUnrealMeshTranslator
 			const int32& LODIndex,
 			const bool&	DoExportLODs,
 			UStaticMesh* StaticMesh,
-			UStaticMeshComponent* StaticMeshComponent);
+			UStaticMeshComponent* StaticMeshComponent,
+			FHoudiniGeoWriter* InGeoWriter = nullptr);
+
+		// Converts the given static meshes / static mesh components' LODs in parallel, ahead of their upload.
+		// HapiCreateInputNodeForStaticMesh then only has to send the prepared geometry.
+		static void PrepareStaticMeshInputGeos(
+			const TArray<TPair<UStaticMesh*, UStaticMeshComponent*>>& InMeshes,
+			const bool& bExportAllLODs);
+
+		// Discards the geometry prepared by PrepareStaticMeshInputGeos that hasn't been sent
+		static void ResetPreparedStaticMeshInputGeos();
 
 		// Convert the Mesh using FMeshDescription
 		static bool CreateInputNodeForMeshDescription(
@@ -160,7 +171,8 @@ struct HOUDINIENGINE_API FUnrealMeshTranslator
 			const TArray<char *> & TriangleMaterials,
 			const TMap<FString, TArray<float>> & ScalarMaterialParameters,
 			const TMap<FString, TArray<float>> & VectorMaterialParameters,
-			const TMap<FString, TArray<char *>> & TextureMaterialParameters);
+			const TMap<FString, TArray<char *>> & TextureMaterialParameters,
+			FHoudiniGeoWriter* InGeoWriter = nullptr);
 
 		/*
 		// Creates the unreal_level_path attribute on the input mesh
@@ -31,10 +31,16 @@
 #include "HoudiniEnginePrivatePCH.h"
 
 #include "Components/SplineComponent.h"
+#include "Engine/Level.h"
 #include "HoudiniGeoPartObject.h"
 
 #include "HoudiniSplineTranslator.h"
 
+// Maximum number of times a segment between two control points is halved when sampled adaptively
+#define HOUDINI_SPLINE_MAX_SUBDIVISIONS 8
+// Rotation change (in radians) along a segment above which it is subdivided
+#define HOUDINI_SPLINE_MAX_ANGLE_CHANGE 0.1f
+
 bool
 FUnrealSplineTranslator::CreateInputNodeForSplineComponent(USplineComponent* SplineComponent, const float& SplineResolution, HAPI_NodeId& CreatedInputNodeId, const FString& NodeName) 
 {
@@ -122,3 +128,337 @@ FUnrealSplineTranslator::CreateInputNodeForSplineComponent(USplineComponent* Spl
 
 	return true;
 }
+
+// Adds the distances between InStartDistance and InEndDistance (both excluded) needed
+// for the spline to stay within InTolerance of the straight lines between the samples
+static void
+SubdivideSplineSegment(
+	USplineComponent* SplineComponent, const float& InStartDistance, const float& InEndDistance,
+	const float& InTolerance, const int32& InDepth, TArray<float>& OutDistances)
+{
+	if (InDepth >= HOUDINI_SPLINE_MAX_SUBDIVISIONS)
+		return;
+
+	if ((InEndDistance - InStartDistance) <= InTolerance)
+		return;
+
+	const FVector StartPosition = SplineComponent->GetLocationAtDistanceAlongSpline(InStartDistance, ESplineCoordinateSpace::World);
+	const FVector EndPosition = SplineComponent->GetLocationAtDistanceAlongSpline(InEndDistance, ESplineCoordinateSpace::World);
+
+	// Check the quarter points as well as the middle, so S-shaped segments aren't missed
+	bool bNeedsSubdivision = false;
+	for (int32 n = 1; n < 4 && !bNeedsSubdivision; n++)
+	{
+		const float Distance = FMath::Lerp(InStartDistance, InEndDistance, n * 0.25f);
+		const FVector Position = SplineComponent->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+		if (FMath::PointDistToSegment(Position, StartPosition, EndPosition) > InTolerance)
+			bNeedsSubdivision = true;
+	}
+
+	if (!bNeedsSubdivision)
+	{
+		const FQuat StartRotation = SplineComponent->GetQuaternionAtDistanceAlongSpline(InStartDistance, ESplineCoordinateSpace::World);
+		const FQuat EndRotation = SplineComponent->GetQuaternionAtDistanceAlongSpline(InEndDistance, ESplineCoordinateSpace::World);
+		if (StartRotation.AngularDistance(EndRotation) > HOUDINI_SPLINE_MAX_ANGLE_CHANGE)
+			bNeedsSubdivision = true;
+	}
+
+	if (!bNeedsSubdivision)
+	{
+		const FVector StartScale = SplineComponent->GetScaleAtDistanceAlongSpline(InStartDistance);
+		const FVector EndScale = SplineComponent->GetScaleAtDistanceAlongSpline(InEndDistance);
+		if (!StartScale.Equals(EndScale, 0.01f))
+			bNeedsSubdivision = true;
+	}
+
+	if (!bNeedsSubdivision)
+		return;
+
+	const float MidDistance = (InStartDistance + InEndDistance) * 0.5f;
+	SubdivideSplineSegment(SplineComponent, InStartDistance, MidDistance, InTolerance, InDepth + 1, OutDistances);
+	OutDistances.Add(MidDistance);
+	SubdivideSplineSegment(SplineComponent, MidDistance, InEndDistance, InTolerance, InDepth + 1, OutDistances);
+}
+
+void
+FUnrealSplineTranslator::SampleSplineAdaptively(
+	USplineComponent* SplineComponent, const float& Tolerance, TArray<FVector>& OutPositions, TArray<FQuat>& OutRotations, TArray<FVector>& OutScales)
+{
+	OutPositions.Empty();
+	OutRotations.Empty();
+	OutScales.Empty();
+
+	if (!SplineComponent || SplineComponent->IsPendingKill())
+		return;
+
+	int32 NumberOfControlPoints = SplineComponent->GetNumberOfSplinePoints();
+	if (NumberOfControlPoints < 1)
+		return;
+
+	// Closed loops have an extra segment going back to the first point
+	const bool bClosed = SplineComponent->IsClosedLoop();
+	const int32 NumberOfSegments = bClosed ? NumberOfControlPoints : NumberOfControlPoints - 1;
+	const float SplineLength = SplineComponent->GetSplineLength();
+
+	TArray<float> Distances;
+	Distances.Reserve(NumberOfControlPoints + 1);
+	Distances.Add(0.0f);
+	for (int32 n = 0; n < NumberOfSegments; n++)
+	{
+		const float StartDistance = SplineComponent->GetDistanceAlongSplineAtSplinePoint(n);
+		const float EndDistance = (n + 1 < NumberOfControlPoints) ? SplineComponent->GetDistanceAlongSplineAtSplinePoint(n + 1) : SplineLength;
+
+		SubdivideSplineSegment(SplineComponent, StartDistance, EndDistance, FMath::Max(Tolerance, KINDA_SMALL_NUMBER), 0, Distances);
+		Distances.Add(EndDistance);
+	}
+
+	OutPositions.SetNumUninitialized(Distances.Num());
+	OutRotations.SetNumUninitialized(Distances.Num());
+	OutScales.SetNumUninitialized(Distances.Num());
+	for (int32 n = 0; n < Distances.Num(); n++)
+	{
+		OutPositions[n] = SplineComponent->GetLocationAtDistanceAlongSpline(Distances[n], ESplineCoordinateSpace::World);
+		OutRotations[n] = SplineComponent->GetQuaternionAtDistanceAlongSpline(Distances[n], ESplineCoordinateSpace::World);
+		OutScales[n] = SplineComponent->GetScaleAtDistanceAlongSpline(Distances[n]);
+	}
+}
+
+bool
+FUnrealSplineTranslator::CreateInputNodeForSplineComponents(
+	const TArray<USplineComponent*>& SplineComponents, const float& SplineResolution, const float& Tolerance, HAPI_NodeId& CreatedInputNodeId, const FString& NodeName)
+{
+	// Sample all the splines, in world space
+	TArray<float> Positions;
+	TArray<float> Rotations;
+	TArray<float> Scales;
+	TArray<int32> CurveCounts;
+	TArray<FString> ActorPaths;
+	TArray<FString> LevelPaths;
+	TArray<FString> ComponentPaths;
+	TMap<FName, TArray<int32>> TagGroups;
+
+	TArray<FVector> SplinePositions;
+	TArray<FQuat> SplineRotations;
+	TArray<FVector> SplineScales;
+	for (USplineComponent* SplineComponent : SplineComponents)
+	{
+		if (!SplineComponent || SplineComponent->IsPendingKill())
+			continue;
+
+		if (SplineResolution > 0.0f)
+		{
+			SampleSplineAdaptively(SplineComponent, Tolerance, SplinePositions, SplineRotations, SplineScales);
+		}
+		else
+		{
+			// Only export the control points
+			int32 NumberOfControlPoints = SplineComponent->GetNumberOfSplinePoints();
+			SplinePositions.SetNumUninitialized(NumberOfControlPoints);
+			SplineRotations.SetNumUninitialized(NumberOfControlPoints);
+			SplineScales.SetNumUninitialized(NumberOfControlPoints);
+			for (int32 n = 0; n < NumberOfControlPoints; ++n)
+			{
+				SplinePositions[n] = SplineComponent->GetLocationAtSplinePoint(n, ESplineCoordinateSpace::World);
+				SplineRotations[n] = SplineComponent->GetQuaternionAtSplinePoint(n, ESplineCoordinateSpace::World);
+				SplineScales[n] = SplineComponent->GetScaleAtSplinePoint(n);
+			}
+
+			if (SplineComponent->IsClosedLoop() && NumberOfControlPoints > 0)
+			{
+				SplinePositions.Add(SplinePositions[0]);
+				SplineRotations.Add(SplineRotations[0]);
+				SplineScales.Add(SplineScales[0]);
+			}
+		}
+
+		// We need at least 2 points to make a curve
+		if (SplinePositions.Num() < 2)
+			continue;
+
+		for (int32 n = 0; n < SplinePositions.Num(); n++)
+		{
+			// Convert Unreal Position/Rotation/Scale to Houdini
+			const FVector& Position = SplinePositions[n];
+			Positions.Add(Position.X / HAPI_UNREAL_SCALE_FACTOR_POSITION);
+			Positions.Add(Position.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION);
+			Positions.Add(Position.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION);
+
+			const FQuat& Rotation = SplineRotations[n];
+			Rotations.Add(Rotation.X);
+			Rotations.Add(Rotation.Z);
+			Rotations.Add(Rotation.Y);
+			Rotations.Add(-Rotation.W);
+
+			const FVector& Scale = SplineScales[n];
+			Scales.Add(Scale.X);
+			Scales.Add(Scale.Z);
+			Scales.Add(Scale.Y);
+		}
+
+		const int32 CurveIdx = CurveCounts.Add(SplinePositions.Num());
+
+		ComponentPaths.Add(SplineComponent->GetPathName());
+		AActor* ParentActor = SplineComponent->GetOwner();
+		ActorPaths.Add(ParentActor ? ParentActor->GetPathName() : FString());
+		LevelPaths.Add((ParentActor && ParentActor->GetLevel()) ? ParentActor->GetLevel()->GetPathName() : FString());
+
+		// The spline component and its actor's tags are converted to primitive groups
+		TArray<FName> Tags = SplineComponent->ComponentTags;
+		if (ParentActor)
+			Tags.Append(ParentActor->Tags);
+
+		for (const FName& Tag : Tags)
+		{
+			TArray<int32>& GroupMembership = TagGroups.FindOrAdd(Tag);
+			GroupMembership.SetNumZeroed(CurveIdx + 1);
+			GroupMembership[CurveIdx] = 1;
+		}
+	}
+
+	const int32 NumberOfCurves = CurveCounts.Num();
+	const int32 NumberOfPoints = Positions.Num() / 3;
+	if (NumberOfCurves < 1)
+		return true;
+
+	// Create a new input node
+	HAPI_NodeId InputNodeId = -1;
+	std::string NodeNameRawString;
+	FHoudiniEngineUtils::ConvertUnrealString(NodeName, NodeNameRawString);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateInputNode(
+		FHoudiniEngine::Get().GetSession(), &InputNodeId, NodeNameRawString.c_str()), false);
+
+	if (!FHoudiniEngineUtils::IsHoudiniNodeValid(InputNodeId))
+		return false;
+
+	CreatedInputNodeId = InputNodeId;
+
+	// Create a curve part with one linear curve per spline
+	HAPI_PartInfo Part;
+	FHoudiniApi::PartInfo_Init(&Part);
+	Part.id = 0;
+	Part.nameSH = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_POINT] = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_PRIM] = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_VERTEX] = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_DETAIL] = 0;
+	Part.vertexCount = NumberOfPoints;
+	Part.faceCount = NumberOfCurves;
+	Part.pointCount = NumberOfPoints;
+	Part.type = HAPI_PARTTYPE_CURVE;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPartInfo(
+		FHoudiniEngine::Get().GetSession(), InputNodeId, 0, &Part), false);
+
+	HAPI_CurveInfo CurveInfo;
+	FHoudiniApi::CurveInfo_Init(&CurveInfo);
+	CurveInfo.curveType = HAPI_CURVETYPE_LINEAR;
+	CurveInfo.curveCount = NumberOfCurves;
+	CurveInfo.vertexCount = NumberOfPoints;
+	CurveInfo.knotCount = 0;
+	CurveInfo.isPeriodic = false;
+	CurveInfo.isRational = false;
+	CurveInfo.order = 2;
+	CurveInfo.hasKnots = false;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetCurveInfo(
+		FHoudiniEngine::Get().GetSession(), InputNodeId, 0, &CurveInfo), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetCurveCounts(
+		FHoudiniEngine::Get().GetSession(), InputNodeId, 0, CurveCounts.GetData(), 0, NumberOfCurves), false);
+
+	// Position (P), rotation (rot) and scale
+	HAPI_AttributeInfo AttributeInfoPoint;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfoPoint);
+	AttributeInfoPoint.count = NumberOfPoints;
+	AttributeInfoPoint.tupleSize = 3;
+	AttributeInfoPoint.exists = true;
+	AttributeInfoPoint.owner = HAPI_ATTROWNER_POINT;
+	AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
+	AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+		FHoudiniEngine::Get().GetSession(),
+		InputNodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+		FHoudiniEngine::Get().GetSession(),
+		InputNodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
+		Positions.GetData(), 0, AttributeInfoPoint.count), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+		FHoudiniEngine::Get().GetSession(),
+		InputNodeId, 0, HAPI_UNREAL_ATTRIB_SCALE, &AttributeInfoPoint), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+		FHoudiniEngine::Get().GetSession(),
+		InputNodeId, 0, HAPI_UNREAL_ATTRIB_SCALE, &AttributeInfoPoint,
+		Scales.GetData(), 0, AttributeInfoPoint.count), false);
+
+	AttributeInfoPoint.tupleSize = 4;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+		FHoudiniEngine::Get().GetSession(),
+		InputNodeId, 0, HAPI_UNREAL_ATTRIB_ROTATION, &AttributeInfoPoint), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+		FHoudiniEngine::Get().GetSession(),
+		InputNodeId, 0, HAPI_UNREAL_ATTRIB_ROTATION, &AttributeInfoPoint,
+		Rotations.GetData(), 0, AttributeInfoPoint.count), false);
+
+	// Per-spline actor, level and component paths
+	HAPI_AttributeInfo AttributeInfoPrim;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfoPrim);
+	AttributeInfoPrim.count = NumberOfCurves;
+	AttributeInfoPrim.tupleSize = 1;
+	AttributeInfoPrim.exists = true;
+	AttributeInfoPrim.owner = HAPI_ATTROWNER_PRIM;
+	AttributeInfoPrim.storage = HAPI_STORAGETYPE_STRING;
+	AttributeInfoPrim.originalOwner = HAPI_ATTROWNER_INVALID;
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+		FHoudiniEngine::Get().GetSession(),
+		InputNodeId, 0, HAPI_UNREAL_ATTRIB_ACTOR_PATH, &AttributeInfoPrim), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::SetAttributeStringData(
+		ActorPaths, InputNodeId, 0, HAPI_UNREAL_ATTRIB_ACTOR_PATH, AttributeInfoPrim), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+		FHoudiniEngine::Get().GetSession(),
+		InputNodeId, 0, HAPI_UNREAL_ATTRIB_LEVEL_PATH, &AttributeInfoPrim), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::SetAttributeStringData(
+		LevelPaths, InputNodeId, 0, HAPI_UNREAL_ATTRIB_LEVEL_PATH, AttributeInfoPrim), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+		FHoudiniEngine::Get().GetSession(),
+		InputNodeId, 0, HAPI_UNREAL_ATTRIB_OBJECT_PATH, &AttributeInfoPrim), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::SetAttributeStringData(
+		ComponentPaths, InputNodeId, 0, HAPI_UNREAL_ATTRIB_OBJECT_PATH, AttributeInfoPrim), false);
+
+	// Tags groups
+	for (auto& CurrentTagGroup : TagGroups)
+	{
+		FString TagString;
+		CurrentTagGroup.Key.ToString(TagString);
+		FHoudiniEngineUtils::SanitizeHAPIVariableName(TagString);
+
+		TArray<int32>& GroupMembership = CurrentTagGroup.Value;
+		GroupMembership.SetNumZeroed(NumberOfCurves);
+
+		std::string TagRawString;
+		FHoudiniEngineUtils::ConvertUnrealString(TagString, TagRawString);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::AddGroup(
+			FHoudiniEngine::Get().GetSession(), InputNodeId, 0, HAPI_GROUPTYPE_PRIM, TagRawString.c_str()))
+			continue;
+
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::SetGroupMembership(
+			FHoudiniEngine::Get().GetSession(), InputNodeId, 0, HAPI_GROUPTYPE_PRIM, TagRawString.c_str(),
+			GroupMembership.GetData(), 0, NumberOfCurves))
+		{
+			HOUDINI_LOG_WARNING(TEXT("Could not create the group for the spline input's tag %s!"), *TagString);
+		}
+	}
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
+		FHoudiniEngine::Get().GetSession(), InputNodeId), false);
+
+	return true;
+}
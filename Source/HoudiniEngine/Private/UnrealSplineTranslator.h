@@ -36,4 +36,15 @@ struct HOUDINIENGINE_API FUnrealSplineTranslator
 public:
 	static bool CreateInputNodeForSplineComponent(USplineComponent* SplineComponent, const float& SplineResolution, HAPI_NodeId &CreatedInputNodeId, const FString& NodeName);
 
+	// Creates a single input node containing all the splines as linear curves (one primitive per spline),
+	// with the spline's actor/level/component paths as primitive attributes and its tags as primitive groups.
+	// Closed splines repeat their first point. Positions are in world space.
+	static bool CreateInputNodeForSplineComponents(
+		const TArray<USplineComponent*>& SplineComponents, const float& SplineResolution, const float& Tolerance, HAPI_NodeId &CreatedInputNodeId, const FString& NodeName);
+
+	// Samples a spline in world space, only adding points where the spline deviates from a straight line
+	// by more than Tolerance, or where its rotation or scale changes.
+	static void SampleSplineAdaptively(
+		USplineComponent* SplineComponent, const float& Tolerance, TArray<FVector>& OutPositions, TArray<FQuat>& OutRotations, TArray<FVector>& OutScales);
+
 };
\ No newline at end of file
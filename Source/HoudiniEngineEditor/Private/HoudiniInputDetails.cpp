@@ -2759,7 +2759,7 @@ FHoudiniInputDetails::AddLandscapeInputUI(TSharedRef<SVerticalBox> VerticalBox,
 
 				if (bNewState)
 				{
-					// We want to update this landscape data directly, start by backing it up to image files in the temp folder
+					// We want to update this landscape data directly, start by backing it up to a snapshot in the temp folder
 					FString BackupBaseName = HAC->TemporaryCookFolder.Path
 						+ TEXT("/")
 						+ CurrentInputLandscapeProxy->GetName()
@@ -2767,7 +2767,7 @@ FHoudiniInputDetails::AddLandscapeInputUI(TSharedRef<SVerticalBox> VerticalBox,
 						+ HAC->GetComponentGUID().ToString().Left(FHoudiniEngineUtils::PackageGUIDComponentNameLength);
 
 					// We need to cache the input landscape to a file
-					FHoudiniLandscapeTranslator::BackupLandscapeToImageFiles(BackupBaseName, CurrentInputLandscapeProxy);
+					FHoudiniLandscapeTranslator::BackupLandscapeToSnapshot(BackupBaseName, CurrentInputLandscapeProxy, HAC);
 					
 					// Cache its transform on the input
 					CurrentInputLandscape->CachedInputLandscapeTraqnsform = CurrentInputLandscapeProxy->ActorToWorld();
@@ -2781,7 +2781,7 @@ FHoudiniInputDetails::AddLandscapeInputUI(TSharedRef<SVerticalBox> VerticalBox,
 					CurrentInputLandscapeProxy->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
 
 					// Restore the input landscape's backup data
-					FHoudiniLandscapeTranslator::RestoreLandscapeFromImageFiles(CurrentInputLandscapeProxy);
+					FHoudiniLandscapeTranslator::RestoreLandscapeFromSnapshot(CurrentInputLandscapeProxy);
 
 					// Reapply the source Landscape's transform
 					CurrentInputLandscapeProxy->SetActorTransform(CurrentInputLandscape->CachedInputLandscapeTraqnsform);
@@ -4562,6 +4562,126 @@ FHoudiniInputDetails::AddWorldInputUI(
 		CheckBoxBoundAutoUpdate->SetEnabled(MainInput->IsWorldInputBoundSelector());
 	}
 
+	// Checkbox: Instance shared meshes
+	{
+		// Lambda returning a CheckState from the input's current instancing state
+		auto IsCheckedInstanceSharedMeshes = [](UHoudiniInput* InInput)
+		{
+			if (!InInput || InInput->IsPendingKill())
+				return ECheckBoxState::Unchecked;
+
+			return InInput->GetWorldInputInstanceSharedMeshes() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+		};
+
+		// Lambda for changing the instancing state
+		auto CheckStateChangedInstanceSharedMeshes = [MainInput](TArray<UHoudiniInput*> InInputsToUpdate, ECheckBoxState NewState)
+		{
+			if (!MainInput || MainInput->IsPendingKill())
+				return;
+
+			// Record a transaction for undo/redo
+			FScopedTransaction Transaction(
+				TEXT(HOUDINI_MODULE_EDITOR),
+				LOCTEXT("HoudiniWorldInputChangeInstanceSharedMeshes", "Houdini Input: Changing world input shared meshes instancing."),
+				MainInput->GetOuter());
+
+			bool bNewState = (NewState == ECheckBoxState::Checked);
+			for (auto CurInput : InInputsToUpdate)
+			{
+				if (!CurInput || CurInput->IsPendingKill())
+					continue;
+
+				if (CurInput->GetWorldInputInstanceSharedMeshes() == bNewState)
+					continue;
+
+				CurInput->Modify();
+
+				CurInput->SetWorldInputInstanceSharedMeshes(bNewState);
+				CurInput->MarkChanged(true);
+			}
+		};
+
+		VerticalBox->AddSlot().Padding(2, 2, 5, 2).AutoHeight()
+		[
+			SNew(SCheckBox)
+			.Content()
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("InstanceSharedMeshes", "Instance shared meshes"))
+				.ToolTipText(LOCTEXT("InstanceSharedMeshesTip", "If enabled, static meshes used by several actors are sent once and instanced (as packed primitives) on points carrying the actors' transforms and paths."))
+				.Font(FEditorStyle::GetFontStyle(TEXT("PropertyWindow.NormalFont")))
+			]
+			.IsChecked_Lambda([IsCheckedInstanceSharedMeshes, MainInput]()
+			{
+				return IsCheckedInstanceSharedMeshes(MainInput);
+			})
+			.OnCheckStateChanged_Lambda([CheckStateChangedInstanceSharedMeshes, InInputs](ECheckBoxState NewState)
+			{
+				return CheckStateChangedInstanceSharedMeshes(InInputs, NewState);
+			})
+		];
+	}
+
+	// Checkbox: Merge splines
+	{
+		// Lambda returning a CheckState from the input's current merge splines state
+		auto IsCheckedMergeSplines = [](UHoudiniInput* InInput)
+		{
+			if (!InInput || InInput->IsPendingKill())
+				return ECheckBoxState::Unchecked;
+
+			return InInput->GetWorldInputMergeSplines() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+		};
+
+		// Lambda for changing the merge splines state
+		auto CheckStateChangedMergeSplines = [MainInput](TArray<UHoudiniInput*> InInputsToUpdate, ECheckBoxState NewState)
+		{
+			if (!MainInput || MainInput->IsPendingKill())
+				return;
+
+			// Record a transaction for undo/redo
+			FScopedTransaction Transaction(
+				TEXT(HOUDINI_MODULE_EDITOR),
+				LOCTEXT("HoudiniWorldInputChangeMergeSplines", "Houdini Input: Changing world input splines merging."),
+				MainInput->GetOuter());
+
+			bool bNewState = (NewState == ECheckBoxState::Checked);
+			for (auto CurInput : InInputsToUpdate)
+			{
+				if (!CurInput || CurInput->IsPendingKill())
+					continue;
+
+				if (CurInput->GetWorldInputMergeSplines() == bNewState)
+					continue;
+
+				CurInput->Modify();
+
+				CurInput->SetWorldInputMergeSplines(bNewState);
+				CurInput->MarkChanged(true);
+			}
+		};
+
+		VerticalBox->AddSlot().Padding(2, 2, 5, 2).AutoHeight()
+		[
+			SNew(SCheckBox)
+			.Content()
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("MergeSplines", "Merge splines"))
+				.ToolTipText(LOCTEXT("MergeSplinesTip", "If enabled, all the splines are sent as a single curve geometry in world space, with one primitive per spline. The splines are sampled adaptively to their curvature instead of at a fixed resolution."))
+				.Font(FEditorStyle::GetFontStyle(TEXT("PropertyWindow.NormalFont")))
+			]
+			.IsChecked_Lambda([IsCheckedMergeSplines, MainInput]()
+			{
+				return IsCheckedMergeSplines(MainInput);
+			})
+			.OnCheckStateChanged_Lambda([CheckStateChangedMergeSplines, InInputs](ECheckBoxState NewState)
+			{
+				return CheckStateChangedMergeSplines(InInputs, NewState);
+			})
+		];
+	}
+
 	// ActorPicker : Bound Selector
 	if(bIsBoundSelector)
 	{
@@ -693,6 +693,8 @@ UHoudiniPublicAPIWorldInput::UHoudiniPublicAPIWorldInput()
 	bKeepWorldTransform = true;
 	bIsWorldInputBoundSelector = false;
 	bWorldInputBoundSelectorAutoUpdate = false;
+	bWorldInputInstanceSharedMeshes = false;
+	bWorldInputMergeSplines = false;
 	UnrealSplineResolution = 50.0f;
 }
 
@@ -722,6 +724,8 @@ UHoudiniPublicAPIWorldInput::PopulateFromHoudiniInput(UHoudiniInput const* const
 		WorldInputBoundSelectorObjects.Empty();
 	bIsWorldInputBoundSelector = InInput->IsWorldInputBoundSelector();
 	bWorldInputBoundSelectorAutoUpdate = InInput->GetWorldInputBoundSelectorAutoUpdates();
+	bWorldInputInstanceSharedMeshes = InInput->GetWorldInputInstanceSharedMeshes();
+	bWorldInputMergeSplines = InInput->GetWorldInputMergeSplines();
 	UnrealSplineResolution = InInput->GetUnrealSplineResolution();
 
 	return true;
@@ -739,6 +743,8 @@ UHoudiniPublicAPIWorldInput::UpdateHoudiniInput(UHoudiniInput* const InInput) co
 		*BoundSelectorObjectArray = WorldInputBoundSelectorObjects;
 	InInput->SetWorldInputBoundSelector(bIsWorldInputBoundSelector);
 	InInput->SetWorldInputBoundSelectorAutoUpdates(bWorldInputBoundSelectorAutoUpdate);
+	InInput->SetWorldInputInstanceSharedMeshes(bWorldInputInstanceSharedMeshes);
+	InInput->SetWorldInputMergeSplines(bWorldInputMergeSplines);
 	InInput->SetUnrealSplineResolution(UnrealSplineResolution);
 	InInput->MarkChanged(true);
 
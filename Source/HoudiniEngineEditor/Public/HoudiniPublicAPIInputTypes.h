@@ -475,6 +475,14 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API | Inputs")
 	bool bWorldInputBoundSelectorAutoUpdate;
 
+	/** Indicates that static meshes shared by several actors are sent once and instanced on the actors' transforms */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API | Inputs")
+	bool bWorldInputInstanceSharedMeshes;
+
+	/** Indicates that all the splines are sent as a single curve geometry, sampled adaptively to their curvature */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API | Inputs")
+	bool bWorldInputMergeSplines;
+
 	/** Resolution used when converting unreal splines to houdini curves */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API | Inputs")
 	float UnrealSplineResolution;
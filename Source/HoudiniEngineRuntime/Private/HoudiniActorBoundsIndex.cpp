@@ -0,0 +1,358 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniActorBoundsIndex.h"
+
+#include "HoudiniEngineRuntimePrivatePCH.h"
+
+#include "EngineUtils.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Components/ActorComponent.h"
+#include "UObject/UObjectGlobals.h"
+
+TUniquePtr<FHoudiniActorBoundsIndex> FHoudiniActorBoundsIndex::Instance;
+
+void
+FHoudiniActorBoundsOctreeSemantics::SetElementId(const FHoudiniActorBoundsElement& Element, FOctreeElementId2 Id)
+{
+	if (Element.Owner)
+		Element.Owner->ElementIds.Add(Element.Actor, Id);
+}
+
+
+FHoudiniActorBoundsIndex::FHoudiniActorBoundsIndex()
+	: NextActorOrder(0)
+	, bNeedsRebuild(true)
+	, bEventsBound(false)
+{
+}
+
+
+FHoudiniActorBoundsIndex::~FHoudiniActorBoundsIndex()
+{
+	UnbindEvents();
+}
+
+
+FHoudiniActorBoundsIndex&
+FHoudiniActorBoundsIndex::Get()
+{
+	if (!Instance.IsValid())
+		Instance = MakeUnique<FHoudiniActorBoundsIndex>();
+
+	return *Instance;
+}
+
+
+void
+FHoudiniActorBoundsIndex::Shutdown()
+{
+	Instance.Reset();
+}
+
+
+bool
+FHoudiniActorBoundsIndex::FindActorsIntersecting(UWorld* InWorld, const TArray<FBox>& InBoxes, TArray<AActor*>& OutActors)
+{
+	if (!InWorld || InWorld->IsPendingKill())
+		return false;
+
+	BindEvents();
+
+	// We only receive the actor events for editor worlds,
+	// the index of any other world needs to be rebuilt for each query
+	if (!bEventsBound || InWorld->WorldType != EWorldType::Editor)
+		bNeedsRebuild = true;
+
+	if (bNeedsRebuild || !Octree.IsValid() || IndexedWorld.Get() != InWorld)
+		Rebuild(InWorld);
+	else
+		UpdateDirtyActors();
+
+	TSet<AActor*> FoundActors;
+	for (const FBox& CurrentBox : InBoxes)
+	{
+		Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(CurrentBox), 
+			[&](const FHoudiniActorBoundsElement& Element)
+		{
+			AActor* CurrentActor = Element.Actor.Get();
+			if (!CurrentActor || CurrentActor->IsPendingKill())
+				return;
+
+			// The octree test is conservative, do the exact test on the actor's bounds
+			if (!Element.Bounds.Intersect(CurrentBox))
+				return;
+
+			bool bAlreadyFound = false;
+			FoundActors.Add(CurrentActor, &bAlreadyFound);
+			if (!bAlreadyFound)
+				OutActors.Add(CurrentActor);
+		});
+	}
+
+	// The octree returns the actors in spatial order, sort them by level then by their order in the level
+	TMap<const ULevel*, int64> LevelIndices;
+	const TArray<ULevel*>& Levels = InWorld->GetLevels();
+	for (int32 Idx = 0; Idx < Levels.Num(); Idx++)
+		LevelIndices.Add(Levels[Idx], Idx);
+
+	TMap<const AActor*, int64> SortKeys;
+	SortKeys.Reserve(OutActors.Num());
+	for (AActor* CurrentActor : OutActors)
+	{
+		const int64* LevelIndex = LevelIndices.Find(CurrentActor->GetLevel());
+		const int32* ActorOrder = ActorOrders.Find(CurrentActor);
+		SortKeys.Add(CurrentActor, ((LevelIndex ? *LevelIndex : MAX_int32) << 32) + (ActorOrder ? *ActorOrder : MAX_int32));
+	}
+
+	OutActors.Sort([&SortKeys](const AActor& A, const AActor& B)
+	{
+		return SortKeys.FindRef(&A) < SortKeys.FindRef(&B);
+	});
+
+	return true;
+}
+
+
+void
+FHoudiniActorBoundsIndex::Invalidate()
+{
+	bNeedsRebuild = true;
+}
+
+
+void
+FHoudiniActorBoundsIndex::MarkActorDirty(AActor* InActor, const bool& bInIncludeAttachedActors)
+{
+	if (!InActor || bNeedsRebuild)
+		return;
+
+	if (InActor->GetWorld() != IndexedWorld.Get())
+		return;
+
+	DirtyActors.Add(InActor);
+	if (!bInIncludeAttachedActors)
+		return;
+
+	TArray<AActor*> AttachedActors;
+	InActor->GetAttachedActors(AttachedActors);
+	for (int32 Idx = 0; Idx < AttachedActors.Num(); Idx++)
+	{
+		AActor* CurrentActor = AttachedActors[Idx];
+		if (!CurrentActor || DirtyActors.Contains(CurrentActor))
+			continue;
+
+		DirtyActors.Add(CurrentActor);
+		CurrentActor->GetAttachedActors(AttachedActors, false);
+	}
+}
+
+
+void
+FHoudiniActorBoundsIndex::Rebuild(UWorld* InWorld)
+{
+	ElementIds.Empty();
+	DirtyActors.Empty();
+	ActorOrders.Empty();
+	NextActorOrder = 0;
+	Octree = MakeUnique<FHoudiniActorBoundsOctree>(FVector::ZeroVector, HALF_WORLD_MAX);
+	IndexedWorld = InWorld;
+
+	for (TActorIterator<AActor> ActorItr(InWorld); ActorItr; ++ActorItr)
+		AddOrUpdateActor(*ActorItr);
+
+	bNeedsRebuild = false;
+}
+
+
+void
+FHoudiniActorBoundsIndex::UpdateDirtyActors()
+{
+	if (DirtyActors.Num() <= 0)
+		return;
+
+	for (const TWeakObjectPtr<AActor>& CurrentActor : DirtyActors)
+	{
+		if (CurrentActor.IsValid() && IsIndexableActor(CurrentActor.Get()))
+		{
+			AddOrUpdateActor(CurrentActor.Get());
+		}
+		else
+		{
+			RemoveActor(CurrentActor);
+			ActorOrders.Remove(CurrentActor);
+		}
+	}
+
+	DirtyActors.Empty();
+}
+
+
+void
+FHoudiniActorBoundsIndex::AddOrUpdateActor(AActor* InActor)
+{
+	if (!IsIndexableActor(InActor))
+		return;
+
+	RemoveActor(InActor);
+
+	// New actors are appended to their level's actors, updated ones keep their order
+	if (!ActorOrders.Contains(InActor))
+		ActorOrders.Add(InActor, NextActorOrder++);
+
+	FHoudiniActorBoundsElement Element;
+	Element.Actor = InActor;
+	Element.Bounds = InActor->GetComponentsBoundingBox(true);
+	Element.Owner = this;
+
+	// SetElementId will register the actor's element id
+	Octree->AddElement(Element);
+}
+
+
+void
+FHoudiniActorBoundsIndex::RemoveActor(const TWeakObjectPtr<AActor>& InActor)
+{
+	FOctreeElementId2 ElementId;
+	if (!ElementIds.RemoveAndCopyValue(InActor, ElementId))
+		return;
+
+	if (Octree.IsValid() && Octree->IsValidElementId(ElementId))
+		Octree->RemoveElement(ElementId);
+}
+
+
+bool
+FHoudiniActorBoundsIndex::IsIndexableActor(AActor* InActor)
+{
+	if (!InActor || InActor->IsPendingKill())
+		return false;
+
+	return true;
+}
+
+
+void
+FHoudiniActorBoundsIndex::BindEvents()
+{
+#if WITH_EDITOR
+	if (bEventsBound || !GEngine)
+		return;
+
+	OnLevelActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FHoudiniActorBoundsIndex::OnLevelActorAdded);
+	OnLevelActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FHoudiniActorBoundsIndex::OnLevelActorDeleted);
+	OnActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FHoudiniActorBoundsIndex::OnActorMoved);
+	OnLevelActorListChangedHandle = GEngine->OnLevelActorListChanged().AddRaw(this, &FHoudiniActorBoundsIndex::OnLevelActorListChanged);
+	OnObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FHoudiniActorBoundsIndex::OnObjectPropertyChanged);
+	OnLevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FHoudiniActorBoundsIndex::OnLevelChanged);
+	OnLevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FHoudiniActorBoundsIndex::OnLevelChanged);
+
+	bEventsBound = true;
+#endif
+}
+
+
+void
+FHoudiniActorBoundsIndex::UnbindEvents()
+{
+#if WITH_EDITOR
+	if (!bEventsBound)
+		return;
+
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(OnLevelActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(OnLevelActorDeletedHandle);
+		GEngine->OnActorMoved().Remove(OnActorMovedHandle);
+		GEngine->OnLevelActorListChanged().Remove(OnLevelActorListChangedHandle);
+	}
+
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(OnObjectPropertyChangedHandle);
+	FWorldDelegates::LevelAddedToWorld.Remove(OnLevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(OnLevelRemovedHandle);
+
+	bEventsBound = false;
+#endif
+}
+
+
+void
+FHoudiniActorBoundsIndex::OnLevelActorAdded(AActor* InActor)
+{
+	MarkActorDirty(InActor);
+}
+
+
+void
+FHoudiniActorBoundsIndex::OnLevelActorDeleted(AActor* InActor)
+{
+	if (!InActor || bNeedsRebuild)
+		return;
+
+	// Remove it right away, the actor might not be valid anymore on the next query
+	DirtyActors.Remove(InActor);
+	RemoveActor(InActor);
+	ActorOrders.Remove(InActor);
+}
+
+
+void
+FHoudiniActorBoundsIndex::OnActorMoved(AActor* InActor)
+{
+	// Attached actors are moved along with their parent
+	MarkActorDirty(InActor, true);
+}
+
+
+void
+FHoudiniActorBoundsIndex::OnObjectPropertyChanged(UObject* InObject, FPropertyChangedEvent& InEvent)
+{
+	// Property changes on actors or their components can modify their bounds
+	if (AActor* Actor = Cast<AActor>(InObject))
+	{
+		MarkActorDirty(Actor);
+	}
+	else if (UActorComponent* Component = Cast<UActorComponent>(InObject))
+	{
+		MarkActorDirty(Component->GetOwner());
+	}
+}
+
+
+void
+FHoudiniActorBoundsIndex::OnLevelChanged(ULevel* InLevel, UWorld* InWorld)
+{
+	if (!InWorld || InWorld == IndexedWorld.Get())
+		Invalidate();
+}
+
+
+void
+FHoudiniActorBoundsIndex::OnLevelActorListChanged()
+{
+	Invalidate();
+}
@@ -0,0 +1,160 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/GenericOctree.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+class UWorld;
+class ULevel;
+class FHoudiniActorBoundsIndex;
+
+// Element stored in the actor bounds octree
+struct FHoudiniActorBoundsElement
+{
+	TWeakObjectPtr<AActor> Actor;
+	FBox Bounds;
+	FHoudiniActorBoundsIndex* Owner = nullptr;
+};
+
+struct FHoudiniActorBoundsOctreeSemantics
+{
+	enum { MaxElementsPerLeaf = 16 };
+	enum { MinInclusiveElementsPerNode = 7 };
+	enum { MaxNodeDepth = 12 };
+
+	typedef TInlineAllocator<MaxElementsPerLeaf> ElementAllocator;
+
+	FORCEINLINE static FBoxCenterAndExtent GetBoundingBox(const FHoudiniActorBoundsElement& Element)
+	{
+		return FBoxCenterAndExtent(Element.Bounds);
+	}
+
+	FORCEINLINE static bool AreElementsEqual(const FHoudiniActorBoundsElement& A, const FHoudiniActorBoundsElement& B)
+	{
+		return A.Actor == B.Actor;
+	}
+
+	static void SetElementId(const FHoudiniActorBoundsElement& Element, FOctreeElementId2 Id);
+};
+
+typedef TOctree2<FHoudiniActorBoundsElement, FHoudiniActorBoundsOctreeSemantics> FHoudiniActorBoundsOctree;
+
+//
+// Spatial index of the bounds of the actors of a world, used by the world input
+// bound selectors. The index is built on the first query and is then kept up to date 
+// incrementally from the editor's actor added/moved/deleted events.
+//
+class HOUDINIENGINERUNTIME_API FHoudiniActorBoundsIndex
+{
+	friend struct FHoudiniActorBoundsOctreeSemantics;
+
+	public:
+
+		FHoudiniActorBoundsIndex();
+		~FHoudiniActorBoundsIndex();
+
+		// Returns the index shared by all the world inputs
+		static FHoudiniActorBoundsIndex& Get();
+
+		// Releases the shared index and its event bindings
+		static void Shutdown();
+
+		// Gathers all the actors of InWorld whose bounds intersect one of InBoxes,
+		// in the order a world actor iterator would return them.
+		// Returns false if the index could not be used for that world.
+		bool FindActorsIntersecting(UWorld* InWorld, const TArray<FBox>& InBoxes, TArray<AActor*>& OutActors);
+
+		// Forces a full rebuild of the index on the next query
+		void Invalidate();
+
+		// Flags an actor (and optionally the actors attached to it) so its bounds are updated on the next query.
+		// Needed when an actor's components are changed without any editor notification (ie, HDA outputs).
+		void MarkActorDirty(AActor* InActor, const bool& bInIncludeAttachedActors = false);
+
+		// Number of actors currently in the index
+		int32 GetNumIndexedActors() const { return ElementIds.Num(); };
+
+	protected:
+
+		// Rebuilds the whole octree from the actors of InWorld
+		void Rebuild(UWorld* InWorld);
+
+		// Updates the bounds of the actors that were added/moved/deleted since the last query
+		void UpdateDirtyActors();
+
+		void AddOrUpdateActor(AActor* InActor);
+		void RemoveActor(const TWeakObjectPtr<AActor>& InActor);
+
+		// Returns true if this actor should be stored in the index
+		static bool IsIndexableActor(AActor* InActor);
+
+		void BindEvents();
+		void UnbindEvents();
+
+		void OnLevelActorAdded(AActor* InActor);
+		void OnLevelActorDeleted(AActor* InActor);
+		void OnActorMoved(AActor* InActor);
+		void OnObjectPropertyChanged(UObject* InObject, struct FPropertyChangedEvent& InEvent);
+		void OnLevelChanged(ULevel* InLevel, UWorld* InWorld);
+		void OnLevelActorListChanged();
+
+	private:
+
+		TUniquePtr<FHoudiniActorBoundsOctree> Octree;
+
+		// Octree element of each indexed actor
+		TMap<TWeakObjectPtr<AActor>, FOctreeElementId2> ElementIds;
+
+		// Actors whose bounds need to be updated before the next query
+		TSet<TWeakObjectPtr<AActor>> DirtyActors;
+
+		// Order in which the actors were added to the index, used to sort the query results like their levels' actors
+		TMap<TWeakObjectPtr<AActor>, int32> ActorOrders;
+		int32 NextActorOrder;
+
+		// World the index was built for
+		TWeakObjectPtr<UWorld> IndexedWorld;
+
+		// Indicates the whole index needs to be rebuilt
+		bool bNeedsRebuild;
+
+		// Indicates the actor/level events are bound
+		bool bEventsBound;
+
+		FDelegateHandle OnLevelActorAddedHandle;
+		FDelegateHandle OnLevelActorDeletedHandle;
+		FDelegateHandle OnActorMovedHandle;
+		FDelegateHandle OnObjectPropertyChangedHandle;
+		FDelegateHandle OnLevelAddedHandle;
+		FDelegateHandle OnLevelRemovedHandle;
+		FDelegateHandle OnLevelActorListChangedHandle;
+
+		static TUniquePtr<FHoudiniActorBoundsIndex> Instance;
+};
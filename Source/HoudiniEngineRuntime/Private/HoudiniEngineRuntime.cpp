@@ -29,6 +29,7 @@
 #include "HoudiniRuntimeSettings.h"
 
 #include "HoudiniAssetComponent.h"
+#include "HoudiniActorBoundsIndex.h"
 
 #include "Modules/ModuleManager.h"
 
@@ -72,6 +73,8 @@ void FHoudiniEngineRuntime::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FHoudiniActorBoundsIndex::Shutdown();
+
 	FHoudiniEngineRuntime::HoudiniEngineRuntimeInstance = nullptr;
 }
 
@@ -296,6 +299,66 @@ FHoudiniEngineRuntime::RemoveParentNodePendingDelete(const int32& NodeId)
 }
 
 
+int32
+FHoudiniEngineRuntime::GetSharedInputNodeId(const FString& InKey) const
+{
+	const FSharedInputNode* SharedNode = SharedInputNodes.Find(InKey);
+	return SharedNode ? SharedNode->NodeId : -1;
+}
+
+
+void
+FHoudiniEngineRuntime::SetSharedInputNodeId(const FString& InKey, const int32& InNodeId)
+{
+	SharedInputNodes.FindOrAdd(InKey).NodeId = InNodeId;
+}
+
+
+void
+FHoudiniEngineRuntime::AcquireSharedInputNode(const FString& InKey)
+{
+	SharedInputNodes.FindOrAdd(InKey).RefCount++;
+}
+
+
+void
+FHoudiniEngineRuntime::ReleaseSharedInputNode(const FString& InKey)
+{
+	FSharedInputNode* SharedNode = SharedInputNodes.Find(InKey);
+	if (!SharedNode)
+		return;
+
+	SharedNode->RefCount--;
+	if (SharedNode->RefCount > 0)
+		return;
+
+	// Nobody uses this node anymore, delete it and its OBJ node
+	MarkNodeIdAsPendingDelete(SharedNode->NodeId, true);
+	SharedInputNodes.Remove(InKey);
+}
+
+
+int32
+FHoudiniEngineRuntime::GetSharedInputNodeRefCount(const FString& InKey) const
+{
+	const FSharedInputNode* SharedNode = SharedInputNodes.Find(InKey);
+	return SharedNode ? SharedNode->RefCount : 0;
+}
+
+
+void
+FHoudiniEngineRuntime::ResetSharedInputNodes()
+{
+	for (auto It = SharedInputNodes.CreateIterator(); It; ++It)
+	{
+		if (It.Value().RefCount <= 0)
+			It.RemoveCurrent();
+		else
+			It.Value().NodeId = -1;
+	}
+}
+
+
 FString
 FHoudiniEngineRuntime::GetDefaultTemporaryCookFolder() const
 {
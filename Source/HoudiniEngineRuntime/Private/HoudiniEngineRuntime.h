@@ -80,6 +80,30 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 
 		void RemoveParentNodePendingDelete(const int32& NodeId);
 
+		//
+		// Shared input nodes
+		//
+		// Returns the input node shared under this content key, -1 if there is none
+		int32 GetSharedInputNodeId(const FString& InKey) const;
+
+		// Sets the input node shared under this content key, its references are kept
+		void SetSharedInputNodeId(const FString& InKey, const int32& InNodeId);
+
+		// Adds a reference to the input node shared under this content key
+		void AcquireSharedInputNode(const FString& InKey);
+
+		// Removes a reference to the input node shared under this content key.
+		// The node and its parent are deleted once they are not referenced anymore.
+		void ReleaseSharedInputNode(const FString& InKey);
+
+		// Returns the number of references to the input node shared under this content key
+		int32 GetSharedInputNodeRefCount(const FString& InKey) const;
+
+		// Forgets the shared input nodes when the session they were created in is stopped.
+		// The references held by the input objects are kept so they stay balanced,
+		// the nodes will be recreated in the new session when needed.
+		void ResetSharedInputNodes();
+
 		//
 		//
 		//
@@ -104,4 +128,13 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 		TArray<int32> NodeIdsPendingDelete;
 
 		TArray<int32> NodeIdsParentPendingDelete;
+
+		struct FSharedInputNode
+		{
+			int32 NodeId = -1;
+			int32 RefCount = 0;
+		};
+
+		// Input nodes shared by the input objects sending the same content, by content key
+		TMap<FString, FSharedInputNode> SharedInputNodes;
 };
\ No newline at end of file
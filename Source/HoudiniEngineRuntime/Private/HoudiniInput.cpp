@@ -34,6 +34,7 @@
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniAssetBlueprintComponent.h"
+#include "HoudiniActorBoundsIndex.h"
 
 #include "EngineUtils.h"
 #include "Engine/Brush.h"
@@ -67,6 +68,8 @@ UHoudiniInput::UHoudiniInput()
 	, ParmId(-1)
 	, bIsObjectPathParameter(false)
 	, bHasChanged(false)
+	, bDataUploadNeeded(false)
+	, bTransformsOnlyChanged(false)
 	, bPackBeforeMerge(false)
 	, bExportLODs(false)
 	, bExportSockets(false)
@@ -78,6 +81,8 @@ UHoudiniInput::UHoudiniInput()
 	, bAddRotAndScaleAttributesOnCurves(false)
 	, bIsWorldInputBoundSelector(false)
 	, bWorldInputBoundSelectorAutoUpdate(false)
+	, bWorldInputInstanceSharedMeshes(false)
+	, bWorldInputMergeSplines(false)
 	, UnrealSplineResolution(50.0f)
 	, bUpdateInputLandscape(false)
 	, LandscapeExportType(EHoudiniLandscapeExportType::Heightfield)
@@ -1116,6 +1121,12 @@ void UHoudiniInput::InvalidateData()
 	}
 	
 	CreatedDataNodeIds.Empty();
+
+	// The shared mesh instancers' and merged splines' nodes are invalidated with their leaders
+	InstancedWorldInputComponents.Empty();
+	SharedMeshInstancerSignatures.Empty();
+	MergedWorldInputSplines.Empty();
+	MergedSplineSignatures.Empty();
 }
 
 void UHoudiniInput::CopyInputs(TArray<UHoudiniInputObject*>& ToInputObjects, TArray<UHoudiniInputObject*>& FromInputObjects, bool bInCanDeleteHoudiniNodes)
@@ -1926,6 +1937,42 @@ UHoudiniInput::SetBoundSelectorObjectAt(const int32& AtIndex, AActor* InActor)
 	WorldInputBoundSelectorObjects[AtIndex] = InActor;
 }
 
+void
+UHoudiniInput::SetWorldInputMergeSplines(const bool& InMergeSplines)
+{
+	if (bWorldInputMergeSplines == InMergeSplines)
+		return;
+
+	bWorldInputMergeSplines = InMergeSplines;
+
+	// The spline components either have their own curve node or share the merged one,
+	// delete their nodes so they are recreated in the new mode
+	for (UHoudiniInputObject* CurrentInputObject : WorldInputObjects)
+	{
+		UHoudiniInputActor* InputActor = Cast<UHoudiniInputActor>(CurrentInputObject);
+		if (!InputActor || InputActor->IsPendingKill())
+			continue;
+
+		for (UHoudiniInputSceneComponent* CurrentComp : InputActor->GetActorComponents())
+		{
+			if (!CurrentComp || CurrentComp->IsPendingKill())
+				continue;
+
+			if (CurrentComp->Type != EHoudiniInputObjectType::SplineComponent)
+				continue;
+
+			if (CurrentComp->InputNodeId >= 0)
+				FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(CurrentComp->InputNodeId, true);
+
+			CurrentComp->InputNodeId = -1;
+			CurrentComp->InputObjectNodeId = -1;
+			CurrentComp->MarkChanged(true);
+		}
+
+		InputActor->MarkChanged(true);
+	}
+}
+
 // Helper function indicating what classes are supported by an input type
 TArray<const UClass*>
 UHoudiniInput::GetAllowedClasses(const EHoudiniInputType& InInputType)
@@ -1989,9 +2036,36 @@ UHoudiniInput::IsDataUploadNeeded()
 	if (bDataUploadNeeded)
 		return true;
 
+	if (bTransformsOnlyChanged)
+	{
+		// Only upload the data if an input object has changed since
+		TArray<UHoudiniInputObject*>* InputObjectsPtr = GetHoudiniInputObjectArray(Type);
+		if (!ensure(InputObjectsPtr))
+			return false;
+
+		for (auto CurrentInputObject : (*InputObjectsPtr))
+		{
+			if (CurrentInputObject && CurrentInputObject->HasChanged())
+				return true;
+		}
+
+		return false;
+	}
+
 	return HasChanged();
 }
 
+void
+UHoudiniInput::MarkTransformsOnlyChanged()
+{
+	// Don't hide a pending change that requires a data upload
+	if (!bHasChanged)
+		bTransformsOnlyChanged = true;
+
+	bHasChanged = true;
+	SetNeedsToTriggerUpdate(true);
+}
+
 // Indicates if this input has changed and should be updated
 bool 
 UHoudiniInput::HasChanged()
@@ -2362,9 +2436,18 @@ UHoudiniInput::UpdateWorldSelectionFromBoundSelectors()
 	//UWorld* editorWorld = GEditor->GetEditorWorldContext().World();
 	UWorld* MyWorld = GetWorld();
 	TArray<AActor*> NewSelectedActors;
-	for (TActorIterator<AActor> ActorItr(MyWorld); ActorItr; ++ActorItr)
+
+	// Only look at the actors whose bounds intersect one of the selectors
+	TArray<AActor*> CandidateActors;
+	bool bUseBoundsIndex = FHoudiniActorBoundsIndex::Get().FindActorsIntersecting(MyWorld, AllBBox, CandidateActors);
+	if (!bUseBoundsIndex)
+	{
+		for (TActorIterator<AActor> ActorItr(MyWorld); ActorItr; ++ActorItr)
+			CandidateActors.Add(*ActorItr);
+	}
+
+	for (AActor* CurrentActor : CandidateActors)
 	{
-		AActor *CurrentActor = *ActorItr;
 		if (!CurrentActor || CurrentActor->IsPendingKill())
 			continue;
 
@@ -2389,6 +2472,13 @@ UHoudiniInput::UpdateWorldSelectionFromBoundSelectors()
 				continue;
 		}
 
+		// The index only returns actors intersecting the selectors
+		if (bUseBoundsIndex)
+		{
+			NewSelectedActors.Add(CurrentActor);
+			continue;
+		}
+
 		FBox ActorBounds = CurrentActor->GetComponentsBoundingBox(true);
 		for (auto InBounds : AllBBox)
 		{
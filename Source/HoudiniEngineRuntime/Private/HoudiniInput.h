@@ -163,6 +163,18 @@ public:
 
 	bool IsWorldInputBoundSelector() const { return bIsWorldInputBoundSelector; };
 	bool GetWorldInputBoundSelectorAutoUpdates() const { return bWorldInputBoundSelectorAutoUpdate; };
+	bool GetWorldInputInstanceSharedMeshes() const { return bWorldInputInstanceSharedMeshes; };
+	bool GetWorldInputMergeSplines() const { return bWorldInputMergeSplines; };
+
+	// Static mesh components of the world input sent by a shared mesh instancer during the current upload
+	TSet<UHoudiniInputObject*>& GetInstancedWorldInputComponents() { return InstancedWorldInputComponents; };
+	// Signature of the group of components each leader's instancer was last built for
+	TMap<TWeakObjectPtr<UHoudiniInputObject>, uint32>& GetSharedMeshInstancerSignatures() { return SharedMeshInstancerSignatures; };
+
+	// Spline components of the world input sent in the merged splines node during the current upload
+	TSet<UHoudiniInputObject*>& GetMergedWorldInputSplines() { return MergedWorldInputSplines; };
+	// Signature of the splines and settings each leader's merged node was last built for
+	TMap<TWeakObjectPtr<UHoudiniInputObject>, uint32>& GetMergedSplineSignatures() { return MergedSplineSignatures; };
 
 	FString GetNodeBaseName() const;
 
@@ -218,8 +230,11 @@ public:
 	void MarkChanged(const bool& bInChanged)
 	{
 		bHasChanged = bInChanged;
+		bTransformsOnlyChanged = false;
 		SetNeedsToTriggerUpdate(bInChanged);
 	};
+	// Marks this input as changed when only its input objects' transforms need to be uploaded
+	void MarkTransformsOnlyChanged();
 	void SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate) { bNeedsToTriggerUpdate = bInTriggersUpdate; };
 	void MarkDataUploadNeeded(const bool& bInDataUploadNeeded) { bDataUploadNeeded = bInDataUploadNeeded; };
 	void MarkAllInputObjectsChanged(const bool& bInChanged);
@@ -267,6 +282,9 @@ public:
 	void SetBoundSelectorObjectAt(const int32& AtIndex, AActor* InActor);
 	void SetWorldInputBoundSelector(const bool& InIsBoundSelector) { bIsWorldInputBoundSelector = InIsBoundSelector; };
 	void SetWorldInputBoundSelectorAutoUpdates(const bool& InAutoUpdate) { bWorldInputBoundSelectorAutoUpdate = InAutoUpdate; };
+	void SetWorldInputInstanceSharedMeshes(const bool& InInstanceSharedMeshes) { bWorldInputInstanceSharedMeshes = InInstanceSharedMeshes; };
+	// Also deletes the spline components' nodes, so they are all recreated in the new mode
+	void SetWorldInputMergeSplines(const bool& InMergeSplines);
 
 	// Updates the world selection using bound selectors
 	// returns false if the selection hasn't changed
@@ -402,6 +420,9 @@ protected:
 	// and don't need to resend all the input data
 	bool bDataUploadNeeded;
 
+	// Indicates that only the input objects' transforms have changed since the last upload
+	bool bTransformsOnlyChanged;
+
 	// Help for this parameter/input
 	UPROPERTY()
 	FString Help;
@@ -501,6 +522,22 @@ protected:
 	UPROPERTY()
 	bool bWorldInputBoundSelectorAutoUpdate;
 
+	// Indicates that the static meshes shared by several actors are sent once,
+	// and instanced on a point cloud of the actors' transforms
+	UPROPERTY()
+	bool bWorldInputInstanceSharedMeshes;
+
+	TSet<UHoudiniInputObject*> InstancedWorldInputComponents;
+	TMap<TWeakObjectPtr<UHoudiniInputObject>, uint32> SharedMeshInstancerSignatures;
+
+	// Indicates that all the spline components of the world input are sent
+	// as a single curve geometry, sampled adaptively to their curvature
+	UPROPERTY()
+	bool bWorldInputMergeSplines;
+
+	TSet<UHoudiniInputObject*> MergedWorldInputSplines;
+	TMap<TWeakObjectPtr<UHoudiniInputObject>, uint32> MergedSplineSignatures;
+
 	// Resolution used when converting unreal splines to houdini curves
 	UPROPERTY()
 	float UnrealSplineResolution;
@@ -214,6 +214,8 @@ UHoudiniInputActor::UHoudiniInputActor(const FObjectInitializer& ObjectInitializ
 //
 UHoudiniInputLandscape::UHoudiniInputLandscape(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, CachedExtentMin(FIntPoint::ZeroValue)
+	, CachedExtentMax(FIntPoint::ZeroValue)
 {
 
 }
@@ -328,6 +330,17 @@ UHoudiniInputLandscape::SetLandscapeProxy(UObject* InLandscapeProxy)
 		InputObject = LandscapeProxy;
 }
 
+void
+UHoudiniInputLandscape::ResetCachedHeightfieldData()
+{
+	CachedComponentHashes.Empty();
+	CachedExtentMin = FIntPoint::ZeroValue;
+	CachedExtentMax = FIntPoint::ZeroValue;
+	CachedHeightfieldTransform = FTransform::Identity;
+	CachedVolumeNodeIds.Empty();
+	CachedLayerMinValues.Empty();
+}
+
 ABrush*
 UHoudiniInputBrush::GetBrush() const
 { 
@@ -777,9 +790,13 @@ UHoudiniInputObject::InvalidateData()
 		// just invalidate the node IDs!
 		InputNodeId = -1;
 		InputObjectNodeId = -1;
+		ReleaseSharedInputNode();
 		return;
 	}
 
+	// Release the shared input node our node references
+	ReleaseSharedInputNode();
+
 	if (InputNodeId >= 0)
 	{
 		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId);
@@ -796,6 +813,16 @@ UHoudiniInputObject::InvalidateData()
 	
 }
 
+void
+UHoudiniInputObject::ReleaseSharedInputNode()
+{
+	if (SharedInputNodeKey.IsEmpty())
+		return;
+
+	FHoudiniEngineRuntime::Get().ReleaseSharedInputNode(SharedInputNodeKey);
+	SharedInputNodeKey.Empty();
+}
+
 void
 UHoudiniInputObject::BeginDestroy()
 {
@@ -1476,25 +1503,8 @@ FHoudiniBrushInfo::FHoudiniBrushInfo(ABrush* InBrushActor)
 	BrushActor->GetActorBounds(false, CachedOrigin, CachedExtent);
 	CachedBrushType = BrushActor->BrushType;
 
-#if WITH_EDITOR
-	UModel* Model = BrushActor->Brush;
-
 	// Cache the hash of the surface properties
-	if (IsValid(Model) && IsValid(Model->Polys))
-	{
-		int32 NumPolys = Model->Polys->Element.Num();
-		CachedSurfaceHash = 0;
-		for(int32 iPoly = 0; iPoly < NumPolys; ++iPoly)
-		{
-			const FPoly& Poly = Model->Polys->Element[iPoly]; 
-			CombinePolyHash(CachedSurfaceHash, Poly);
-		}
-	}
-	else
-	{
-		CachedSurfaceHash = 0;
-	}
-#endif
+	CachedSurfaceHash = ComputeSurfaceHash(BrushActor->Brush);
 }
 
 bool FHoudiniBrushInfo::HasChanged() const
@@ -1515,29 +1525,68 @@ bool FHoudiniBrushInfo::HasChanged() const
 
 	if (!(TmpOrigin.Equals(CachedOrigin) && TmpExtent.Equals(CachedExtent) ))
 		return true;
-#if WITH_EDITOR
+
 	// Is there a tracked surface property that changed?
-	UModel* Model = BrushActor->Brush;
+	if (ComputeSurfaceHash(BrushActor->Brush) != CachedSurfaceHash)
+		return true;
+
+	return false;
+}
+
+uint64 FHoudiniBrushInfo::ComputeSurfaceHash(const UModel* Model)
+{
+	uint64 SurfaceHash = 0;
+#if WITH_EDITOR
 	if (IsValid(Model) && IsValid(Model->Polys))
 	{
-		// Hash the incoming surface properties and compared it against the cached hash.
-		int32 NumPolys = Model->Polys->Element.Num();
-		uint64 SurfaceHash = 0;
-		for (int32 iPoly = 0; iPoly < NumPolys; ++iPoly)
-		{
-			const FPoly& Poly = Model->Polys->Element[iPoly];
+		for (const FPoly& Poly : Model->Polys->Element)
 			CombinePolyHash(SurfaceHash, Poly);
-		}
-		if (SurfaceHash != CachedSurfaceHash)
-			return true;
 	}
-	else
+#endif
+	return SurfaceHash;
+}
+
+bool FHoudiniBrushPolys::IsUpToDate(const ABrush* InBrushActor, uint32 InPolyFlags) const
+{
+	if (!InBrushActor || !IsValid(InBrushActor->Brush) || !IsValid(InBrushActor->Brush->Polys))
+		return false;
+
+	if (InPolyFlags != PolyFlags || InBrushActor->BrushType != BrushType)
+		return false;
+
+	if (!InBrushActor->GetActorTransform().Equals(Transform, 0.0f))
+		return false;
+
+	// Materials aren't part of the surface hash
+	const TArray<FPoly>& BrushPolys = InBrushActor->Brush->Polys->Element;
+	if (BrushPolys.Num() != Materials.Num())
+		return false;
+
+	for (int32 PolyIdx = 0; PolyIdx < BrushPolys.Num(); PolyIdx++)
 	{
-		if (CachedSurfaceHash != 0)
-			return true;
+		if (BrushPolys[PolyIdx].Material != Materials[PolyIdx])
+			return false;
 	}
-#endif
-	return false;
+
+	return FHoudiniBrushInfo::ComputeSurfaceHash(InBrushActor->Brush) == SurfaceHash;
+}
+
+void FHoudiniBrushPolys::Update(const ABrush* InBrushActor, uint32 InPolyFlags, TArray<FPoly>&& InPolys)
+{
+	if (!InBrushActor || !IsValid(InBrushActor->Brush) || !IsValid(InBrushActor->Brush->Polys))
+		return;
+
+	SurfaceHash = FHoudiniBrushInfo::ComputeSurfaceHash(InBrushActor->Brush);
+	Transform = InBrushActor->GetActorTransform();
+	BrushType = InBrushActor->BrushType;
+	PolyFlags = InPolyFlags;
+
+	const TArray<FPoly>& BrushPolys = InBrushActor->Brush->Polys->Element;
+	Materials.SetNumUninitialized(BrushPolys.Num());
+	for (int32 PolyIdx = 0; PolyIdx < BrushPolys.Num(); PolyIdx++)
+		Materials[PolyIdx] = BrushPolys[PolyIdx].Material;
+
+	Polys = MoveTemp(InPolys);
 }
 
 int32 FHoudiniBrushInfo::GetNumVertexIndicesFromModel(const UModel* Model)
@@ -1746,6 +1795,9 @@ UHoudiniInputObject::DuplicateAndCopyState(UObject * DestOuter)
 void 
 UHoudiniInputObject::CopyStateFrom(UHoudiniInputObject* InInput, bool bCopyAllProperties)
 {
+	// The shared input node we currently hold a reference to, if any
+	const FString PreviousSharedInputNodeKey = SharedInputNodeKey;
+
 	// Copy the state of this UHoudiniInput object.
 	if (bCopyAllProperties)
 	{
@@ -1757,6 +1809,17 @@ UHoudiniInputObject::CopyStateFrom(UHoudiniInputObject* InInput, bool bCopyAllPr
 
 	InputNodeId = InInput->InputNodeId;
 	InputObjectNodeId = InInput->InputObjectNodeId;
+
+	// We now reference the same shared input node as the copied object, take our own reference to it
+	// so it isn't released twice, and release the one we previously held
+	if (InInput->SharedInputNodeKey != PreviousSharedInputNodeKey)
+	{
+		if (!InInput->SharedInputNodeKey.IsEmpty())
+			FHoudiniEngineRuntime::Get().AcquireSharedInputNode(InInput->SharedInputNodeKey);
+		if (!PreviousSharedInputNodeKey.IsEmpty())
+			FHoudiniEngineRuntime::Get().ReleaseSharedInputNode(PreviousSharedInputNodeKey);
+	}
+	SharedInputNodeKey = InInput->SharedInputNodeKey;
 	bHasChanged = InInput->bHasChanged;
 	bNeedsToTriggerUpdate = InInput->bNeedsToTriggerUpdate;
 	bTransformChanged = InInput->bTransformChanged;
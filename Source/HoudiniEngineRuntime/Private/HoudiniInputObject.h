@@ -109,6 +109,9 @@ public:
 	// Invalidate and ask for the deletion of this input object's node
 	virtual void InvalidateData();
 
+	// Releases this object's reference to the shared input node its node references, if any
+	void ReleaseSharedInputNode();
+
 	// UObject accessor
 	virtual UObject* GetObject() const;
 
@@ -172,6 +175,10 @@ public:
 	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
 	int32 InputObjectNodeId;
 
+	// Content key of the shared input node referenced by this input object's node, if any
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	FString SharedInputNodeKey;
+
 	// Guid that uniquely identifies this input object.
 	// Also useful to correlate inputs between blueprint component templates and instances.
 	UPROPERTY(DuplicateTransient)
@@ -647,6 +654,33 @@ public:
 	// Used to restore an input landscape's transform to its original state
 	UPROPERTY()
 	FTransform CachedInputLandscapeTraqnsform;
+
+	// Clears the data cached from the last heightfield upload, forcing the next one to send everything
+	void ResetCachedHeightfieldData();
+
+	// Hashes of the height/layer data of each landscape component sent to Houdini, keyed by the component's section base.
+	// Used to only send the components that changed when the heightfield is updated.
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	TMap<FIntPoint, uint32> CachedComponentHashes;
+
+	// Extent (in landscape quads) of the data sent to Houdini
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	FIntPoint CachedExtentMin;
+
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	FIntPoint CachedExtentMax;
+
+	// Transform of the heightfield sent to Houdini
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	FTransform CachedHeightfieldTransform;
+
+	// Node ids of the heightfield's volumes, keyed by volume name
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	TMap<FString, int32> CachedVolumeNodeIds;
+
+	// Lowest value of the layers whose values are rescaled when sent to Houdini, keyed by volume name
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	TMap<FString, int32> CachedLayerMinValues;
 };
 
 
@@ -716,24 +750,27 @@ struct FHoudiniBrushInfo
 
 	static int32 GetNumVertexIndicesFromModel(const UModel* Model);
 
+	// Hash of the surface properties of the brush's polygons
+	static uint64 ComputeSurfaceHash(const UModel* Model);
+
 	FHoudiniBrushInfo();
 	FHoudiniBrushInfo(ABrush* InBrushActor);
 
 	template <class T>
-	inline void HashCombine(uint64& s, const T & v) const
+	static inline void HashCombine(uint64& s, const T & v)
 	{
 	  std::hash<T> h;
 	  s^= h(v) + 0x9e3779b9 + (s<< 6) + (s>> 2);
 	}
 
-	inline void HashCombine(uint64& s, const FVector & V) const
+	static inline void HashCombine(uint64& s, const FVector & V)
 	{
 		HashCombine(s, V.X);
 		HashCombine(s, V.Y);
 		HashCombine(s, V.Z);
 	}
 
-	inline void CombinePolyHash(uint64& Hash, const FPoly& Poly) const
+	static inline void CombinePolyHash(uint64& Hash, const FPoly& Poly)
 	{
 		HashCombine(Hash, Poly.Base);
 		HashCombine(Hash, Poly.TextureU);
@@ -744,6 +781,23 @@ struct FHoudiniBrushInfo
 	}
 };
 
+// A brush's polygons, transformed to world space when composing the brushes' CSG model.
+// They are only regenerated when the brush's surface hash, transform, type, flags or materials change.
+struct HOUDINIENGINERUNTIME_API FHoudiniBrushPolys
+{
+	bool IsUpToDate(const ABrush* InBrushActor, uint32 InPolyFlags) const;
+
+	void Update(const ABrush* InBrushActor, uint32 InPolyFlags, TArray<FPoly>&& InPolys);
+
+	uint64 SurfaceHash = 0;
+	FTransform Transform;
+	TEnumAsByte<EBrushType> BrushType = EBrushType::Brush_Default;
+	uint32 PolyFlags = 0;
+	TArray<UMaterialInterface*> Materials;
+
+	TArray<FPoly> Polys;
+};
+
 UCLASS()
 class HOUDINIENGINERUNTIME_API UHoudiniInputBrush : public UHoudiniInputActor
 {
@@ -791,6 +845,9 @@ public:
 	// Cache the combined model as well as the input brushes.
 	void UpdateCachedData(UModel* InCombinedModel, const TArray<ABrush*>& InBrushes);
 
+	// The world space polygons of the brushes used to build the combined model
+	TMap<TWeakObjectPtr<ABrush>, FHoudiniBrushPolys>& GetBrushPolysCache() { return BrushPolysCache; };
+
 	// Returns whether this input object should be ignored when uploading objects to Houdini.
 	// This mechanism could be implemented on UHoudiniInputObject.
 	bool ShouldIgnoreThisInput();
@@ -807,6 +864,8 @@ protected:
 	UPROPERTY(Transient, DuplicateTransient)
 	UModel* CombinedModel;
 
+	TMap<TWeakObjectPtr<ABrush>, FHoudiniBrushPolys> BrushPolysCache;
+
 	UPROPERTY()
 	bool bIgnoreInputObject;
 
@@ -196,7 +196,7 @@ UHoudiniInstancedActorComponent::SetNumberOfInstances(const int32& NewInstanceNu
 	// If we want less instances than we already have, destroy the extra properly
 	if (NewInstanceNum < OldInstanceNum)
 	{
-		for (int32 Idx = NewInstanceNum - 1; Idx < InstancedActors.Num(); Idx++)
+		for (int32 Idx = NewInstanceNum; Idx < InstancedActors.Num(); Idx++)
 		{
 			AActor* Instance = InstancedActors.IsValidIndex(Idx) ? InstancedActors[Idx] : nullptr;
 			if (Instance && !Instance->IsPendingKill())
@@ -209,6 +209,22 @@ UHoudiniInstancedActorComponent::SetNumberOfInstances(const int32& NewInstanceNu
 }
 
 
+void
+UHoudiniInstancedActorComponent::ReleaseInstances(const int32& NumToKeep, TArray<AActor*>& OutReleasedActors)
+{
+	const int32 NewInstanceNum = FMath::Max(NumToKeep, 0);
+	for (int32 Idx = NewInstanceNum; Idx < InstancedActors.Num(); Idx++)
+	{
+		AActor* Instance = InstancedActors[Idx];
+		if (Instance && !Instance->IsPendingKill())
+			OutReleasedActors.Add(Instance);
+	}
+
+	if (NewInstanceNum < InstancedActors.Num())
+		InstancedActors.SetNum(NewInstanceNum);
+}
+
+
 void 
 UHoudiniInstancedActorComponent::OnComponentCreated()
 {
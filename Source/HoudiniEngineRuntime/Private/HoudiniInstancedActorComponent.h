@@ -77,6 +77,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniInstancedActorComponent : public USceneCo
 		// Properly deletes extras, new instance actors are nulled 
 		void SetNumberOfInstances(const int32& NewInstanceNum);
 
+		// Removes the instances past NumToKeep without destroying their actors, which are returned for reuse
+		void ReleaseInstances(const int32& NumToKeep, TArray<AActor*>& OutReleasedActors);
+
 		// Set the instances. Transforms are given in local space of this component.
 		bool SetInstanceTransforms(const TArray<FTransform>& InstanceTransforms);
   
@@ -127,6 +127,7 @@ UHoudiniMeshSplitInstancerComponent::AddReferencedObjects( UObject * InThis, FRe
 		for(auto& Mat : ThisMSIC->OverrideMaterials)
 			Collector.AddReferencedObject(Mat, ThisMSIC);
         Collector.AddReferencedObjects(ThisMSIC->Instances, ThisMSIC);
+        Collector.AddReferencedObjects(ThisMSIC->PooledInstances, ThisMSIC);
     }
 }
 
@@ -140,8 +141,8 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
     if (!GetOwner() || GetOwner()->IsPendingKill())
         return false;
 
-    // Destroy previous instances while keeping some of the one that we'll be able to reuse
-    ClearInstances(InstanceTransforms.Num());
+    // Move the instances we don't need anymore to the pool, the others will be reused
+    ClearInstances(InstanceTransforms.Num(), true);
 
 	//
     if( !InstancedMesh || InstancedMesh->IsPendingKill() )
@@ -150,14 +151,14 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
         return false;
     }
 
-    // Only create new SMC for newly added instances
+    // Only acquire SMC for newly added instances, from the pool if possible
+    Instances.Reserve(InstanceTransforms.Num());
     for (int32 iAdd = Instances.Num(); iAdd < InstanceTransforms.Num(); iAdd++)
     {
-        const FTransform& InstanceTransform = InstanceTransforms[iAdd];
-        UStaticMeshComponent* SMC = NewObject< UStaticMeshComponent >(
-            GetOwner(), UStaticMeshComponent::StaticClass(), NAME_None, RF_Transactional);
+        UStaticMeshComponent* SMC = AcquireInstance();
+        if (!SMC)
+            break;
 
-        SMC->SetRelativeTransform(InstanceTransform);
         Instances.Add(SMC);
 		GetOwner()->AddInstanceComponent(SMC);
     }
@@ -167,6 +168,10 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
 	if (InstanceTransforms.Num() != Instances.Num())
 		return false;
 
+	// Update all the instances first, and only register the new ones at the end,
+	// so their render state is created once with the final transform/mesh/materials
+	TArray<UStaticMeshComponent*> InstancesToRegister;
+	const int32 MeshMaterialCount = InstancedMesh->StaticMaterials.Num();
     for (int32 iIns = 0; iIns < Instances.Num(); ++iIns)
     {
         UStaticMeshComponent* SMC = Instances[iIns];
@@ -175,10 +180,12 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
         if (!SMC || SMC->IsPendingKill())
             continue;
 
-        SMC->SetRelativeTransform(InstanceTransform);
-
         // Attach created static mesh component to this thing
-        SMC->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
+        if (SMC->GetAttachParent() != this)
+            SMC->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
+
+        if (!SMC->GetRelativeTransform().Equals(InstanceTransform))
+            SMC->SetRelativeTransform(InstanceTransform);
 
         SMC->SetStaticMesh(InstancedMesh);
         SMC->SetVisibility(IsVisible());
@@ -196,12 +203,16 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
 
 		if (MI && !MI->IsPendingKill())
         {
-            int32 MeshMaterialCount = InstancedMesh->StaticMaterials.Num();
             for (int32 Idx = 0; Idx < MeshMaterialCount; ++Idx)
-                SMC->SetMaterial(Idx, MI);
+            {
+                // Only set the materials that changed to avoid dirtying the render state
+                if (SMC->GetMaterial(Idx) != MI)
+                    SMC->SetMaterial(Idx, MI);
+            }
         }
 
-        SMC->RegisterComponent();
+        if (!SMC->IsRegistered())
+            InstancesToRegister.Add(SMC);
 
 		/*
 		// TODO:
@@ -213,35 +224,74 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
 		*/
     }
 
+	for (UStaticMeshComponent* SMC : InstancesToRegister)
+		SMC->RegisterComponent();
+
 	return true;
 }
 
+UStaticMeshComponent*
+UHoudiniMeshSplitInstancerComponent::AcquireInstance()
+{
+	while (PooledInstances.Num() > 0)
+	{
+		UStaticMeshComponent* SMC = PooledInstances.Pop(false);
+		if (!SMC || SMC->IsPendingKill())
+			continue;
+
+		SMC->ClearFlags(RF_Transient);
+		return SMC;
+	}
+
+	return NewObject< UStaticMeshComponent >(
+		GetOwner(), UStaticMeshComponent::StaticClass(), NAME_None, RF_Transactional);
+}
+
 void 
-UHoudiniMeshSplitInstancerComponent::ClearInstances(int32 NumToKeep)
+UHoudiniMeshSplitInstancerComponent::ClearInstances(int32 NumToKeep, bool bPoolRemoved /*=false*/)
 {
-    if (NumToKeep <= 0)
-    {
-        for (auto&& Instance : Instances)
-        {
-            if (Instance)
-            {
-                Instance->ConditionalBeginDestroy();
-            }
-        }
-        Instances.Empty();
-    }
-    else if (NumToKeep > 0 && NumToKeep < Instances.Num())
-    {
-        for (int32 i = NumToKeep; i < Instances.Num(); ++i)
-        {
-            UStaticMeshComponent * Instance = Instances[i];
-            if (Instance)
-            {
-                Instance->ConditionalBeginDestroy();
-            }
-        }
-        Instances.SetNum(NumToKeep);
-    }
+	NumToKeep = FMath::Max(NumToKeep, 0);
+	if (NumToKeep <= 0 && !bPoolRemoved)
+	{
+		// Destroy the pooled instances as well
+		for (auto&& Instance : PooledInstances)
+		{
+			if (Instance)
+			{
+				Instance->ConditionalBeginDestroy();
+			}
+		}
+		PooledInstances.Empty();
+	}
+
+	if (NumToKeep >= Instances.Num())
+		return;
+
+	AActor* Owner = GetOwner();
+	for (int32 i = NumToKeep; i < Instances.Num(); ++i)
+	{
+		UStaticMeshComponent * Instance = Instances[i];
+		if (!Instance || Instance->IsPendingKill())
+			continue;
+
+		if (bPoolRemoved)
+		{
+			// Keep the component for later use, but make sure it isn't rendered or saved
+			if (Instance->IsRegistered())
+				Instance->UnregisterComponent();
+
+			if (Owner)
+				Owner->RemoveInstanceComponent(Instance);
+
+			Instance->SetFlags(RF_Transient);
+			PooledInstances.Add(Instance);
+		}
+		else
+		{
+			Instance->ConditionalBeginDestroy();
+		}
+	}
+	Instances.SetNum(NumToKeep);
 }
 
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
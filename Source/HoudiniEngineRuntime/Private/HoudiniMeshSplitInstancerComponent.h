@@ -61,8 +61,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniMeshSplitInstancerComponent : public USce
 		// Overide material mutator
 		void SetOverrideMaterials(const TArray<class UMaterialInterface*>& InMaterialOverrides) { OverrideMaterials = InMaterialOverrides; }
 
-		// Destroy existing instances, keeping a given number of them to be reused
-		void ClearInstances(int32 NumToKeep);
+		// Destroy existing instances, keeping a given number of them to be reused.
+		// When bPoolRemoved is true, the removed instances are unregistered and kept in a pool instead of being destroyed.
+		void ClearInstances(int32 NumToKeep, bool bPoolRemoved = false);
 
 		// Set the instances. Transforms are given in local space of this component.
 		bool SetInstanceTransforms(const TArray<FTransform>& InstanceTransforms);
@@ -74,9 +75,16 @@ class HOUDINIENGINERUNTIME_API UHoudiniMeshSplitInstancerComponent : public USce
 
 	private:
 
+		// Returns a SMC from the pool, or creates a new one if the pool is empty
+		class UStaticMeshComponent* AcquireInstance();
+
 		UPROPERTY(VisibleInstanceOnly, Category = Instances)
 		TArray<class UStaticMeshComponent*> Instances;
 
+		// Unregistered SMCs that are not used anymore and can be reused by the next update
+		UPROPERTY(Transient, DuplicateTransient)
+		TArray<class UStaticMeshComponent*> PooledInstances;
+
 		UPROPERTY(VisibleInstanceOnly, Category = Instances)
 		TArray<class UMaterialInterface*> OverrideMaterials;
 
@@ -87,6 +87,29 @@ struct HOUDINIENGINERUNTIME_API FHoudiniCurveOutputProperties
 	EHoudiniCurveMethod CurveMethod = EHoudiniCurveMethod::Invalid;
 };
 
+// Hashes of the data last written to a landscape region, per block of points.
+// Used to only update the parts of a landscape whose data has changed.
+USTRUCT()
+struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeLayerHashes
+{
+	GENERATED_BODY()
+
+	// The landscape region (in landscape coordinates, max exclusive) the hashes were computed for
+	UPROPERTY()
+	FIntPoint RegionMin = FIntPoint::ZeroValue;
+
+	UPROPERTY()
+	FIntPoint RegionMax = FIntPoint::ZeroValue;
+
+	// Size of the blocks, in points
+	UPROPERTY()
+	int32 BlockSize = 0;
+
+	// One hash per block, rows first
+	UPROPERTY()
+	TArray<uint32> BlockHashes;
+};
+
 UCLASS()
 class HOUDINIENGINERUNTIME_API UHoudiniLandscapePtr : public UObject
 {
@@ -117,6 +140,10 @@ public:
 
 	UPROPERTY()
 	EHoudiniLandscapeOutputBakeType BakeType;
+
+	// Hashes of the height/layer data last written to the landscape, per layer name
+	UPROPERTY()
+	TMap<FName, FHoudiniLandscapeLayerHashes> LayerDataHashes;
 };
 
 
@@ -144,6 +171,10 @@ public:
 
 	UPROPERTY()
 	FString LayerName;
+
+	// Hashes of the height/layer data last written to the edit layer, per layer name
+	UPROPERTY()
+	TMap<FName, FHoudiniLandscapeLayerHashes> LayerDataHashes;
 };
 
 
@@ -234,6 +265,31 @@ public:
 /** Function used by hashing containers to create a unique hash for this type of object. **/
 HOUDINIENGINERUNTIME_API uint32 GetTypeHash(const FHoudiniBakedOutputObjectIdentifier& InIdentifier);
 
+USTRUCT()
+struct HOUDINIENGINERUNTIME_API FHoudiniInstancedOutputCell
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+
+	// Coordinates of the cell in the instancer's grid
+	UPROPERTY()
+	FIntVector Coord = FIntVector::ZeroValue;
+
+	// Index of the variation instanced in this cell
+	UPROPERTY()
+	int32 VariationIndex = -1;
+
+	// Number of instances in this cell
+	UPROPERTY()
+	int32 NumInstances = 0;
+
+	// Hash of the instanced object and transforms of this cell,
+	// used to only update the cells that have changed
+	UPROPERTY()
+	uint32 Hash = 0;
+};
+
 USTRUCT()
 struct HOUDINIENGINERUNTIME_API FHoudiniInstancedOutput
 {
@@ -287,6 +343,15 @@ public:
 	UPROPERTY()
 	TArray<int32> OriginalInstanceIndices;
 
+	// Size of the cells used to partition the instances in a grid,
+	// one component is created per cell and per variation. 0 disables the partitioning.
+	UPROPERTY()
+	float CellSize = 0.0f;
+
+	// The cells currently used by this instanced output
+	UPROPERTY()
+	TArray<FHoudiniInstancedOutputCell> Cells;
+
 	// Indicates this instanced output's component should be recreated
 	UPROPERTY()
 	bool bChanged = false;
@@ -416,6 +481,12 @@ struct HOUDINIENGINERUNTIME_API FHoudiniOutputObject
 		UPROPERTY()
 		FHoudiniCurveOutputProperties CurveOutputProperty;
 
+		// Transform hashes of the foliage instances added by this output object.
+		// Foliage HISMCs are shared by all the instancers using the same foliage type,
+		// this is used to only update/remove the instances we own.
+		UPROPERTY()
+		TArray<uint32> FoliageInstanceHashes;
+
 
 		// NOTE: The idea behind CachedAttributes and CachedTokens is to
 		// collect attributes (such as unreal_level_path and unreal_output_name)
@@ -97,10 +97,19 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	MarshallingLandscapesForceMinMaxValues = false;
 	MarshallingLandscapesForcedMinValue = -2000.0f;
 	MarshallingLandscapesForcedMaxValue = 4553.0f;
+	bMarshallingLandscapesUpdateChangedRegionsOnly = false;
+	MarshallingLandscapesTileMemoryBudgetMB = 0;
+	bMarshallingShareStaticMeshInputNodes = true;
 
 	// Spline marshalling
 	MarshallingSplineResolution = 50.0f;
 
+	// Instancers
+	InstancerCellSize = 0.0f;
+	InstancerCellMinInstances = 1000;
+	bRecycleInstancedActors = true;
+	InstancedActorSpawnTimeBudget = 0.0f;
+
 	// Static mesh proxy refinement settings
 	bEnableProxyStaticMesh = false;
 	bShowDefaultMesh = true;
@@ -290,6 +290,22 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = "GeometryMarshalling", meta = (DisplayName = "Landscape - Forced max value"))
 		float MarshallingLandscapesForcedMaxValue;
 
+		// If true, landscape outputs only write the regions of the height/layer data that changed since the last cook.
+		// Sculpting or painting done in Unreal will then only be overwritten where Houdini's data changes.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = "GeometryMarshalling", meta = (DisplayName = "Landscape - Only update changed regions"))
+		bool bMarshallingLandscapesUpdateChangedRegionsOnly;
+
+		// If greater than zero, landscape tiles are output as a stream: when the editor's memory usage has grown by more than this budget (in MB)
+		// since the last release, the packages created so far are saved and unused memory is released before the next tile.
+		// Zero disables tile streaming.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = "GeometryMarshalling", meta = (DisplayName = "Landscape - Tile streaming memory budget (MB)", ClampMin = "0"))
+		int32 MarshallingLandscapesTileMemoryBudgetMB;
+
+		// If true, a static mesh used as an input by multiple Houdini Asset Components is only sent once per session:
+		// its input node is shared, and each input references it with its own transform.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = "GeometryMarshalling", meta = (DisplayName = "Static Meshes - Share input nodes"))
+		bool bMarshallingShareStaticMeshInputNodes;
+
 		// If this is enabled, additional rot & scale attributes are added on curve inputs
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = "GeometryMarshalling", meta = (DisplayName = "Curves - Add rot & scale attributes on curve inputs"))
 		bool bAddRotAndScaleAttributesOnCurves;
@@ -298,6 +314,29 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = "GeometryMarshalling", meta = (DisplayName = "Curves - Default spline resolution (cm)"))
 		float MarshallingSplineResolution;
 
+		//-------------------------------------------------------------------------------------------------------------
+		// Instancers
+		//-------------------------------------------------------------------------------------------------------------
+
+		// Default size of the grid cells used to partition large instancers, one HISM is created per cell and per variation.
+		// 0 disables the partitioning. Can be overridden per instancer with the unreal_instance_cell_size attribute.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = "Instancers", meta = (DisplayName = "Instancers - Default cell size (cm)", ClampMin = "0.0"))
+		float InstancerCellSize;
+
+		// Minimum number of instances a variation must have before being partitioned in cells
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = "Instancers", meta = (DisplayName = "Instancers - Minimum instances per partitioned variation", ClampMin = "2"))
+		int32 InstancerCellMinInstances;
+
+		// When enabled, the actors removed from instanced actor outputs are reused for the actors that need to be spawned,
+		// instead of being destroyed and respawned.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = "Instancers", meta = (DisplayName = "Instancers - Recycle instanced actors"))
+		bool bRecycleInstancedActors;
+
+		// Maximum time (in ms) spent spawning instanced actors per tick, the remaining actors are spawned on the next ticks.
+		// 0 spawns all the actors immediately.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = "Instancers", meta = (DisplayName = "Instancers - Actor spawn time budget per tick (ms)", ClampMin = "0.0"))
+		float InstancedActorSpawnTimeBudget;
+
 		//-------------------------------------------------------------------------------------------------------------
 		// Static Mesh Options
 		//-------------------------------------------------------------------------------------------------------------